@@ -55,13 +55,30 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 // This piece of code is part of the mitigation working group benchmark
 // suite.  This program executes a 128-AES code from Texas Instruments
 // using the National Institute of Standards and Technology.  While we
-// have converted the test vector suites to header files, two codes need
+// have converted the test vector suites to header files, one code needs
 // to be downloaded and linked to:
 //
 // TI AES-128 code: http://www.ti.com/tool/AES-128
-// Tiny printf: http://www.43oh.com/forum/viewtopic.php?f=10&t=1732
 
-// Download those files and compile them with the rest of the AES code.
+// Download that file and compile it with the rest of the AES code and the
+// platform layer in ../platform.  Alternatively, compile with -DAES_TTABLE
+// and aes_ttable.c instead of the TI code for the 32 bit T-table engine
+// (see aes_ttable.h), or on Linux with -DAES_BITSLICE and aes_bitslice.c
+// for the bitsliced replay engine (see aes_bitslice.h).  The engine is
+// named in the YAML header.  With the T-table engine, -DAES_KEY_BITS=192
+// or 256 runs the NIST suites for that key size instead; the key size and
+// the suites are in the YAML header too.  On Linux, -DAES_THREADS runs the
+// vectors on a pool of threads for a fixed number of passes (see
+// aes_test() below).
+// -DAES_WORKLOAD=AES_MCT, AES_CBC or AES_CTR, with aes_modes.c, replaces
+// the known-answer vectors with chained workloads (see aes_modes.h).
+// -DAES_TRACE, with aes_trace.c, re-executes a known-answer vector that
+// fails its E or D check on the same engine, captures its state after
+// every round (T-table engine) or its output (the others), and reports the
+// first round and step that differs from the golden trace (see
+// aes_trace.h).
+// -DAES_DIGEST checks each known-answer suite as a whole instead of
+// vector by vector (see aes_test() below).
 //
 // This software is otimized for TI microcontrollers, specifically the
 // MSP430F2619.
@@ -74,175 +91,840 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 //*****************************************************************************
 
 
-#include <msp430.h>
-#include <string.h>
+#ifdef AES_THREADS
+#ifndef PLATFORM_POSIX
+#error "the threaded AES replay is for the Linux build (-DPLATFORM_POSIX)"
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+#include "platform.h"
+#include "telemetry.h"
+#if defined(AES_TTABLE)
+#include "aes_ttable.h"
+#elif defined(AES_BITSLICE)
+#include "aes_bitslice.h"
+#else
+#if defined(AES_KEY_BITS) && AES_KEY_BITS != 128
+#error "the TI code is AES-128 only, use -DAES_TTABLE for longer keys"
+#endif
 #include "TI_aes_128.h"
-#include "ECBGFSbox128.h"
-#include "ECBKeySbox128.h"
-#include "ECBVarKey128.h"
-#include "ECBVarTxt128.h"
+#define AES_ENGINE "ti"
+#define AES_KEY_BITS 128
+#endif
+#include <stdint.h>
+#include <string.h>
+#if defined(PLATFORM_POSIX) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "aes_vectors.h"
+#include "aes_modes.h"
+#ifdef AES_TRACE
+#include "aes_trace.h"
+#endif
+#if AES_WORKLOAD != AES_KAT
+#if defined(AES_THREADS) || defined(AES_BITSLICE)
+#error "the chained AES workloads run on a single-block engine, without AES_THREADS"
+#endif
+#include "aes_mode_golden.h"
+#endif
+#ifdef AES_DIGEST
+#if AES_WORKLOAD != AES_KAT || defined(AES_THREADS) || defined(AES_BITSLICE)
+#error "the digest check is for the known-answer vectors on a single-block engine"
+#endif
+#define AES_CHECK "digest"
+#else
+#define AES_CHECK "vectors"
+#endif
 
 //all of the printing is YAML parsable.  The robust printing variable solely determines how much text you get.
-#define robust_printing		1
+#define robust_printing		PRINTING_ADAPTIVE
 
 unsigned long ind = 0;
 int local_errors = 0;
 int in_block = 0;
 
+#ifdef AES_ROUND_KEYS
+//the round keys of the last key, kept while the vectors share it
+aes_round_keys round_keys;
+unsigned char round_keys_for[AES_KEY_BYTES];
+int round_keys_valid = 0;
+#endif
+
 
 void aes_test(void);
-void check_arrays(char array1[], char array2[], int lim, char pre);
-void sendByte(char);
-void printf(char *, ...);
-void initUART(void);
-void initMSP430();
+void load_vector(aes_vector *v, const unsigned char *record);
+#ifndef AES_BITSLICE
+void cipher_vector(aes_vector *v, unsigned char dir);
+#endif
+void vector_done(int *total_errors);
+int arrays_equal(const char *array1, const char *array2, int lim);
+int check_arrays(char array1[], char array2[], int lim, char pre);
+#ifdef AES_TRACE
+void trace_vector(const unsigned char *record, unsigned char dir);
+#else
+#define trace_vector(record, dir) ((void) sizeof(record))  //not evaluated
+#endif
+
+//Errors are rare, so the blocks are first compared a word at a time: one
+//128 bit compare per block on the host, 16 bit words on the MSP430 when
+//both arrays are word aligned.  Only arrays that differ go through the
+//byte loop of check_arrays().
+int arrays_equal(const char *array1, const char *array2, int lim) {
+  int i = 0;
+
+#if defined(PLATFORM_POSIX) && defined(__SSE2__)
+  __m128i a, b;
+
+  for (; i + AES_BLOCK_BYTES <= lim; i += AES_BLOCK_BYTES) {
+    a = _mm_loadu_si128((const __m128i *) (array1 + i));
+    b = _mm_loadu_si128((const __m128i *) (array2 + i));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF)
+      return 0;
+  }
+#elif !defined(PLATFORM_POSIX)
+  if ((((uintptr_t) array1 | (uintptr_t) array2) & 1) == 0) {
+    for (; i + 2 <= lim; i += 2) {
+      if (*(const unsigned int *) (array1 + i) != *(const unsigned int *) (array2 + i))
+	return 0;
+    }
+  }
+#endif
+  return memcmp(array1 + i, array2 + i, lim - i) == 0;
+}
 
-void check_arrays(char *array1, char *array2, int lim, char pre) {
+//Returns the number of bytes that differ
+int check_arrays(char *array1, char *array2, int lim, char pre) {
   int first_error = 0;
+  int robust = -1;
   int i = 0;
   int numberOfErrors = 0;
   
+  if (arrays_equal(array1, array2, lim))
+    return 0;
+
   for (i = 0; i < lim; i++) {
     if (array1[i] != array2[i]) {
       //block of code for printing errors
+      // printing is decided at the first mismatch, by the output budget
+      if (robust < 0) {
+        robust = robustPrinting(robust_printing, ind);
+      }
       if (!first_error) {
-	if (!in_block && robust_printing) {
-	  printf(" - i: %n\r\n", ind);
-	  printf("   %c: {%x: %x,", pre, array1[i], array2[i]);
+	if (!in_block && robust) {
+	  reportIteration(ind);
+	  reportElementValue(pre, 1, array1[i], array2[i]);
 	  first_error = 1;
 	  in_block = 1;  
 	}
-	else if (in_block && robust_printing){
-	  printf("   %c: {%x: %x,", pre, array1[i], array2[i]);
+	else if (in_block && robust){
+	  reportElementValue(pre, 1, array1[i], array2[i]);
 	  first_error = 1;
 	}
       }
       else{
-	if (robust_printing)
-	  printf("%x: %x,", array1[i], array2[i]);
+	if (robust)
+	  reportElementValue(pre, 0, array1[i], array2[i]);
       }
       local_errors++;
       numberOfErrors++;
     }
   }
-  if (first_error && robust_printing) {
+  if (first_error && robust) {
     //finish YAML block
-    printf("}\r\n");
+    reportElementsEnd();
     first_error = 0;
   }
   
-  if (!robust_printing && numberOfErrors > 0) {
+  if (!robust && numberOfErrors > 0) {
     //less prolific printing
     if (!in_block) {
-      printf(" - i: %n\r\n", ind);
-      printf("   %c: %i\r\n", pre, numberOfErrors);
+      reportIteration(ind);
+      reportCount(pre, numberOfErrors);
       in_block = 1;
     }
     else {
-      printf("   %c: %i\r\n", pre, numberOfErrors);
+      reportCount(pre, numberOfErrors);
+    }
+  }
+  return numberOfErrors;
+}
+
+#ifdef AES_TRACE
+//Diagnostic re-execution of a vector that failed its E (dir 0) or D (dir 1)
+//check: the vector is ciphered again by the engine under test, with the
+//kept round keys if it has them, while its states are captured into a
+//static buffer.  The first one that differs from the golden trace of the
+//reference cipher in aes_trace.c is reported, "clean" if none does.
+void trace_vector(const unsigned char *record, unsigned char dir) {
+  static aes_trace trace;
+  const unsigned char *block = record + AES_KEY_BYTES + (dir == 0 ? 0 : AES_BLOCK_BYTES);
+  aes_vector v;
+  int round = 0;
+  int step = 0;
+  int bytes = 0;
+#ifdef AES_BITSLICE
+  static aes_bitslice_keys keys;
+  unsigned char key[1][16];
+  unsigned char input[1][AES_BLOCK_BYTES];
+#endif
+
+  load_vector(&v, record);
+  memcpy(v.input, block, sizeof(v.input));
+  aes_trace_start(&trace);
+#ifdef AES_BITSLICE
+  memcpy(key[0], v.key, sizeof(key[0]));
+  memcpy(input[0], v.input, sizeof(input[0]));
+  aes_bitslice_expand(&keys, (const unsigned char (*)[16]) key, 1);
+  if (dir == 0)
+    aes_bitslice_encrypt(&keys, input, 1);
+  else
+    aes_bitslice_decrypt(&keys, input, 1);
+  memcpy(v.input, input[0], sizeof(v.input));
+#else
+  cipher_vector(&v, dir);
+#endif
+  aes_trace_stop(v.input);
+  bytes = aes_trace_compare(&trace, block, record, dir, &round, &step);
+  reportTrace(dir == 0 ? 'E' : 'D', round, step, bytes);
+}
+#endif
+
+void load_vector(aes_vector *v, const unsigned char *record) {
+  memcpy(v->key, record, sizeof(v->key));
+  memcpy(v->key2, record, sizeof(v->key2));
+  memcpy(v->plain, record + AES_KEY_BYTES, sizeof(v->plain));
+  memcpy(v->input, record + AES_KEY_BYTES, sizeof(v->input));
+  memcpy(v->cipher, record + AES_KEY_BYTES + AES_BLOCK_BYTES, sizeof(v->cipher));
+}
+
+#ifndef AES_BITSLICE
+//Ciphers v->input in place, encrypting for dir 0 and decrypting for dir 1.
+//With the TI code the key is expanded on every call, from key or key2;
+//with an engine that has the round-key API only when it changes.
+void cipher_vector(aes_vector *v, unsigned char dir) {
+#ifdef AES_ROUND_KEYS
+  if (!round_keys_valid || memcmp(round_keys_for, v->key, sizeof(round_keys_for)) != 0) {
+    aes_expand_keys(&round_keys, v->key);
+    memcpy(round_keys_for, v->key, sizeof(round_keys_for));
+    round_keys_valid = 1;
+  }
+  if (dir == 0)
+    aes_encrypt(v->input, &round_keys);
+  else
+    aes_decrypt(v->input, &round_keys);
+#else
+  aes_enc_dec(v->input, dir == 0 ? v->key : v->key2, dir);
+#endif
+}
+#endif
+
+void vector_done(int *total_errors) {
+#ifdef AES_ROUND_KEYS
+  //an upset in the kept round keys would fail every vector until the key
+  //changes, so they are expanded again after an error
+  if (local_errors)
+    round_keys_valid = 0;
+#endif
+  *total_errors += local_errors;
+  local_errors = 0;
+  in_block = 0;
+  ind++;
+  iterationDone();
+
+  //print an "I am alive" message every once in a awhile
+  if (ind % AES_HEARTBEAT == 0 && ind != 0) {
+    reportHeartbeat(ind, total_errors, 1);
+  }
+}
+
+#if AES_WORKLOAD == AES_MCT
+
+//Monte Carlo test: each iteration runs one checkpoint of the encryption and
+//of the decryption chain and checks only where each chain ends.
+void aes_test()
+{
+  unsigned int k = 0;
+  unsigned int offset = 0;
+  int total_errors = 0;
+  aes_vector v;
+
+  while(1) {
+    for (k = 0; k < AES_MCT_CHECKPOINTS; k++) {
+      //the records are key, plaintext and ciphertext, like the KAT vectors
+      offset = k * (sizeof(v.key) + 2 * AES_BLOCK_BYTES);
+      load_vector(&v, aes_mct_encrypt + offset);
+      aes_mct(v.input, v.key, 0);
+      check_arrays((char *) v.input, (char *) v.cipher, sizeof(v.input), 'E');
+
+      load_vector(&v, aes_mct_decrypt + offset);
+      memcpy(v.input, v.cipher, sizeof(v.input));
+      aes_mct(v.input, v.key, 1);
+      check_arrays((char *) v.input, (char *) v.plain, sizeof(v.input), 'D');
+
+      vector_done(&total_errors);
     }
   }
 }
 
+#elif AES_WORKLOAD != AES_KAT
+
+//CBC or CTR: each iteration encrypts and decrypts one message in place and
+//checks the digest of the result after each pass.
 void aes_test()
 {
-  int i = 0;
-  int j = 0;
-  int k = 0;
-  unsigned int count = 0;
-  unsigned int ret = 0;
+  unsigned int k = 0;
   int total_errors = 0;
-  int first_error = 0;
-  
-  unsigned char key[] = { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-  unsigned char key2[] = { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-  unsigned char gold_cypher[] = {0x08, 0xa4, 0xe2, 0xef, 0xec, 0x8a, 0x8e, 0x33, 0x12, 0xca, 0x74, 0x60, 0xb9, 0x04, 0x0b, 0xbf };
-  unsigned char gold_plain[] = {0x58, 0xc8, 0xe0, 0x0b, 0x26, 0x31, 0x68, 0x6d, 0x54, 0xea, 0xb8, 0x4b, 0x91, 0xf0, 0xac, 0xa1 };
-  unsigned char input[] = {0x58, 0xc8, 0xe0, 0x0b, 0x26, 0x31, 0x68, 0x6d, 0x54, 0xea, 0xb8, 0x4b, 0x91, 0xf0, 0xac, 0xa1 };
-  
+  const aes_suite *suite = &aes_suites[AES_MODE_SUITE];
+  const unsigned char *record;
+  unsigned char buffer[AES_RECORD_MAX_BYTES];
+  unsigned char digest[AES_BLOCK_BYTES];
+#if AES_WORKLOAD == AES_CBC
+  const unsigned char *golden = aes_cbc_digest;
+#else
+  const unsigned char *golden = aes_ctr_digest;
+#endif
+
+  //the message is the RAM under test
+  static unsigned char message[AES_MODE_BLOCKS][AES_BLOCK_BYTES];
+
   while(1) {
-    for (k = 0; k < 4; k++) {
-      if (k == 0) {
-	count = ECBGFSbox128_count;
+    for (k = 0; k < AES_MODE_MESSAGES; k++) {
+      record = aes_record(suite, k, buffer);
+      aes_mode_message(message, record);
+
+#if AES_WORKLOAD == AES_CBC
+      aes_cbc(message, record, 0);
+#else
+      aes_ctr(message, record);
+#endif
+      aes_mode_digest(digest, (const unsigned char (*)[16]) message);
+      check_arrays((char *) digest, (char *) golden + k * AES_BLOCK_BYTES, sizeof(digest), 'E');
+
+#if AES_WORKLOAD == AES_CBC
+      aes_cbc(message, record, 1);
+#else
+      aes_ctr(message, record);
+#endif
+      aes_mode_digest(digest, (const unsigned char (*)[16]) message);
+      check_arrays((char *) digest, (char *) aes_mode_plain_digest + k * AES_BLOCK_BYTES,
+		   sizeof(digest), 'D');
+
+      vector_done(&total_errors);
+    }
+  }
+}
+
+#elif defined(AES_THREADS)
+
+//Host soak mode.  Worker threads cipher the vectors in work items of up
+//to ITEM_VECTORS vectors of one suite and keep the outputs; this thread
+//then runs the checks of every item in ind order, so the YAML is the same
+//as that of a single-threaded run.  The work comes in rounds of
+//ROUND_PASSES passes over the suites, split into one shard per thread: a
+//worker takes the items of its own shard and then steals from the others.
+//Two rounds are in flight, so the workers cipher one while the checks of
+//the other are printed.  Each worker counts the vectors that failed per
+//suite on its own and the counts are added up once the workers have
+//finished.
+//
+//BENCH_THREADS sets the number of workers (one per online CPU by default)
+//and BENCH_PASSES the length of the run (1000 passes by default).
+
+#ifdef AES_BITSLICE
+#define ITEM_VECTORS		AES_BITSLICE_BLOCKS
+#else
+#define ITEM_VECTORS		32
+#endif
+#define ROUND_PASSES		16
+#define MAX_THREADS		64
+
+typedef struct {
+  unsigned int suite;
+  unsigned int first;
+  unsigned int count;
+} work_item;
+
+typedef struct {
+  atomic_int done;
+  //whether each vector had a wrong byte, so only those are checked again
+  unsigned char failed[ITEM_VECTORS];
+  //the input, encrypted and decrypted block of each vector
+  unsigned char out[ITEM_VECTORS][3][AES_BLOCK_BYTES];
+} item_result;
+
+typedef struct {
+  atomic_uint next;
+  unsigned int end;
+} shard;
+
+typedef struct {
+  pthread_t thread;
+  unsigned int id;
+  unsigned long failed[AES_SUITES];
+} worker;
+
+static work_item *pass_items;
+static unsigned int items_per_pass = 0;
+static unsigned long passes = 0;
+static unsigned long rounds = 0;
+static unsigned int thread_count = 0;
+static item_result *results[2];
+static shard shards[2][MAX_THREADS];
+static atomic_ulong ready_rounds = 0;   //the workers may start rounds below this
+static atomic_uint left_round[2];       //workers done with the round in a buffer
+static worker workers[MAX_THREADS];
+
+unsigned long env_number(const char *name, unsigned long fallback) {
+  const char *value = getenv(name);
+
+  return value != NULL ? strtoul(value, NULL, 10) : fallback;
+}
+
+void plan_items(void) {
+  unsigned int k = 0;
+  unsigned int j = 0;
+  unsigned int n = 0;
+
+  for (n = 0; n < 2; n++) {
+    //count the items on the first time round, fill them in on the second
+    items_per_pass = 0;
+    for (k = 0; k < AES_SUITES; k++) {
+      for (j = 0; j < aes_suites[k].count; j += ITEM_VECTORS) {
+	if (n == 1) {
+	  pass_items[items_per_pass].suite = k;
+	  pass_items[items_per_pass].first = j;
+	  pass_items[items_per_pass].count = aes_suites[k].count - j < ITEM_VECTORS
+	    ? aes_suites[k].count - j : ITEM_VECTORS;
+	}
+	items_per_pass++;
+      }
+    }
+    if (n == 0)
+      pass_items = malloc(items_per_pass * sizeof(work_item));
+  }
+}
+
+unsigned int round_items(unsigned long r) {
+  unsigned long left = passes - r * ROUND_PASSES;
+
+  return (left < ROUND_PASSES ? left : ROUND_PASSES) * items_per_pass;
+}
+
+void prepare_round(unsigned long r) {
+  unsigned int n = round_items(r);
+  unsigned int i = 0;
+  unsigned int t = 0;
+
+  for (i = 0; i < n; i++)
+    atomic_store(&results[r % 2][i].done, 0);
+  for (t = 0; t < thread_count; t++) {
+    atomic_store(&shards[r % 2][t].next, (unsigned long) n * t / thread_count);
+    shards[r % 2][t].end = (unsigned long) n * (t + 1) / thread_count;
+  }
+  atomic_store(&left_round[r % 2], 0);
+}
+
+unsigned int differing_bytes(const unsigned char *a, const unsigned char *b) {
+  unsigned int i = 0;
+  unsigned int n = 0;
+
+  for (i = 0; i < AES_BLOCK_BYTES; i++)
+    n += a[i] != b[i];
+  return n;
+}
+
+//Ciphers the vectors of an item into res, flags the ones with a wrong byte
+//and returns how many there are
+unsigned int cipher_item(const work_item *item, item_result *res) {
+  const aes_suite *suite = &aes_suites[item->suite];
+  const unsigned char *record;
+  unsigned char buffer[AES_RECORD_MAX_BYTES];
+  unsigned int failed = 0;
+  unsigned int n = 0;
+  aes_vector v;
+#ifdef AES_BITSLICE
+  static _Thread_local aes_bitslice_keys keys;
+  unsigned char key[ITEM_VECTORS][16];
+  unsigned char block[ITEM_VECTORS][AES_BLOCK_BYTES];
+
+  for (n = 0; n < item->count; n++) {
+    load_vector(&v, aes_record(suite, item->first + n, buffer));
+    memcpy(key[n], v.key, sizeof(key[n]));
+    memcpy(block[n], v.input, sizeof(block[n]));
+    memcpy(res->out[n][0], v.input, AES_BLOCK_BYTES);
+  }
+  aes_bitslice_expand(&keys, (const unsigned char (*)[16]) key, item->count);
+  aes_bitslice_encrypt(&keys, block, item->count);
+  for (n = 0; n < item->count; n++)
+    memcpy(res->out[n][1], block[n], AES_BLOCK_BYTES);
+  aes_bitslice_decrypt(&keys, block, item->count);
+  for (n = 0; n < item->count; n++)
+    memcpy(res->out[n][2], block[n], AES_BLOCK_BYTES);
+#else
+  for (n = 0; n < item->count; n++) {
+    load_vector(&v, aes_record(suite, item->first + n, buffer));
+    memcpy(res->out[n][0], v.input, AES_BLOCK_BYTES);
+    aes_enc_dec(v.input, v.key, 0);
+    memcpy(res->out[n][1], v.input, AES_BLOCK_BYTES);
+    aes_enc_dec(v.input, v.key2, 1);
+    memcpy(res->out[n][2], v.input, AES_BLOCK_BYTES);
+  }
+#endif
+
+  for (n = 0; n < item->count; n++) {
+    record = aes_record(suite, item->first + n, buffer);
+    res->failed[n] = differing_bytes(res->out[n][0], record + AES_KEY_BYTES)
+      + differing_bytes(res->out[n][1], record + AES_KEY_BYTES + AES_BLOCK_BYTES)
+      + differing_bytes(res->out[n][2], record + AES_KEY_BYTES) != 0;
+    failed += res->failed[n];
+  }
+  return failed;
+}
+
+void *worker_main(void *arg) {
+  worker *w = arg;
+  const work_item *item;
+  item_result *res;
+  shard *s;
+  unsigned long r = 0;
+  unsigned int t = 0;
+  unsigned int i = 0;
+
+  for (r = 0; r < rounds; r++) {
+    while (atomic_load(&ready_rounds) <= r)
+      sched_yield();
+
+    //own shard first, then the others
+    for (t = 0; t < thread_count; t++) {
+      s = &shards[r % 2][(w->id + t) % thread_count];
+      while ((i = atomic_fetch_add(&s->next, 1)) < s->end) {
+	item = &pass_items[i % items_per_pass];
+	res = &results[r % 2][i];
+	w->failed[item->suite] += cipher_item(item, res);
+	atomic_store(&res->done, 1);
       }
-      else if (k == 1) {
-	count = ECBKeySbox128_count;
+    }
+    atomic_fetch_add(&left_round[r % 2], 1);
+  }
+  return NULL;
+}
+
+void aes_test()
+{
+  unsigned long failed[AES_SUITES] = { 0 };
+  unsigned long r = 0;
+  unsigned int n = 0;
+  unsigned int i = 0;
+  unsigned int j = 0;
+  unsigned int k = 0;
+  int total_errors = 0;
+  const work_item *item;
+  const aes_suite *suite;
+  const unsigned char *record;
+  unsigned char buffer[AES_RECORD_MAX_BYTES];
+  item_result *res;
+  aes_vector v;
+
+  passes = env_number("BENCH_PASSES", 1000);
+  thread_count = env_number("BENCH_THREADS", sysconf(_SC_NPROCESSORS_ONLN));
+  if (thread_count < 1)
+    thread_count = 1;
+  if (thread_count > MAX_THREADS)
+    thread_count = MAX_THREADS;
+
+  plan_items();
+  rounds = (passes + ROUND_PASSES - 1) / ROUND_PASSES;
+  results[0] = malloc(ROUND_PASSES * items_per_pass * sizeof(item_result));
+  results[1] = malloc(ROUND_PASSES * items_per_pass * sizeof(item_result));
+  if (pass_items == NULL || results[0] == NULL || results[1] == NULL) {
+    fprintf(stderr, "aes: out of memory\n");
+    exit(1);
+  }
+
+  for (r = 0; r < 2 && r < rounds; r++)
+    prepare_round(r);
+  atomic_store(&ready_rounds, r);
+  for (i = 0; i < thread_count; i++) {
+    workers[i].id = i;
+    pthread_create(&workers[i].thread, NULL, worker_main, &workers[i]);
+  }
+
+  for (r = 0; r < rounds; r++) {
+    n = round_items(r);
+    for (i = 0; i < n; i++) {
+      res = &results[r % 2][i];
+      while (!atomic_load(&res->done))
+	sched_yield();
+
+      item = &pass_items[i % items_per_pass];
+      suite = &aes_suites[item->suite];
+      for (j = 0; j < item->count; j++) {
+	//the checks are only run again where the worker found something
+	if (res->failed[j]) {
+	  record = aes_record(suite, item->first + j, buffer);
+	  load_vector(&v, record);
+	  check_arrays((char *) res->out[j][0], (char *) v.plain, AES_BLOCK_BYTES, 'S');
+	  if (check_arrays((char *) res->out[j][1], (char *) v.cipher, AES_BLOCK_BYTES, 'E'))
+	    trace_vector(record, 0);
+	  if (check_arrays((char *) res->out[j][2], (char *) v.plain, AES_BLOCK_BYTES, 'D'))
+	    trace_vector(record, 1);
+	}
+	vector_done(&total_errors);
       }
-      else if (k == 2) {
-	count = ECBVarKey128_count;
+    }
+
+    //the buffer is free for round r + 2 once every worker has left round r
+    if (r + 2 < rounds) {
+      while (atomic_load(&left_round[r % 2]) < thread_count)
+	sched_yield();
+      prepare_round(r + 2);
+      atomic_store(&ready_rounds, r + 3);
+    }
+  }
+
+  for (i = 0; i < thread_count; i++) {
+    pthread_join(workers[i].thread, NULL);
+    for (k = 0; k < AES_SUITES; k++)
+      failed[k] += workers[i].failed[k];
+  }
+
+  fprintf(stderr, "threads: %u\n", thread_count);
+  fprintf(stderr, "passes: %lu\n", passes);
+  for (k = 0; k < AES_SUITES; k++)
+    fprintf(stderr, "%s: %lu vectors, %lu failed\n", aes_suites[k].name,
+	    passes * aes_suites[k].count, failed[k]);
+  endRun();
+}
+
+#elif defined(AES_BITSLICE)
+
+//Host replay: the vectors go through the cipher AES_BITSLICE_BLOCKS at a
+//time, then each is checked in turn exactly as below.  A batch runs on
+//into the next suite, and from the last suite into the first, so that
+//the small suites do not leave most of the blocks of a call idle.
+void aes_test()
+{
+  unsigned int j = 0;
+  unsigned int k = 0;
+  unsigned int n = 0;
+  unsigned int batch = 0;
+  int total_errors = 0;
+  unsigned char buffer[AES_RECORD_MAX_BYTES];
+
+  static const aes_suite *suite[AES_BITSLICE_BLOCKS];
+  static unsigned int vector[AES_BITSLICE_BLOCKS];
+  static aes_vector v[AES_BITSLICE_BLOCKS];
+  static unsigned char key[AES_BITSLICE_BLOCKS][16];
+  static unsigned char enc[AES_BITSLICE_BLOCKS][AES_BLOCK_BYTES];
+  static unsigned char dec[AES_BITSLICE_BLOCKS][AES_BLOCK_BYTES];
+  static aes_bitslice_keys keys;
+
+  while(1) {
+    for (batch = 0; batch < AES_BITSLICE_BLOCKS; batch++) {
+      suite[batch] = &aes_suites[k];
+      vector[batch] = j;
+      load_vector(&v[batch], aes_record(suite[batch], j, buffer));
+      memcpy(key[batch], v[batch].key, sizeof(key[batch]));
+      memcpy(enc[batch], v[batch].input, sizeof(enc[batch]));
+      if (++j == aes_suites[k].count) {
+	j = 0;
+	k = (k + 1) % AES_SUITES;
       }
-      else {
-	count = ECBVarTxt128_count;
+    }
+
+    aes_bitslice_expand(&keys, (const unsigned char (*)[16]) key, batch);
+    aes_bitslice_encrypt(&keys, enc, batch);
+    memcpy(dec, enc, batch * sizeof(dec[0]));
+    aes_bitslice_decrypt(&keys, dec, batch);
+
+    for (n = 0; n < batch; n++) {
+      check_arrays((char *) v[n].input, (char *) v[n].plain, sizeof(v[n].input), 'S');
+      if (check_arrays((char *) enc[n], (char *) v[n].cipher, sizeof(enc[n]), 'E'))
+	trace_vector(aes_record(suite[n], vector[n], buffer), 0);
+      if (check_arrays((char *) dec[n], (char *) v[n].plain, sizeof(dec[n]), 'D'))
+	trace_vector(aes_record(suite[n], vector[n], buffer), 1);
+      vector_done(&total_errors);
+    }
+  }
+}
+
+#else
+
+//Runs the S, E and D checks of one vector, ciphering v on the way
+void check_vector(aes_vector *v, const unsigned char *record) {
+  check_arrays((char *) v->input, (char *) v->plain, sizeof(v->input), 'S');
+
+  cipher_vector(v, 0);
+
+  if (check_arrays((char *) v->input, (char *) v->cipher, sizeof(v->input), 'E'))
+    trace_vector(record, 0);
+
+  cipher_vector(v, 1);
+
+  if (check_arrays((char *) v->input, (char *) v->plain, sizeof(v->input), 'D'))
+    trace_vector(record, 1);
+}
+
+#ifdef AES_DIGEST
+//CRC-32 (as in zlib), four bits at a time to keep the table at 64 bytes
+const unsigned long crc_nibbles[16] = {
+  0x00000000UL, 0x1db71064UL, 0x3b6e20c8UL, 0x26d930acUL,
+  0x76dc4190UL, 0x6b6b51f4UL, 0x4db26158UL, 0x5005713cUL,
+  0xedb88320UL, 0xf00f9344UL, 0xd6d6a3e8UL, 0xcb61b38cUL,
+  0x9b64c2b0UL, 0x86d3d2d4UL, 0xa00ae278UL, 0xbdbdf21cUL
+};
+
+unsigned long crc_block(unsigned long crc, const unsigned char *block) {
+  int i = 0;
+
+  for (i = 0; i < AES_BLOCK_BYTES; i++) {
+    crc ^= block[i];
+    crc = (crc >> 4) ^ crc_nibbles[crc & 15];
+    crc = (crc >> 4) ^ crc_nibbles[crc & 15];
+  }
+  return crc;
+}
+
+//The suite that just ran failed its digest (G) or some of its round trips
+//(R, the number of vectors).  The failure is reported under the ind of the
+//suite's last vector, then every vector of the suite runs again with the
+//per-vector checks, reported under its own ind, to find what is wrong.
+void replay_suite(const aes_suite *suite, int digest_failed, int round_trips,
+		  int *total_errors) {
+  unsigned long end = ind;
+  unsigned char buffer[AES_RECORD_MAX_BYTES];
+  const unsigned char *record;
+  unsigned int j = 0;
+  aes_vector v;
+
+  ind = end - 1;
+  reportIteration(ind);
+  if (digest_failed)
+    reportCount('G', 1);
+  if (round_trips)
+    reportCount('R', round_trips);
+  *total_errors += digest_failed + round_trips;
+
+#ifdef AES_ROUND_KEYS
+  round_keys_valid = 0;
+#endif
+  for (j = 0; j < suite->count; j++) {
+    ind = end - suite->count + j;
+    in_block = 0;
+    record = aes_record(suite, j, buffer);
+    load_vector(&v, record);
+    check_vector(&v, record);
+#ifdef AES_ROUND_KEYS
+    if (local_errors)
+      round_keys_valid = 0;
+#endif
+    *total_errors += local_errors;
+    local_errors = 0;
+  }
+  in_block = 0;
+  ind = end;
+}
+#endif
+
+//Without AES_DIGEST every vector is checked on its own: the input before
+//ciphering (S), the encryption (E) and the decryption (D), against the
+//values in flash.  With AES_DIGEST a vector is only checked for a round
+//trip, the decryption against the plaintext it was loaded with, and the
+//ciphertexts are folded into a CRC-32 that is checked once per suite
+//against the one in aes_suites[].  A suite that fails runs again vector
+//by vector (replay_suite()).
+void aes_test()
+{
+  unsigned int j = 0;
+  unsigned int k = 0;
+  int total_errors = 0;
+  const aes_suite *suite;
+  const unsigned char *record;
+  unsigned char buffer[AES_RECORD_MAX_BYTES];
+#ifdef AES_DIGEST
+  unsigned long crc = 0;
+  int round_trips = 0;
+#endif
+
+  // the working copy of the vector; key and key2 are overwritten by the TI
+  // code and input is the block being ciphered, so it has to be RAM, and
+  // keeping the golden values next to it keeps the RAM under test the same.
+  // An engine with round keys expands them once for a run of vectors with
+  // the same key, such as all of ECBGFSbox128 and ECBVarTxt128.
+  aes_vector v;
+
+  while(1) {
+    for (k = 0; k < AES_SUITES; k++) {
+      suite = &aes_suites[k];
+      if (suite->key_bytes != sizeof(v.key)) {
+	continue;                       //not the key size this was built for
       }
-      
-      for (j = 0; j < count; j++){	
-	//read data arrays out of flash
-	for (i = 0; i < 16; i++) {
-	  if (k == 0) {
-	    key[i] = ECBGFSbox128[i + j*80];
-	    key2[i] = ECBGFSbox128[i + 16 + j*80];
-	    gold_cypher[i] = ECBGFSbox128[i + 32 + j*80];
-	    gold_plain[i] = ECBGFSbox128[i + 48 + j*80];
-	    input[i] = ECBGFSbox128[i + 64 + j*80];
-	  }
-	  if (k == 1) {
-	    key[i] = ECBKeySbox128[i + j*80];
-	    key2[i] = ECBKeySbox128[i + 16 + j*80];
-	    gold_cypher[i] = ECBKeySbox128[i + 32 + j*80];
-	    gold_plain[i] = ECBKeySbox128[i + 48 + j*80];
-	    input[i] = ECBKeySbox128[i + 64 + j*80];
-	  }
-	  if (k == 2) {
-	    key[i] = ECBVarKey128[i + j*80];
-	    key2[i] = ECBVarKey128[i + 16 + j*80];
-	    gold_cypher[i] = ECBVarKey128[i + 32 + j*80];
-	    gold_plain[i] = ECBVarKey128[i + 48 + j*80];
-	    input[i] = ECBVarKey128[i + 64 + j*80];
-	  }
-	  if (k == 3) {
-	    key[i] = ECBVarTxt128[i + j*80];
-	    key2[i] = ECBVarTxt128[i + 16 + j*80];
-	    gold_cypher[i] = ECBVarTxt128[i + 32 + j*80];
-	    gold_plain[i] = ECBVarTxt128[i + 48 + j*80];
-	    input[i] = ECBVarTxt128[i + 64 + j*80];
-	  }
-	  
-	}
-	
-	check_arrays(input, gold_plain, sizeof(input), 'S');
-	
-	aes_enc_dec(input,key,0);
-	
-	check_arrays(input, gold_cypher, sizeof(input), 'E');
-	
-	aes_enc_dec(input,key2,1);
-	
-	check_arrays(input, gold_plain, sizeof(input), 'D');
-	
-	total_errors += local_errors;
-	local_errors = 0;
-	in_block = 0;
-	ind++;
-
-	//print an "I am alive" message every once in a awhile
-	if (ind % 250 == 0 && ind != 0) {
-	  printf("# %n, %i\r\n", ind, total_errors);
-	}
+
+#ifdef AES_DIGEST
+      crc = 0xFFFFFFFFUL;
+      round_trips = 0;
+#endif
+      for (j = 0; j < suite->count; j++){
+	//read the vector out of flash, or build a VarKey or VarTxt one
+	record = aes_record(suite, j, buffer);
+	load_vector(&v, record);
+
+#ifdef AES_DIGEST
+	cipher_vector(&v, 0);
+	crc = crc_block(crc, v.input);
+	cipher_vector(&v, 1);
+	if (!arrays_equal((char *) v.input, (char *) v.plain, sizeof(v.input)))
+	  round_trips++;
+#else
+	check_vector(&v, record);
+#endif
+
+	vector_done(&total_errors);
       }
+
+#ifdef AES_DIGEST
+      crc ^= 0xFFFFFFFFUL;
+      if (crc != suite->digest || round_trips)
+	replay_suite(suite, crc != suite->digest, round_trips, &total_errors);
+#endif
     }
   }
 }
 
+#endif
+
 int main( void )
 {
+#if AES_WORKLOAD == AES_KAT
+  unsigned int k = 0;
+#endif
   
   //set up part
-  initMSP430();
+  initPlatform();
   
   //print YAML header
   printf("\r\n---\r\n");
-  printf("hw: msp430f2619\r\n");
+  printf("hw: %s\r\n", PLATFORM_HW);
   printf("test: aes\r\n");
+  printf("engine: %s\r\n", AES_ENGINE);
+  printf("workload: %s\r\n", AES_WORKLOAD_NAME);
+  printf("key_bits: %i\r\n", AES_KEY_BITS);
+#if AES_WORKLOAD == AES_KAT
+  printf("suites: [");
+  for (k = 0; k < AES_SUITES; k++)
+    printf(k == 0 ? "%s" : ", %s", aes_suites[k].name);
+  printf("]\r\n");
+  printf("check: %s\r\n", AES_CHECK);
+#else
+  printf("suites: [%s]\r\n", aes_suites[AES_MODE_SUITE].name);
+#endif
   printf("mit: none\r\n");
   printf("printing: %i\r\n", robust_printing);
   printf("ver: 1.0\r\n");
@@ -255,64 +937,3 @@ int main( void )
   //Code should never get here.
   return 0;
 }
-
-void initMSP430() {
-	//MSP430F2619 initialization code
-  WDTCTL = WDTPW + WDTHOLD;              // Stop WDT
-  if (CALBC1_1MHZ==0xFF)		 // If calibration constant erased
-    {
-      while(1);                          // do not load, trap CPU!!
-    }
-  DCOCTL = 0;                            // Select lowest DCOx and MODx settings
-  BCSCTL1 = CALBC1_1MHZ;                 // Set DCO
-  DCOCTL = CALDCO_1MHZ;
-  
-  initUART();
-}
-
-/**
- * Initializes the UART for 9600 baud with a RX interrupt
- **/
-void initUART(void) {
-
-  P3SEL = 0x30;                             // P3.4,5 = USCI_A0 TXD/RXD
-  UCA0CTL1 |= UCSSEL_2;                     // SMCLK
-  UCA0BR0 = 104;                            // 1MHz 9600; (104)decimal = 0x068h
-  UCA0BR1 = 0;                              // 1MHz 9600
-  UCA0MCTL = UCBRS0;                        // Modulation UCBRSx = 1
-  UCA0CTL1 &= ~UCSWRST;                     // **Initialize USCI state machine**
-}
-
-/**
- * puts() is used by printf() to display or send a string.. This function
- * determines where printf prints to. For this case it sends a string
- * out over UART, another option could be to display the string on an
- * LCD display.
- **/
-void puts(char *s) {
-  char c;
-  
-  // Loops through each character in string 's'
-  while (c = *s++) {
-    sendByte(c);
-  }
-}
-
-/**
- * puts() is used by printf() to display or send a character. This function
- * determines where printf prints to. For this case it sends a character
- * out over UART.
- **/
-void putc(char b) {
-  sendByte(b);
-}
-
-/**
- * Sends a single byte out through UART
- **/
-void sendByte(char byte )
-{
-  while (!(IFG2&UCA0TXIFG)); // USCI_A0 TX buffer ready?
-  UCA0TXBUF = byte; // TX -> RXed character
-}
-
@@ -0,0 +1,613 @@
+//*****************************************************************************
+//
+// aes_bitslice.c
+//
+// Bitsliced AES-128, see aes_bitslice.h.  A batch is held as 128 words,
+// one per bit of the block: bit n of s[i][b] is bit b of byte i of block n
+// (a word is AES_BITSLICE_WORDS 64 bit units, the first holding blocks 0 to
+// 63).  AES is then a fixed sequence of word operations that works on all
+// the blocks at once:
+//
+//   SubBytes     the Boyar-Peralta S-box circuit (113 gates) per byte
+//   ShiftRows    renaming bytes
+//   MixColumns   XORs, multiplying by 2 is a shift of the bit words
+//   AddRoundKey  XOR with the bitsliced round key
+//
+// The inverse S-box is the forward circuit between two copies of the
+// inverse affine map, InvMixColumns is MixColumns after a multiply by
+// (5, 0, 4, 0), and the key schedule runs bitsliced too, so every block
+// can have its own key.  Byte i of the block is row i % 4, column i / 4.
+//
+//*****************************************************************************
+
+#include <string.h>
+
+#include "aes_bitslice.h"
+
+#define     ROUNDS              10
+
+typedef aes_bitslice_word word;
+typedef word state[16][8];
+typedef uint64_t slice[16][8];
+
+// the number of the blocks in part h of the words
+#define     PART_COUNT(count, h)    ((count) <= 64 * (h) ? 0 : (count) - 64 * (h) > 64 ? 64 : (count) - 64 * (h))
+
+#if AES_BITSLICE_WORDS > 1
+#define     LANES(w, h)         ((w)[h])
+#else
+#define     LANES(w, h)         (w)
+#endif
+
+static const unsigned char rcon[ROUNDS] =
+{
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+};
+
+// Transposes the 8x8 bit matrix held in x, byte r being row r and bit c
+// column c (Hacker's Delight, 7-3)
+static uint64_t transpose_bits(uint64_t x)
+{
+    uint64_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x ^= t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x ^= t ^ (t << 28);
+    return x;
+}
+
+// The same for the 8x8 byte matrix in r[0..7], byte c of r[i] being column
+// c: swap the off-diagonal 4x4, then 2x2, then 1x1 blocks
+static void transpose_bytes(uint64_t *r)
+{
+    uint64_t t;
+    int i = 0;
+
+    for (i = 0; i < 4; i++)
+    {
+        t = ((r[i] >> 32) ^ r[i + 4]) & 0x00000000FFFFFFFFULL;
+        r[i] ^= t << 32;
+        r[i + 4] ^= t;
+    }
+    for (i = 0; i < 8; i += (i & 1) ? 3 : 1)
+    {
+        t = ((r[i] >> 16) ^ r[i + 2]) & 0x0000FFFF0000FFFFULL;
+        r[i] ^= t << 16;
+        r[i + 2] ^= t;
+    }
+    for (i = 0; i < 8; i += 2)
+    {
+        t = ((r[i] >> 8) ^ r[i + 1]) & 0x00FF00FF00FF00FFULL;
+        r[i] ^= t << 8;
+        r[i + 1] ^= t;
+    }
+}
+
+static uint64_t load_half(const unsigned char *b)
+{
+    return (uint64_t) b[0] | ((uint64_t) b[1] << 8) | ((uint64_t) b[2] << 16)
+            | ((uint64_t) b[3] << 24) | ((uint64_t) b[4] << 32)
+            | ((uint64_t) b[5] << 40) | ((uint64_t) b[6] << 48)
+            | ((uint64_t) b[7] << 56);
+}
+
+static void store_half(unsigned char *b, uint64_t w)
+{
+    b[0] = (unsigned char) w;
+    b[1] = (unsigned char) (w >> 8);
+    b[2] = (unsigned char) (w >> 16);
+    b[3] = (unsigned char) (w >> 24);
+    b[4] = (unsigned char) (w >> 32);
+    b[5] = (unsigned char) (w >> 40);
+    b[6] = (unsigned char) (w >> 48);
+    b[7] = (unsigned char) (w >> 56);
+}
+
+// A batch is transposed in three steps, eight blocks (a group) at a time:
+// the blocks as rows of bytes are transposed so that word i of the group
+// holds byte i of each block, the bits of that word are transposed so that
+// its byte b holds bit b of byte i of each block, and the eight groups'
+// words i are transposed as bytes once more to give s[i][0..7].
+static void load64(slice s, const unsigned char (*blocks)[16], unsigned int count)
+{
+    uint64_t t[8][16];
+    unsigned int n = 0;
+    unsigned int m = 0;
+    int g = 0;
+    int i = 0;
+
+    for (g = 0, n = 0; g < 8; g++, n += 8)
+    {
+        for (m = 0; m < 8; m++)
+        {
+            t[g][m] = n + m < count ? load_half(blocks[n + m]) : 0;
+            t[g][m + 8] = n + m < count ? load_half(blocks[n + m] + 8) : 0;
+        }
+        transpose_bytes(t[g]);
+        transpose_bytes(t[g] + 8);
+        for (i = 0; i < 16; i++)
+        {
+            t[g][i] = transpose_bits(t[g][i]);
+        }
+    }
+
+    for (i = 0; i < 16; i++)
+    {
+        for (g = 0; g < 8; g++)
+        {
+            s[i][g] = t[g][i];
+        }
+        transpose_bytes(s[i]);
+    }
+}
+
+static void store64(const slice s, unsigned char (*blocks)[16], unsigned int count)
+{
+    uint64_t t[8][16];
+    uint64_t column[8];
+    unsigned int n = 0;
+    unsigned int m = 0;
+    int g = 0;
+    int i = 0;
+
+    for (i = 0; i < 16; i++)
+    {
+        memcpy(column, s[i], sizeof(column));
+        transpose_bytes(column);
+        for (g = 0; g < 8; g++)
+        {
+            t[g][i] = transpose_bits(column[g]);
+        }
+    }
+
+    for (g = 0, n = 0; n < count; g++, n += 8)
+    {
+        transpose_bytes(t[g]);
+        transpose_bytes(t[g] + 8);
+        for (m = 0; m < 8 && n + m < count; m++)
+        {
+            store_half(blocks[n + m], t[g][m]);
+            store_half(blocks[n + m] + 8, t[g][m + 8]);
+        }
+    }
+}
+
+// Each 64 bit part of the words is a batch of 64 blocks of its own
+static void load(state s, const unsigned char (*blocks)[16], unsigned int count)
+{
+    slice part;
+    unsigned int h = 0;
+    int i = 0;
+    int b = 0;
+
+    for (h = 0; h < AES_BITSLICE_WORDS; h++)
+    {
+        load64(part, blocks + 64 * h, PART_COUNT(count, h));
+        for (i = 0; i < 16; i++)
+        {
+            for (b = 0; b < 8; b++)
+            {
+                LANES(s[i][b], h) = part[i][b];
+            }
+        }
+    }
+}
+
+static void store(const state s, unsigned char (*blocks)[16], unsigned int count)
+{
+    slice part;
+    unsigned int h = 0;
+    int i = 0;
+    int b = 0;
+
+    for (h = 0; h < AES_BITSLICE_WORDS && count > 64 * h; h++)
+    {
+        for (i = 0; i < 16; i++)
+        {
+            for (b = 0; b < 8; b++)
+            {
+                part[i][b] = LANES(s[i][b], h);
+            }
+        }
+        store64((const uint64_t (*)[8]) part, blocks + 64 * h, PART_COUNT(count, h));
+    }
+}
+
+// Boyar and Peralta, "A depth-16 circuit for the AES S-box", 2011.  x0 is
+// the top bit of the byte.
+static void sub_byte(word *q)
+{
+    word x0, x1, x2, x3, x4, x5, x6, x7;
+    word y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11;
+    word y12, y13, y14, y15, y16, y17, y18, y19, y20, y21;
+    word z0, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10, z11;
+    word z12, z13, z14, z15, z16, z17;
+    word t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11;
+    word t12, t13, t14, t15, t16, t17, t18, t19, t20, t21;
+    word t22, t23, t24, t25, t26, t27, t28, t29, t30, t31;
+    word t32, t33, t34, t35, t36, t37, t38, t39, t40, t41;
+    word t42, t43, t44, t45, t46, t47, t48, t49, t50, t51;
+    word t52, t53, t54, t55, t56, t57, t58, t59, t60, t61;
+    word t62, t63, t64, t65, t66, t67;
+    word s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    // top linear transformation
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    // inversion in GF(2^8), through GF(2^4)
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    // bottom linear transformation, with the affine constant
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+// The inverse of the affine map of the S-box: bit b of the result is bits
+// b + 2, b + 5 and b + 7 of q (mod 8), complemented for bits 0 and 2
+static void inverse_affine(word *q)
+{
+    word q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    word q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+
+    q[0] = ~(q2 ^ q5 ^ q7);
+    q[1] = q3 ^ q6 ^ q0;
+    q[2] = ~(q4 ^ q7 ^ q1);
+    q[3] = q5 ^ q0 ^ q2;
+    q[4] = q6 ^ q1 ^ q3;
+    q[5] = q7 ^ q2 ^ q4;
+    q[6] = q0 ^ q3 ^ q5;
+    q[7] = q1 ^ q4 ^ q6;
+}
+
+static void inv_sub_byte(word *q)
+{
+    inverse_affine(q);
+    sub_byte(q);
+    inverse_affine(q);
+}
+
+static void sub_bytes(state s)
+{
+    int i = 0;
+
+    for (i = 0; i < 16; i++)
+    {
+        sub_byte(s[i]);
+    }
+}
+
+static void inv_sub_bytes(state s)
+{
+    int i = 0;
+
+    for (i = 0; i < 16; i++)
+    {
+        inv_sub_byte(s[i]);
+    }
+}
+
+// Row r moves left by r columns (right for the inverse)
+static void shift_rows(state s, int inverse)
+{
+    state t;
+    int r = 0;
+    int c = 0;
+
+    memcpy(t, s, sizeof(state));
+    for (r = 1; r < 4; r++)
+    {
+        for (c = 0; c < 4; c++)
+        {
+            memcpy(s[r + 4 * c], t[r + 4 * ((inverse ? c + 4 - r : c + r) % 4)],
+                   sizeof(s[0]));
+        }
+    }
+}
+
+static void xtime(word *out, const word *a)
+{
+    word top = a[7];
+
+    out[7] = a[6];
+    out[6] = a[5];
+    out[5] = a[4];
+    out[4] = a[3] ^ top;
+    out[3] = a[2] ^ top;
+    out[2] = a[1];
+    out[1] = a[0] ^ top;
+    out[0] = top;
+}
+
+static void mix_columns(state s)
+{
+    word *a0, *a1, *a2, *a3;
+    word all[8], d[4][8], x[8];
+    int c = 0;
+    int b = 0;
+    int i = 0;
+
+    for (c = 0; c < 4; c++)
+    {
+        a0 = s[4 * c];
+        a1 = s[4 * c + 1];
+        a2 = s[4 * c + 2];
+        a3 = s[4 * c + 3];
+
+        // row i becomes a[i] ^ all ^ 2 (a[i] ^ a[i + 1])
+        for (b = 0; b < 8; b++)
+        {
+            all[b] = a0[b] ^ a1[b] ^ a2[b] ^ a3[b];
+            d[0][b] = a0[b] ^ a1[b];
+            d[1][b] = a1[b] ^ a2[b];
+            d[2][b] = a2[b] ^ a3[b];
+            d[3][b] = a3[b] ^ a0[b];
+        }
+        for (i = 0; i < 4; i++)
+        {
+            xtime(x, d[i]);
+            for (b = 0; b < 8; b++)
+            {
+                s[4 * c + i][b] ^= all[b] ^ x[b];
+            }
+        }
+    }
+}
+
+// InvMixColumns is MixColumns after a[0] and a[2] take 4 (a[0] ^ a[2]) and
+// a[1] and a[3] take 4 (a[1] ^ a[3])
+static void inv_mix_columns(state s)
+{
+    word u[8], v[8];
+    int c = 0;
+    int b = 0;
+
+    for (c = 0; c < 4; c++)
+    {
+        for (b = 0; b < 8; b++)
+        {
+            u[b] = s[4 * c][b] ^ s[4 * c + 2][b];
+            v[b] = s[4 * c + 1][b] ^ s[4 * c + 3][b];
+        }
+        xtime(u, u);
+        xtime(u, u);
+        xtime(v, v);
+        xtime(v, v);
+        for (b = 0; b < 8; b++)
+        {
+            s[4 * c][b] ^= u[b];
+            s[4 * c + 1][b] ^= v[b];
+            s[4 * c + 2][b] ^= u[b];
+            s[4 * c + 3][b] ^= v[b];
+        }
+    }
+    mix_columns(s);
+}
+
+static void add_round_key(state s, const word (*rk)[8])
+{
+    int i = 0;
+    int b = 0;
+
+    for (i = 0; i < 16; i++)
+    {
+        for (b = 0; b < 8; b++)
+        {
+            s[i][b] ^= rk[i][b];
+        }
+    }
+}
+
+void aes_bitslice_expand(aes_bitslice_keys *keys, const unsigned char (*key)[16],
+                         unsigned int count)
+{
+    word temp[4][8];
+    int round = 0;
+    int i = 0;
+    int b = 0;
+
+    load(keys->rk[0], key, count);
+    for (round = 1; round <= ROUNDS; round++)
+    {
+        const word (*prev)[8] = (const word (*)[8]) keys->rk[round - 1];
+        word (*next)[8] = keys->rk[round];
+
+        // RotWord and SubWord of the last column, then the round constant;
+        // the constant is the same for every block, so it complements words
+        for (i = 0; i < 4; i++)
+        {
+            memcpy(temp[i], prev[12 + (i + 1) % 4], sizeof(temp[i]));
+            sub_byte(temp[i]);
+        }
+        for (b = 0; b < 8; b++)
+        {
+            if ((rcon[round - 1] >> b) & 1)
+            {
+                temp[0][b] = ~temp[0][b];
+            }
+        }
+
+        for (i = 0; i < 16; i++)
+        {
+            for (b = 0; b < 8; b++)
+            {
+                next[i][b] = prev[i][b] ^ (i < 4 ? temp[i][b] : next[i - 4][b]);
+            }
+        }
+    }
+}
+
+void aes_bitslice_encrypt(const aes_bitslice_keys *keys, unsigned char (*blocks)[16],
+                          unsigned int count)
+{
+    state s;
+    int round = 0;
+
+    load(s, (const unsigned char (*)[16]) blocks, count);
+    add_round_key(s, keys->rk[0]);
+    for (round = 1; round < ROUNDS; round++)
+    {
+        sub_bytes(s);
+        shift_rows(s, 0);
+        mix_columns(s);
+        add_round_key(s, keys->rk[round]);
+    }
+    sub_bytes(s);
+    shift_rows(s, 0);
+    add_round_key(s, keys->rk[ROUNDS]);
+    store((const word (*)[8]) s, blocks, count);
+}
+
+void aes_bitslice_decrypt(const aes_bitslice_keys *keys, unsigned char (*blocks)[16],
+                          unsigned int count)
+{
+    state s;
+    int round = 0;
+
+    load(s, (const unsigned char (*)[16]) blocks, count);
+    add_round_key(s, keys->rk[ROUNDS]);
+    for (round = ROUNDS - 1; round > 0; round--)
+    {
+        shift_rows(s, 1);
+        inv_sub_bytes(s);
+        add_round_key(s, keys->rk[round]);
+        inv_mix_columns(s);
+    }
+    shift_rows(s, 1);
+    inv_sub_bytes(s);
+    add_round_key(s, keys->rk[0]);
+    store((const word (*)[8]) s, blocks, count);
+}
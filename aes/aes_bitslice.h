@@ -0,0 +1,67 @@
+//*****************************************************************************
+//
+// aes_bitslice.h
+//
+// Bitsliced AES-128 for replaying the known-answer suites on a Linux host,
+// up to AES_BITSLICE_BLOCKS blocks per call, each with its own key.  Build
+// the AES benchmark with -DPLATFORM_POSIX -DAES_BITSLICE and aes_bitslice.c
+// in place of TI_aes_128.c; aes_test() then runs the vectors in batches and
+// prints the same S, E and D records as the single-block engines.
+//
+// The cipher uses no tables and no branches on the data, so its time does
+// not depend on the keys or the blocks.  That, not speed, is what it is
+// for: the T-table engine runs the benchmark faster.  The expanded keys
+// take 11 KB per 64 blocks, which is why this engine is for the host only.
+//
+//*****************************************************************************
+
+#ifndef AES_BITSLICE_H
+#define AES_BITSLICE_H
+
+#ifndef PLATFORM_POSIX
+#error "the bitsliced AES engine is for the Linux build (-DPLATFORM_POSIX)"
+#endif
+
+#if defined(AES_KEY_BITS) && AES_KEY_BITS != 128
+#error "the bitsliced AES engine is AES-128 only"
+#endif
+
+#include <stdint.h>
+
+#define     AES_ENGINE          "bitslice"
+#define     AES_KEY_BITS        128
+
+// Width of the bit words in 64 bit units: 1 is plain C, 2 and 4 use the
+// GCC vector extension for SSE2 and AVX2 registers (compile with -mavx2 for
+// 4).  Each 64 bit unit carries 64 blocks.
+#ifndef AES_BITSLICE_WORDS
+#if defined(__GNUC__) && defined(__SSE2__)
+#define     AES_BITSLICE_WORDS  2
+#else
+#define     AES_BITSLICE_WORDS  1
+#endif
+#endif
+
+#define     AES_BITSLICE_BLOCKS (64 * AES_BITSLICE_WORDS)
+
+#if AES_BITSLICE_WORDS > 1
+typedef uint64_t aes_bitslice_word __attribute__((vector_size(8 * AES_BITSLICE_WORDS)));
+#else
+typedef uint64_t aes_bitslice_word;
+#endif
+
+// Round keys, bit b of byte i of round key r of block n is bit n of
+// rk[r][i][b]
+typedef struct
+{
+    aes_bitslice_word rk[11][16][8];
+} aes_bitslice_keys;
+
+void aes_bitslice_expand(aes_bitslice_keys *keys, const unsigned char (*key)[16],
+                         unsigned int count);
+void aes_bitslice_encrypt(const aes_bitslice_keys *keys, unsigned char (*blocks)[16],
+                          unsigned int count);
+void aes_bitslice_decrypt(const aes_bitslice_keys *keys, unsigned char (*blocks)[16],
+                          unsigned int count);
+
+#endif
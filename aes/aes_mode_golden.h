@@ -0,0 +1,825 @@
+//*****************************************************************************
+//
+// aes_mode_golden.h
+//
+// Generated by tools/aes_mode_gen from suite ECBVarKey128; do not edit.
+// See aes_modes.h for the workloads.
+//
+//*****************************************************************************
+
+#if AES_MCT_CHAIN != 1000 || AES_MCT_CHECKPOINTS != 100 || AES_MODE_BLOCKS != 32 \
+    || AES_MODE_MESSAGES != 64 || AES_MODE_SUITE != 2 || AES_KEY_BITS != 128
+#error "aes_mode_golden.h does not match aes_modes.h, run tools/aes_mode_gen"
+#endif
+
+static const unsigned char aes_mct_encrypt[AES_MCT_CHECKPOINTS * 48] =
+{
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9c, 0x90, 0xad, 0x5f, 0x26, 0xa9, 0xd6, 0x85, 0x92, 0xe9, 0xfa, 0x07, 0x21, 0x73, 0x17, 0x8f,
+    0x1c, 0x90, 0xad, 0x5f, 0x26, 0xa9, 0xd6, 0x85, 0x92, 0xe9, 0xfa, 0x07, 0x21, 0x73, 0x17, 0x8f,
+    0x9c, 0x90, 0xad, 0x5f, 0x26, 0xa9, 0xd6, 0x85, 0x92, 0xe9, 0xfa, 0x07, 0x21, 0x73, 0x17, 0x8f,
+    0x4a, 0x4a, 0x1a, 0xdf, 0x29, 0xad, 0xc4, 0x7b, 0xea, 0x58, 0x9c, 0x45, 0xe8, 0x00, 0xb5, 0xc5,
+    0x56, 0xda, 0xb7, 0x80, 0x0f, 0x04, 0x12, 0xfe, 0x78, 0xb1, 0x66, 0x42, 0xc9, 0x73, 0xa2, 0x4a,
+    0x4a, 0x4a, 0x1a, 0xdf, 0x29, 0xad, 0xc4, 0x7b, 0xea, 0x58, 0x9c, 0x45, 0xe8, 0x00, 0xb5, 0xc5,
+    0x4e, 0x48, 0x2b, 0xed, 0xfd, 0x3d, 0x3f, 0x3a, 0x08, 0xa9, 0x9a, 0x6e, 0x02, 0x29, 0x85, 0xc5,
+    0x18, 0x92, 0x9c, 0x6d, 0xf2, 0x39, 0x2d, 0xc4, 0x70, 0x18, 0xfc, 0x2c, 0xcb, 0x5a, 0x27, 0x8f,
+    0x4e, 0x48, 0x2b, 0xed, 0xfd, 0x3d, 0x3f, 0x3a, 0x08, 0xa9, 0x9a, 0x6e, 0x02, 0x29, 0x85, 0xc5,
+    0x48, 0x9c, 0x26, 0x33, 0xa4, 0x35, 0x08, 0x2e, 0x3c, 0x0b, 0x43, 0x6e, 0xf8, 0x0b, 0xe8, 0xe9,
+    0x50, 0x0e, 0xba, 0x5e, 0x56, 0x0c, 0x25, 0xea, 0x4c, 0x13, 0xbf, 0x42, 0x33, 0x51, 0xcf, 0x66,
+    0x48, 0x9c, 0x26, 0x33, 0xa4, 0x35, 0x08, 0x2e, 0x3c, 0x0b, 0x43, 0x6e, 0xf8, 0x0b, 0xe8, 0xe9,
+    0xc5, 0x87, 0x5f, 0x03, 0x55, 0xe6, 0x2d, 0x19, 0x40, 0x69, 0xe7, 0xac, 0xf1, 0xd1, 0xd6, 0x19,
+    0x95, 0x89, 0xe5, 0x5d, 0x03, 0xea, 0x08, 0xf3, 0x0c, 0x7a, 0x58, 0xee, 0xc2, 0x80, 0x19, 0x7f,
+    0xc5, 0x87, 0x5f, 0x03, 0x55, 0xe6, 0x2d, 0x19, 0x40, 0x69, 0xe7, 0xac, 0xf1, 0xd1, 0xd6, 0x19,
+    0x28, 0x55, 0xdc, 0x4b, 0x74, 0xd2, 0xe7, 0xcf, 0xd1, 0xd9, 0x5d, 0x62, 0x0f, 0x83, 0xc5, 0x65,
+    0xbd, 0xdc, 0x39, 0x16, 0x77, 0x38, 0xef, 0x3c, 0xdd, 0xa3, 0x05, 0x8c, 0xcd, 0x03, 0xdc, 0x1a,
+    0x28, 0x55, 0xdc, 0x4b, 0x74, 0xd2, 0xe7, 0xcf, 0xd1, 0xd9, 0x5d, 0x62, 0x0f, 0x83, 0xc5, 0x65,
+    0xa8, 0xb0, 0xa7, 0x50, 0xdf, 0x6e, 0x84, 0x0d, 0x09, 0x48, 0x28, 0x4b, 0x8b, 0x52, 0xba, 0xb6,
+    0x15, 0x6c, 0x9e, 0x46, 0xa8, 0x56, 0x6b, 0x31, 0xd4, 0xeb, 0x2d, 0xc7, 0x46, 0x51, 0x66, 0xac,
+    0xa8, 0xb0, 0xa7, 0x50, 0xdf, 0x6e, 0x84, 0x0d, 0x09, 0x48, 0x28, 0x4b, 0x8b, 0x52, 0xba, 0xb6,
+    0x34, 0xe7, 0xe0, 0x4d, 0x1b, 0xd1, 0xfb, 0x87, 0x54, 0x27, 0x27, 0xf1, 0x56, 0x2e, 0xd3, 0xc0,
+    0x21, 0x8b, 0x7e, 0x0b, 0xb3, 0x87, 0x90, 0xb6, 0x80, 0xcc, 0x0a, 0x36, 0x10, 0x7f, 0xb5, 0x6c,
+    0x34, 0xe7, 0xe0, 0x4d, 0x1b, 0xd1, 0xfb, 0x87, 0x54, 0x27, 0x27, 0xf1, 0x56, 0x2e, 0xd3, 0xc0,
+    0x09, 0x5b, 0x61, 0x99, 0x6d, 0xf4, 0x38, 0x85, 0xd9, 0xfd, 0xb3, 0x58, 0x59, 0xd7, 0x2a, 0xfc,
+    0x28, 0xd0, 0x1f, 0x92, 0xde, 0x73, 0xa8, 0x33, 0x59, 0x31, 0xb9, 0x6e, 0x49, 0xa8, 0x9f, 0x90,
+    0x09, 0x5b, 0x61, 0x99, 0x6d, 0xf4, 0x38, 0x85, 0xd9, 0xfd, 0xb3, 0x58, 0x59, 0xd7, 0x2a, 0xfc,
+    0xec, 0x4f, 0xbc, 0x83, 0xa7, 0x79, 0x70, 0x27, 0xe8, 0x8d, 0x3b, 0xac, 0xd9, 0xa1, 0xc2, 0x2a,
+    0xc4, 0x9f, 0xa3, 0x11, 0x79, 0x0a, 0xd8, 0x14, 0xb1, 0xbc, 0x82, 0xc2, 0x90, 0x09, 0x5d, 0xba,
+    0xec, 0x4f, 0xbc, 0x83, 0xa7, 0x79, 0x70, 0x27, 0xe8, 0x8d, 0x3b, 0xac, 0xd9, 0xa1, 0xc2, 0x2a,
+    0x7d, 0x86, 0x48, 0xe5, 0x96, 0x0a, 0x86, 0x8b, 0x30, 0xbd, 0x1b, 0x22, 0x6e, 0x5d, 0xbe, 0x39,
+    0xb9, 0x19, 0xeb, 0xf4, 0xef, 0x00, 0x5e, 0x9f, 0x81, 0x01, 0x99, 0xe0, 0xfe, 0x54, 0xe3, 0x83,
+    0x7d, 0x86, 0x48, 0xe5, 0x96, 0x0a, 0x86, 0x8b, 0x30, 0xbd, 0x1b, 0x22, 0x6e, 0x5d, 0xbe, 0x39,
+    0x16, 0x3d, 0x87, 0x98, 0x13, 0x01, 0xe7, 0x5c, 0x00, 0xcc, 0xea, 0xc7, 0xd8, 0x6c, 0x20, 0xd8,
+    0xaf, 0x24, 0x6c, 0x6c, 0xfc, 0x01, 0xb9, 0xc3, 0x81, 0xcd, 0x73, 0x27, 0x26, 0x38, 0xc3, 0x5b,
+    0x16, 0x3d, 0x87, 0x98, 0x13, 0x01, 0xe7, 0x5c, 0x00, 0xcc, 0xea, 0xc7, 0xd8, 0x6c, 0x20, 0xd8,
+    0x59, 0x0e, 0xb0, 0xf9, 0x1e, 0xbb, 0xfd, 0xca, 0x1b, 0xff, 0x50, 0x60, 0xd7, 0xf9, 0x41, 0x5d,
+    0xf6, 0x2a, 0xdc, 0x95, 0xe2, 0xba, 0x44, 0x09, 0x9a, 0x32, 0x23, 0x47, 0xf1, 0xc1, 0x82, 0x06,
+    0x59, 0x0e, 0xb0, 0xf9, 0x1e, 0xbb, 0xfd, 0xca, 0x1b, 0xff, 0x50, 0x60, 0xd7, 0xf9, 0x41, 0x5d,
+    0x73, 0xe6, 0x90, 0x06, 0x2c, 0xa8, 0x5b, 0x73, 0x2e, 0xeb, 0xa2, 0x77, 0x9b, 0x4c, 0x8c, 0xf5,
+    0x85, 0xcc, 0x4c, 0x93, 0xce, 0x12, 0x1f, 0x7a, 0xb4, 0xd9, 0x81, 0x30, 0x6a, 0x8d, 0x0e, 0xf3,
+    0x73, 0xe6, 0x90, 0x06, 0x2c, 0xa8, 0x5b, 0x73, 0x2e, 0xeb, 0xa2, 0x77, 0x9b, 0x4c, 0x8c, 0xf5,
+    0xee, 0x80, 0x94, 0x04, 0xe0, 0xc1, 0xb6, 0xcb, 0x82, 0x96, 0xea, 0x6f, 0xef, 0xa8, 0x1f, 0xae,
+    0x6b, 0x4c, 0xd8, 0x97, 0x2e, 0xd3, 0xa9, 0xb1, 0x36, 0x4f, 0x6b, 0x5f, 0x85, 0x25, 0x11, 0x5d,
+    0xee, 0x80, 0x94, 0x04, 0xe0, 0xc1, 0xb6, 0xcb, 0x82, 0x96, 0xea, 0x6f, 0xef, 0xa8, 0x1f, 0xae,
+    0x2e, 0x03, 0x33, 0xb7, 0x28, 0x85, 0x58, 0xbe, 0x92, 0xef, 0xd8, 0x83, 0xef, 0xdb, 0x7d, 0x84,
+    0x45, 0x4f, 0xeb, 0x20, 0x06, 0x56, 0xf1, 0x0f, 0xa4, 0xa0, 0xb3, 0xdc, 0x6a, 0xfe, 0x6c, 0xd9,
+    0x2e, 0x03, 0x33, 0xb7, 0x28, 0x85, 0x58, 0xbe, 0x92, 0xef, 0xd8, 0x83, 0xef, 0xdb, 0x7d, 0x84,
+    0x11, 0x5c, 0xf4, 0x28, 0x78, 0xe5, 0xc1, 0x7f, 0xea, 0x66, 0x32, 0x06, 0x91, 0x69, 0x62, 0x4c,
+    0x54, 0x13, 0x1f, 0x08, 0x7e, 0xb3, 0x30, 0x70, 0x4e, 0xc6, 0x81, 0xda, 0xfb, 0x97, 0x0e, 0x95,
+    0x11, 0x5c, 0xf4, 0x28, 0x78, 0xe5, 0xc1, 0x7f, 0xea, 0x66, 0x32, 0x06, 0x91, 0x69, 0x62, 0x4c,
+    0x41, 0x27, 0xa5, 0x3f, 0xa1, 0x02, 0x05, 0x59, 0xf1, 0x77, 0xf4, 0x52, 0x75, 0x71, 0xd1, 0x06,
+    0x15, 0x34, 0xba, 0x37, 0xdf, 0xb1, 0x35, 0x29, 0xbf, 0xb1, 0x75, 0x88, 0x8e, 0xe6, 0xdf, 0x93,
+    0x41, 0x27, 0xa5, 0x3f, 0xa1, 0x02, 0x05, 0x59, 0xf1, 0x77, 0xf4, 0x52, 0x75, 0x71, 0xd1, 0x06,
+    0x48, 0xcc, 0x69, 0x7e, 0x13, 0x73, 0xba, 0x63, 0x91, 0xbd, 0xb7, 0xdd, 0x63, 0x2d, 0x31, 0x07,
+    0x5d, 0xf8, 0xd3, 0x49, 0xcc, 0xc2, 0x8f, 0x4a, 0x2e, 0x0c, 0xc2, 0x55, 0xed, 0xcb, 0xee, 0x94,
+    0x48, 0xcc, 0x69, 0x7e, 0x13, 0x73, 0xba, 0x63, 0x91, 0xbd, 0xb7, 0xdd, 0x63, 0x2d, 0x31, 0x07,
+    0x38, 0xaf, 0x6e, 0xb7, 0x00, 0xe2, 0x32, 0xdd, 0x32, 0xef, 0x49, 0xe7, 0x52, 0x15, 0x3f, 0x06,
+    0x65, 0x57, 0xbd, 0xfe, 0xcc, 0x20, 0xbd, 0x97, 0x1c, 0xe3, 0x8b, 0xb2, 0xbf, 0xde, 0xd1, 0x92,
+    0x38, 0xaf, 0x6e, 0xb7, 0x00, 0xe2, 0x32, 0xdd, 0x32, 0xef, 0x49, 0xe7, 0x52, 0x15, 0x3f, 0x06,
+    0x5b, 0x15, 0x28, 0x7a, 0x8c, 0xa6, 0xab, 0x00, 0xc0, 0xbc, 0x1d, 0xbe, 0xdd, 0xd6, 0x30, 0xd3,
+    0x3e, 0x42, 0x95, 0x84, 0x40, 0x86, 0x16, 0x97, 0xdc, 0x5f, 0x96, 0x0c, 0x62, 0x08, 0xe1, 0x41,
+    0x5b, 0x15, 0x28, 0x7a, 0x8c, 0xa6, 0xab, 0x00, 0xc0, 0xbc, 0x1d, 0xbe, 0xdd, 0xd6, 0x30, 0xd3,
+    0xdc, 0x26, 0x93, 0x37, 0xe5, 0x28, 0x2e, 0x4c, 0xf9, 0x08, 0xe8, 0x55, 0x0b, 0x23, 0x45, 0x8e,
+    0xe2, 0x64, 0x06, 0xb3, 0xa5, 0xae, 0x38, 0xdb, 0x25, 0x57, 0x7e, 0x59, 0x69, 0x2b, 0xa4, 0xcf,
+    0xdc, 0x26, 0x93, 0x37, 0xe5, 0x28, 0x2e, 0x4c, 0xf9, 0x08, 0xe8, 0x55, 0x0b, 0x23, 0x45, 0x8e,
+    0x5b, 0x64, 0xb6, 0x4f, 0xa7, 0x66, 0x6d, 0xe4, 0xe2, 0x7f, 0xed, 0x2e, 0x2e, 0xc4, 0x88, 0xa9,
+    0xb9, 0x00, 0xb0, 0xfc, 0x02, 0xc8, 0x55, 0x3f, 0xc7, 0x28, 0x93, 0x77, 0x47, 0xef, 0x2c, 0x66,
+    0x5b, 0x64, 0xb6, 0x4f, 0xa7, 0x66, 0x6d, 0xe4, 0xe2, 0x7f, 0xed, 0x2e, 0x2e, 0xc4, 0x88, 0xa9,
+    0x98, 0xd3, 0xeb, 0xf8, 0x6e, 0x3f, 0x39, 0x24, 0x8d, 0x1a, 0x3c, 0xe9, 0xe9, 0xce, 0x77, 0x36,
+    0x21, 0xd3, 0x5b, 0x04, 0x6c, 0xf7, 0x6c, 0x1b, 0x4a, 0x32, 0xaf, 0x9e, 0xae, 0x21, 0x5b, 0x50,
+    0x98, 0xd3, 0xeb, 0xf8, 0x6e, 0x3f, 0x39, 0x24, 0x8d, 0x1a, 0x3c, 0xe9, 0xe9, 0xce, 0x77, 0x36,
+    0x2f, 0x50, 0x7f, 0xca, 0x91, 0xee, 0xe8, 0x9e, 0xf2, 0x9f, 0x0c, 0x5f, 0x42, 0x24, 0xab, 0x61,
+    0x0e, 0x83, 0x24, 0xce, 0xfd, 0x19, 0x84, 0x85, 0xb8, 0xad, 0xa3, 0xc1, 0xec, 0x05, 0xf0, 0x31,
+    0x2f, 0x50, 0x7f, 0xca, 0x91, 0xee, 0xe8, 0x9e, 0xf2, 0x9f, 0x0c, 0x5f, 0x42, 0x24, 0xab, 0x61,
+    0x50, 0x66, 0x6c, 0x62, 0x72, 0x5a, 0x2c, 0xa7, 0xd1, 0xa1, 0x75, 0x8e, 0xf4, 0xba, 0xea, 0x4f,
+    0x5e, 0xe5, 0x48, 0xac, 0x8f, 0x43, 0xa8, 0x22, 0x69, 0x0c, 0xd6, 0x4f, 0x18, 0xbf, 0x1a, 0x7e,
+    0x50, 0x66, 0x6c, 0x62, 0x72, 0x5a, 0x2c, 0xa7, 0xd1, 0xa1, 0x75, 0x8e, 0xf4, 0xba, 0xea, 0x4f,
+    0x66, 0x92, 0xf5, 0x5d, 0xc9, 0xfe, 0x07, 0x40, 0x5c, 0xa1, 0x83, 0x77, 0xc3, 0xee, 0x5e, 0x6f,
+    0x38, 0x77, 0xbd, 0xf1, 0x46, 0xbd, 0xaf, 0x62, 0x35, 0xad, 0x55, 0x38, 0xdb, 0x51, 0x44, 0x11,
+    0x66, 0x92, 0xf5, 0x5d, 0xc9, 0xfe, 0x07, 0x40, 0x5c, 0xa1, 0x83, 0x77, 0xc3, 0xee, 0x5e, 0x6f,
+    0xb3, 0xbf, 0x8a, 0xb6, 0xf6, 0x10, 0xf1, 0x1e, 0x86, 0xa0, 0xbb, 0x3d, 0xa7, 0x4b, 0x08, 0xd5,
+    0x8b, 0xc8, 0x37, 0x47, 0xb0, 0xad, 0x5e, 0x7c, 0xb3, 0x0d, 0xee, 0x05, 0x7c, 0x1a, 0x4c, 0xc4,
+    0xb3, 0xbf, 0x8a, 0xb6, 0xf6, 0x10, 0xf1, 0x1e, 0x86, 0xa0, 0xbb, 0x3d, 0xa7, 0x4b, 0x08, 0xd5,
+    0xe1, 0x6b, 0xe4, 0xd8, 0xb8, 0x45, 0x6c, 0xb8, 0x50, 0x25, 0x51, 0x93, 0xcd, 0xae, 0x44, 0xcc,
+    0x6a, 0xa3, 0xd3, 0x9f, 0x08, 0xe8, 0x32, 0xc4, 0xe3, 0x28, 0xbf, 0x96, 0xb1, 0xb4, 0x08, 0x08,
+    0xe1, 0x6b, 0xe4, 0xd8, 0xb8, 0x45, 0x6c, 0xb8, 0x50, 0x25, 0x51, 0x93, 0xcd, 0xae, 0x44, 0xcc,
+    0x8f, 0x2d, 0xeb, 0x75, 0xfb, 0xa4, 0xbb, 0xd2, 0xc9, 0x6e, 0xfd, 0xa3, 0xa7, 0x74, 0xa2, 0x55,
+    0xe5, 0x8e, 0x38, 0xea, 0xf3, 0x4c, 0x89, 0x16, 0x2a, 0x46, 0x42, 0x35, 0x16, 0xc0, 0xaa, 0x5d,
+    0x8f, 0x2d, 0xeb, 0x75, 0xfb, 0xa4, 0xbb, 0xd2, 0xc9, 0x6e, 0xfd, 0xa3, 0xa7, 0x74, 0xa2, 0x55,
+    0xee, 0x8b, 0xac, 0x02, 0x68, 0xa3, 0xb6, 0x8c, 0x32, 0x5d, 0x6b, 0x4c, 0xcb, 0x69, 0x0a, 0x4f,
+    0x0b, 0x05, 0x94, 0xe8, 0x9b, 0xef, 0x3f, 0x9a, 0x18, 0x1b, 0x29, 0x79, 0xdd, 0xa9, 0xa0, 0x12,
+    0xee, 0x8b, 0xac, 0x02, 0x68, 0xa3, 0xb6, 0x8c, 0x32, 0x5d, 0x6b, 0x4c, 0xcb, 0x69, 0x0a, 0x4f,
+    0x8a, 0x7c, 0x30, 0xcd, 0x20, 0xf5, 0xab, 0xc5, 0x24, 0x28, 0x22, 0x83, 0xe2, 0x09, 0x3f, 0xfa,
+    0x81, 0x79, 0xa4, 0x25, 0xbb, 0x1a, 0x94, 0x5f, 0x3c, 0x33, 0x0b, 0xfa, 0x3f, 0xa0, 0x9f, 0xe8,
+    0x8a, 0x7c, 0x30, 0xcd, 0x20, 0xf5, 0xab, 0xc5, 0x24, 0x28, 0x22, 0x83, 0xe2, 0x09, 0x3f, 0xfa,
+    0x83, 0x7d, 0xb2, 0x2c, 0xf0, 0xb9, 0x90, 0x3e, 0x6c, 0x36, 0x72, 0x7a, 0x79, 0xc6, 0xe9, 0x52,
+    0x02, 0x04, 0x16, 0x09, 0x4b, 0xa3, 0x04, 0x61, 0x50, 0x05, 0x79, 0x80, 0x46, 0x66, 0x76, 0xba,
+    0x83, 0x7d, 0xb2, 0x2c, 0xf0, 0xb9, 0x90, 0x3e, 0x6c, 0x36, 0x72, 0x7a, 0x79, 0xc6, 0xe9, 0x52,
+    0x13, 0xc1, 0x3d, 0x5a, 0x47, 0x06, 0xa8, 0x93, 0x2b, 0x88, 0x3a, 0x71, 0xee, 0x40, 0x11, 0xe3,
+    0x11, 0xc5, 0x2b, 0x53, 0x0c, 0xa5, 0xac, 0xf2, 0x7b, 0x8d, 0x43, 0xf1, 0xa8, 0x26, 0x67, 0x59,
+    0x13, 0xc1, 0x3d, 0x5a, 0x47, 0x06, 0xa8, 0x93, 0x2b, 0x88, 0x3a, 0x71, 0xee, 0x40, 0x11, 0xe3,
+    0x84, 0xd2, 0x36, 0xd0, 0x62, 0x58, 0x2d, 0xdc, 0xf8, 0xc3, 0xb4, 0x31, 0xbe, 0xac, 0x67, 0xde,
+    0x95, 0x17, 0x1d, 0x83, 0x6e, 0xfd, 0x81, 0x2e, 0x83, 0x4e, 0xf7, 0xc0, 0x16, 0x8a, 0x00, 0x87,
+    0x84, 0xd2, 0x36, 0xd0, 0x62, 0x58, 0x2d, 0xdc, 0xf8, 0xc3, 0xb4, 0x31, 0xbe, 0xac, 0x67, 0xde,
+    0xce, 0x93, 0x42, 0x8f, 0xb8, 0x19, 0xe2, 0xa8, 0xf3, 0x17, 0x17, 0xa4, 0xb1, 0x19, 0xfe, 0x3e,
+    0x5b, 0x84, 0x5f, 0x0c, 0xd6, 0xe4, 0x63, 0x86, 0x70, 0x59, 0xe0, 0x64, 0xa7, 0x93, 0xfe, 0xb9,
+    0xce, 0x93, 0x42, 0x8f, 0xb8, 0x19, 0xe2, 0xa8, 0xf3, 0x17, 0x17, 0xa4, 0xb1, 0x19, 0xfe, 0x3e,
+    0x6a, 0x9c, 0x7d, 0x97, 0x58, 0xae, 0x8a, 0xd7, 0x2d, 0xd8, 0x46, 0xd6, 0xe5, 0x08, 0x3f, 0x02,
+    0x31, 0x18, 0x22, 0x9b, 0x8e, 0x4a, 0xe9, 0x51, 0x5d, 0x81, 0xa6, 0xb2, 0x42, 0x9b, 0xc1, 0xbb,
+    0x6a, 0x9c, 0x7d, 0x97, 0x58, 0xae, 0x8a, 0xd7, 0x2d, 0xd8, 0x46, 0xd6, 0xe5, 0x08, 0x3f, 0x02,
+    0xd4, 0x3d, 0x98, 0x14, 0x48, 0xd6, 0xd6, 0x91, 0x1b, 0x24, 0xf6, 0x62, 0x13, 0x77, 0x62, 0x8d,
+    0xe5, 0x25, 0xba, 0x8f, 0xc6, 0x9c, 0x3f, 0xc0, 0x46, 0xa5, 0x50, 0xd0, 0x51, 0xec, 0xa3, 0x36,
+    0xd4, 0x3d, 0x98, 0x14, 0x48, 0xd6, 0xd6, 0x91, 0x1b, 0x24, 0xf6, 0x62, 0x13, 0x77, 0x62, 0x8d,
+    0x3c, 0x32, 0x30, 0xa0, 0xd7, 0x3e, 0x4a, 0x27, 0x19, 0xd8, 0x99, 0xe4, 0xf4, 0xdc, 0xb5, 0x6e,
+    0xd9, 0x17, 0x8a, 0x2f, 0x11, 0xa2, 0x75, 0xe7, 0x5f, 0x7d, 0xc9, 0x34, 0xa5, 0x30, 0x16, 0x58,
+    0x3c, 0x32, 0x30, 0xa0, 0xd7, 0x3e, 0x4a, 0x27, 0x19, 0xd8, 0x99, 0xe4, 0xf4, 0xdc, 0xb5, 0x6e,
+    0xd4, 0x9b, 0xbc, 0xdc, 0xf1, 0x58, 0x34, 0x35, 0x35, 0x16, 0xbf, 0x53, 0x3e, 0xe3, 0x1d, 0x0f,
+    0x0d, 0x8c, 0x36, 0xf3, 0xe0, 0xfa, 0x41, 0xd2, 0x6a, 0x6b, 0x76, 0x67, 0x9b, 0xd3, 0x0b, 0x57,
+    0xd4, 0x9b, 0xbc, 0xdc, 0xf1, 0x58, 0x34, 0x35, 0x35, 0x16, 0xbf, 0x53, 0x3e, 0xe3, 0x1d, 0x0f,
+    0x3f, 0xa9, 0xcb, 0x64, 0xa9, 0x83, 0xfd, 0x0e, 0xf9, 0xd0, 0x2a, 0xb7, 0xaf, 0x1b, 0x3b, 0xae,
+    0x32, 0x25, 0xfd, 0x97, 0x49, 0x79, 0xbc, 0xdc, 0x93, 0xbb, 0x5c, 0xd0, 0x34, 0xc8, 0x30, 0xf9,
+    0x3f, 0xa9, 0xcb, 0x64, 0xa9, 0x83, 0xfd, 0x0e, 0xf9, 0xd0, 0x2a, 0xb7, 0xaf, 0x1b, 0x3b, 0xae,
+    0xfb, 0x2e, 0x5f, 0x6a, 0xdd, 0xc0, 0xe2, 0x07, 0xb3, 0x74, 0x9b, 0x42, 0xd8, 0x89, 0x53, 0x37,
+    0xc9, 0x0b, 0xa2, 0xfd, 0x94, 0xb9, 0x5e, 0xdb, 0x20, 0xcf, 0xc7, 0x92, 0xec, 0x41, 0x63, 0xce,
+    0xfb, 0x2e, 0x5f, 0x6a, 0xdd, 0xc0, 0xe2, 0x07, 0xb3, 0x74, 0x9b, 0x42, 0xd8, 0x89, 0x53, 0x37,
+    0xdb, 0x30, 0x84, 0xa7, 0x57, 0x06, 0xb5, 0x35, 0x73, 0x68, 0x4d, 0xa5, 0xed, 0xe7, 0x9f, 0x89,
+    0x12, 0x3b, 0x26, 0x5a, 0xc3, 0xbf, 0xeb, 0xee, 0x53, 0xa7, 0x8a, 0x37, 0x01, 0xa6, 0xfc, 0x47,
+    0xdb, 0x30, 0x84, 0xa7, 0x57, 0x06, 0xb5, 0x35, 0x73, 0x68, 0x4d, 0xa5, 0xed, 0xe7, 0x9f, 0x89,
+    0x99, 0xc0, 0x41, 0x77, 0x10, 0x9c, 0x30, 0x63, 0xad, 0x73, 0xcb, 0x91, 0x06, 0x4b, 0xd0, 0xd8,
+    0x8b, 0xfb, 0x67, 0x2d, 0xd3, 0x23, 0xdb, 0x8d, 0xfe, 0xd4, 0x41, 0xa6, 0x07, 0xed, 0x2c, 0x9f,
+    0x99, 0xc0, 0x41, 0x77, 0x10, 0x9c, 0x30, 0x63, 0xad, 0x73, 0xcb, 0x91, 0x06, 0x4b, 0xd0, 0xd8,
+    0xbe, 0x81, 0x2b, 0x10, 0x52, 0x20, 0xd2, 0x55, 0x8b, 0x23, 0xdb, 0xd8, 0x8d, 0x69, 0xa0, 0x9d,
+    0x35, 0x7a, 0x4c, 0x3d, 0x81, 0x03, 0x09, 0xd8, 0x75, 0xf7, 0x9a, 0x7e, 0x8a, 0x84, 0x8c, 0x02,
+    0xbe, 0x81, 0x2b, 0x10, 0x52, 0x20, 0xd2, 0x55, 0x8b, 0x23, 0xdb, 0xd8, 0x8d, 0x69, 0xa0, 0x9d,
+    0xe7, 0x5a, 0x80, 0xb8, 0xc0, 0xcb, 0xcf, 0x0b, 0xb7, 0x8e, 0xa4, 0x0d, 0x02, 0x96, 0xd3, 0x96,
+    0xd2, 0x20, 0xcc, 0x85, 0x41, 0xc8, 0xc6, 0xd3, 0xc2, 0x79, 0x3e, 0x73, 0x88, 0x12, 0x5f, 0x94,
+    0xe7, 0x5a, 0x80, 0xb8, 0xc0, 0xcb, 0xcf, 0x0b, 0xb7, 0x8e, 0xa4, 0x0d, 0x02, 0x96, 0xd3, 0x96,
+    0x34, 0x9e, 0x75, 0x0e, 0x8c, 0x22, 0x3a, 0x5e, 0x70, 0x7e, 0x2d, 0xde, 0xb0, 0x23, 0x96, 0xb5,
+    0xe6, 0xbe, 0xb9, 0x8b, 0xcd, 0xea, 0xfc, 0x8d, 0xb2, 0x07, 0x13, 0xad, 0x38, 0x31, 0xc9, 0x21,
+    0x34, 0x9e, 0x75, 0x0e, 0x8c, 0x22, 0x3a, 0x5e, 0x70, 0x7e, 0x2d, 0xde, 0xb0, 0x23, 0x96, 0xb5,
+    0x5b, 0x85, 0x7b, 0x6b, 0xa2, 0x75, 0x0d, 0xf1, 0x23, 0xd8, 0xb3, 0xb6, 0x41, 0x84, 0x49, 0x88,
+    0xbd, 0x3b, 0xc2, 0xe0, 0x6f, 0x9f, 0xf1, 0x7c, 0x91, 0xdf, 0xa0, 0x1b, 0x79, 0xb5, 0x80, 0xa9,
+    0x5b, 0x85, 0x7b, 0x6b, 0xa2, 0x75, 0x0d, 0xf1, 0x23, 0xd8, 0xb3, 0xb6, 0x41, 0x84, 0x49, 0x88,
+    0x62, 0xf0, 0x89, 0x84, 0xc5, 0x21, 0x35, 0x6a, 0xa5, 0x8e, 0xe1, 0x57, 0xcf, 0x2e, 0xf5, 0x7f,
+    0xdf, 0xcb, 0x4b, 0x64, 0xaa, 0xbe, 0xc4, 0x16, 0x34, 0x51, 0x41, 0x4c, 0xb6, 0x9b, 0x75, 0xd6,
+    0x62, 0xf0, 0x89, 0x84, 0xc5, 0x21, 0x35, 0x6a, 0xa5, 0x8e, 0xe1, 0x57, 0xcf, 0x2e, 0xf5, 0x7f,
+    0xdb, 0x19, 0x4d, 0x63, 0x5b, 0x74, 0x7c, 0x3a, 0x08, 0x2f, 0x9a, 0x1e, 0x9d, 0x61, 0xc7, 0x0f,
+    0x04, 0xd2, 0x06, 0x07, 0xf1, 0xca, 0xb8, 0x2c, 0x3c, 0x7e, 0xdb, 0x52, 0x2b, 0xfa, 0xb2, 0xd9,
+    0xdb, 0x19, 0x4d, 0x63, 0x5b, 0x74, 0x7c, 0x3a, 0x08, 0x2f, 0x9a, 0x1e, 0x9d, 0x61, 0xc7, 0x0f,
+    0x9c, 0x80, 0x65, 0x4d, 0xc0, 0xb8, 0x18, 0xf0, 0x87, 0x11, 0xf8, 0x10, 0x71, 0xba, 0x98, 0xa5,
+    0x98, 0x52, 0x63, 0x4a, 0x31, 0x72, 0xa0, 0xdc, 0xbb, 0x6f, 0x23, 0x42, 0x5a, 0x40, 0x2a, 0x7c,
+    0x9c, 0x80, 0x65, 0x4d, 0xc0, 0xb8, 0x18, 0xf0, 0x87, 0x11, 0xf8, 0x10, 0x71, 0xba, 0x98, 0xa5,
+    0xa9, 0xa5, 0x24, 0xa5, 0xc6, 0xd6, 0xd3, 0x52, 0x03, 0xc4, 0xa1, 0x18, 0x3b, 0x32, 0xa4, 0x88,
+    0x31, 0xf7, 0x47, 0xef, 0xf7, 0xa4, 0x73, 0x8e, 0xb8, 0xab, 0x82, 0x5a, 0x61, 0x72, 0x8e, 0xf4,
+    0xa9, 0xa5, 0x24, 0xa5, 0xc6, 0xd6, 0xd3, 0x52, 0x03, 0xc4, 0xa1, 0x18, 0x3b, 0x32, 0xa4, 0x88,
+    0x61, 0x7f, 0xed, 0x73, 0x29, 0x1c, 0xa6, 0xcc, 0x5a, 0x03, 0xfc, 0x33, 0x1d, 0x2c, 0x4a, 0x43,
+    0x50, 0x88, 0xaa, 0x9c, 0xde, 0xb8, 0xd5, 0x42, 0xe2, 0xa8, 0x7e, 0x69, 0x7c, 0x5e, 0xc4, 0xb7,
+    0x61, 0x7f, 0xed, 0x73, 0x29, 0x1c, 0xa6, 0xcc, 0x5a, 0x03, 0xfc, 0x33, 0x1d, 0x2c, 0x4a, 0x43,
+    0xf3, 0x54, 0xf3, 0x32, 0x56, 0xfa, 0x4c, 0x5a, 0xca, 0x0e, 0x2c, 0xf7, 0x8c, 0xe7, 0x32, 0xc8,
+    0xa3, 0xdc, 0x59, 0xae, 0x88, 0x42, 0x99, 0x18, 0x28, 0xa6, 0x52, 0x9e, 0xf0, 0xb9, 0xf6, 0x7f,
+    0xf3, 0x54, 0xf3, 0x32, 0x56, 0xfa, 0x4c, 0x5a, 0xca, 0x0e, 0x2c, 0xf7, 0x8c, 0xe7, 0x32, 0xc8,
+    0x2d, 0x2d, 0x2a, 0xfa, 0xde, 0x02, 0x23, 0xbe, 0x10, 0x99, 0x97, 0x25, 0xac, 0x55, 0xc2, 0xec,
+    0x8e, 0xf1, 0x73, 0x54, 0x56, 0x40, 0xba, 0xa6, 0x38, 0x3f, 0xc5, 0xbb, 0x5c, 0xec, 0x34, 0x93,
+    0x2d, 0x2d, 0x2a, 0xfa, 0xde, 0x02, 0x23, 0xbe, 0x10, 0x99, 0x97, 0x25, 0xac, 0x55, 0xc2, 0xec,
+    0x70, 0x22, 0x8d, 0xd2, 0x34, 0xec, 0xc6, 0xc7, 0x26, 0xb8, 0x86, 0xd7, 0x96, 0xab, 0x92, 0xb3,
+    0xfe, 0xd3, 0xfe, 0x86, 0x62, 0xac, 0x7c, 0x61, 0x1e, 0x87, 0x43, 0x6c, 0xca, 0x47, 0xa6, 0x20,
+    0x70, 0x22, 0x8d, 0xd2, 0x34, 0xec, 0xc6, 0xc7, 0x26, 0xb8, 0x86, 0xd7, 0x96, 0xab, 0x92, 0xb3,
+    0x3b, 0x75, 0xa9, 0x93, 0x78, 0x3a, 0xb3, 0xcb, 0x29, 0xa8, 0x94, 0x2b, 0xda, 0xbd, 0x73, 0xb6,
+    0xc5, 0xa6, 0x57, 0x15, 0x1a, 0x96, 0xcf, 0xaa, 0x37, 0x2f, 0xd7, 0x47, 0x10, 0xfa, 0xd5, 0x96,
+    0x3b, 0x75, 0xa9, 0x93, 0x78, 0x3a, 0xb3, 0xcb, 0x29, 0xa8, 0x94, 0x2b, 0xda, 0xbd, 0x73, 0xb6,
+    0xc4, 0xfc, 0x55, 0x70, 0x16, 0x11, 0x1b, 0x3e, 0x2b, 0x4c, 0xde, 0xa8, 0xc0, 0x6b, 0x38, 0xa8,
+    0x01, 0x5a, 0x02, 0x65, 0x0c, 0x87, 0xd4, 0x94, 0x1c, 0x63, 0x09, 0xef, 0xd0, 0x91, 0xed, 0x3e,
+    0xc4, 0xfc, 0x55, 0x70, 0x16, 0x11, 0x1b, 0x3e, 0x2b, 0x4c, 0xde, 0xa8, 0xc0, 0x6b, 0x38, 0xa8,
+    0x2d, 0xbf, 0xbe, 0x81, 0xe2, 0x89, 0x41, 0xf7, 0x42, 0xb5, 0x5c, 0xbe, 0xde, 0x19, 0x6c, 0x94,
+    0x2c, 0xe5, 0xbc, 0xe4, 0xee, 0x0e, 0x95, 0x63, 0x5e, 0xd6, 0x55, 0x51, 0x0e, 0x88, 0x81, 0xaa,
+    0x2d, 0xbf, 0xbe, 0x81, 0xe2, 0x89, 0x41, 0xf7, 0x42, 0xb5, 0x5c, 0xbe, 0xde, 0x19, 0x6c, 0x94,
+    0xed, 0x6d, 0x0a, 0x17, 0x9d, 0x87, 0xc0, 0x8b, 0xf6, 0x55, 0xbb, 0xb6, 0xc0, 0x5d, 0x1d, 0x5c,
+    0xc1, 0x88, 0xb6, 0xf3, 0x73, 0x89, 0x55, 0xe8, 0xa8, 0x83, 0xee, 0xe7, 0xce, 0xd5, 0x9c, 0xf6,
+    0xed, 0x6d, 0x0a, 0x17, 0x9d, 0x87, 0xc0, 0x8b, 0xf6, 0x55, 0xbb, 0xb6, 0xc0, 0x5d, 0x1d, 0x5c,
+    0xdc, 0x29, 0x43, 0xd0, 0x19, 0x28, 0x10, 0x26, 0x9f, 0x30, 0x51, 0x6d, 0x35, 0x8d, 0x48, 0x73,
+    0x1d, 0xa1, 0xf5, 0x23, 0x6a, 0xa1, 0x45, 0xce, 0x37, 0xb3, 0xbf, 0x8a, 0xfb, 0x58, 0xd4, 0x85,
+    0xdc, 0x29, 0x43, 0xd0, 0x19, 0x28, 0x10, 0x26, 0x9f, 0x30, 0x51, 0x6d, 0x35, 0x8d, 0x48, 0x73,
+    0xe2, 0x19, 0x9a, 0x7a, 0x9a, 0x6d, 0x44, 0xbc, 0x4e, 0xa8, 0x5c, 0x5f, 0x84, 0xbc, 0xe6, 0x76,
+    0xff, 0xb8, 0x6f, 0x59, 0xf0, 0xcc, 0x01, 0x72, 0x79, 0x1b, 0xe3, 0xd5, 0x7f, 0xe4, 0x32, 0xf3,
+    0xe2, 0x19, 0x9a, 0x7a, 0x9a, 0x6d, 0x44, 0xbc, 0x4e, 0xa8, 0x5c, 0x5f, 0x84, 0xbc, 0xe6, 0x76,
+    0xe2, 0x7b, 0x19, 0x51, 0x71, 0x23, 0x9d, 0x6c, 0x04, 0x3e, 0x5e, 0x6b, 0x0d, 0x62, 0x7a, 0x55,
+    0x1d, 0xc3, 0x76, 0x08, 0x81, 0xef, 0x9c, 0x1e, 0x7d, 0x25, 0xbd, 0xbe, 0x72, 0x86, 0x48, 0xa6,
+    0xe2, 0x7b, 0x19, 0x51, 0x71, 0x23, 0x9d, 0x6c, 0x04, 0x3e, 0x5e, 0x6b, 0x0d, 0x62, 0x7a, 0x55,
+    0xe0, 0xfd, 0x6e, 0xae, 0x5f, 0x1a, 0x13, 0xf5, 0xfd, 0xed, 0x87, 0x47, 0x46, 0x6f, 0x0a, 0x66,
+    0xfd, 0x3e, 0x18, 0xa6, 0xde, 0xf5, 0x8f, 0xeb, 0x80, 0xc8, 0x3a, 0xf9, 0x34, 0xe9, 0x42, 0xc0,
+    0xe0, 0xfd, 0x6e, 0xae, 0x5f, 0x1a, 0x13, 0xf5, 0xfd, 0xed, 0x87, 0x47, 0x46, 0x6f, 0x0a, 0x66,
+    0xa7, 0x74, 0x4d, 0x73, 0x85, 0xac, 0x1a, 0x1a, 0xc4, 0x09, 0x91, 0xf0, 0x65, 0x8f, 0x17, 0x14,
+    0x5a, 0x4a, 0x55, 0xd5, 0x5b, 0x59, 0x95, 0xf1, 0x44, 0xc1, 0xab, 0x09, 0x51, 0x66, 0x55, 0xd4,
+    0xa7, 0x74, 0x4d, 0x73, 0x85, 0xac, 0x1a, 0x1a, 0xc4, 0x09, 0x91, 0xf0, 0x65, 0x8f, 0x17, 0x14,
+    0x1d, 0xa0, 0x30, 0x81, 0xc5, 0x20, 0xc1, 0x5d, 0xb6, 0xbe, 0x08, 0x96, 0x03, 0x34, 0x9a, 0x6a,
+    0x47, 0xea, 0x65, 0x54, 0x9e, 0x79, 0x54, 0xac, 0xf2, 0x7f, 0xa3, 0x9f, 0x52, 0x52, 0xcf, 0xbe,
+    0x1d, 0xa0, 0x30, 0x81, 0xc5, 0x20, 0xc1, 0x5d, 0xb6, 0xbe, 0x08, 0x96, 0x03, 0x34, 0x9a, 0x6a,
+    0xb9, 0xa3, 0xe9, 0x2d, 0x45, 0xa8, 0xa6, 0xdf, 0x21, 0x58, 0xc3, 0xb5, 0x28, 0xf5, 0x26, 0x2a,
+    0xfe, 0x49, 0x8c, 0x79, 0xdb, 0xd1, 0xf2, 0x73, 0xd3, 0x27, 0x60, 0x2a, 0x7a, 0xa7, 0xe9, 0x94,
+    0xb9, 0xa3, 0xe9, 0x2d, 0x45, 0xa8, 0xa6, 0xdf, 0x21, 0x58, 0xc3, 0xb5, 0x28, 0xf5, 0x26, 0x2a,
+    0x8c, 0xa3, 0xfe, 0x7f, 0xd8, 0xb2, 0x8d, 0x19, 0xdc, 0x34, 0xcd, 0x2c, 0x49, 0x4b, 0xfd, 0x8f,
+    0x72, 0xea, 0x72, 0x06, 0x03, 0x63, 0x7f, 0x6a, 0x0f, 0x13, 0xad, 0x06, 0x33, 0xec, 0x14, 0x1b,
+    0x8c, 0xa3, 0xfe, 0x7f, 0xd8, 0xb2, 0x8d, 0x19, 0xdc, 0x34, 0xcd, 0x2c, 0x49, 0x4b, 0xfd, 0x8f,
+    0x8a, 0xf4, 0x93, 0xfb, 0xc1, 0x3c, 0x86, 0x2d, 0xf1, 0x5a, 0xee, 0x4a, 0xd3, 0x1b, 0xc9, 0xfe,
+    0xf8, 0x1e, 0xe1, 0xfd, 0xc2, 0x5f, 0xf9, 0x47, 0xfe, 0x49, 0x43, 0x4c, 0xe0, 0xf7, 0xdd, 0xe5,
+    0x8a, 0xf4, 0x93, 0xfb, 0xc1, 0x3c, 0x86, 0x2d, 0xf1, 0x5a, 0xee, 0x4a, 0xd3, 0x1b, 0xc9, 0xfe,
+    0xdf, 0x6d, 0x84, 0xde, 0xe7, 0xf7, 0xd0, 0x18, 0xbe, 0xdb, 0x20, 0xf6, 0xc2, 0x75, 0xb3, 0xa0,
+    0x27, 0x73, 0x65, 0x23, 0x25, 0xa8, 0x29, 0x5f, 0x40, 0x92, 0x63, 0xba, 0x22, 0x82, 0x6e, 0x45,
+    0xdf, 0x6d, 0x84, 0xde, 0xe7, 0xf7, 0xd0, 0x18, 0xbe, 0xdb, 0x20, 0xf6, 0xc2, 0x75, 0xb3, 0xa0,
+    0x31, 0x60, 0x38, 0xfe, 0xb2, 0xad, 0xa9, 0x91, 0xf2, 0xd9, 0x7e, 0xae, 0xa2, 0xcf, 0x70, 0xd0,
+    0x16, 0x13, 0x5d, 0xdd, 0x97, 0x05, 0x80, 0xce, 0xb2, 0x4b, 0x1d, 0x14, 0x80, 0x4d, 0x1e, 0x95,
+    0x31, 0x60, 0x38, 0xfe, 0xb2, 0xad, 0xa9, 0x91, 0xf2, 0xd9, 0x7e, 0xae, 0xa2, 0xcf, 0x70, 0xd0,
+    0x5d, 0x96, 0x3b, 0xe0, 0xc9, 0x9e, 0x37, 0xbe, 0xf9, 0xf3, 0x67, 0x2d, 0x3c, 0x95, 0x2d, 0x1d,
+    0x4b, 0x85, 0x66, 0x3d, 0x5e, 0x9b, 0xb7, 0x70, 0x4b, 0xb8, 0x7a, 0x39, 0xbc, 0xd8, 0x33, 0x88,
+    0x5d, 0x96, 0x3b, 0xe0, 0xc9, 0x9e, 0x37, 0xbe, 0xf9, 0xf3, 0x67, 0x2d, 0x3c, 0x95, 0x2d, 0x1d,
+    0x9d, 0xd1, 0xa6, 0x0d, 0xf8, 0x39, 0xe5, 0x0b, 0x11, 0x0a, 0x1f, 0x72, 0x34, 0x2f, 0x65, 0x9a,
+    0xd6, 0x54, 0xc0, 0x30, 0xa6, 0xa2, 0x52, 0x7b, 0x5a, 0xb2, 0x65, 0x4b, 0x88, 0xf7, 0x56, 0x12,
+    0x9d, 0xd1, 0xa6, 0x0d, 0xf8, 0x39, 0xe5, 0x0b, 0x11, 0x0a, 0x1f, 0x72, 0x34, 0x2f, 0x65, 0x9a,
+    0x2c, 0x21, 0x4e, 0xba, 0xb0, 0x9d, 0xd1, 0xce, 0x04, 0xab, 0x99, 0xe7, 0x43, 0x61, 0x74, 0x1e,
+    0xfa, 0x75, 0x8e, 0x8a, 0x16, 0x3f, 0x83, 0xb5, 0x5e, 0x19, 0xfc, 0xac, 0xcb, 0x96, 0x22, 0x0c,
+    0x2c, 0x21, 0x4e, 0xba, 0xb0, 0x9d, 0xd1, 0xce, 0x04, 0xab, 0x99, 0xe7, 0x43, 0x61, 0x74, 0x1e,
+    0x15, 0x56, 0xb3, 0x7e, 0x1e, 0x4c, 0xdb, 0x15, 0x0f, 0xef, 0x11, 0x88, 0xc2, 0xb8, 0x3a, 0x61,
+    0xef, 0x23, 0x3d, 0xf4, 0x08, 0x73, 0x58, 0xa0, 0x51, 0xf6, 0xed, 0x24, 0x09, 0x2e, 0x18, 0x6d,
+    0x15, 0x56, 0xb3, 0x7e, 0x1e, 0x4c, 0xdb, 0x15, 0x0f, 0xef, 0x11, 0x88, 0xc2, 0xb8, 0x3a, 0x61,
+    0xf6, 0xd2, 0x4b, 0xa8, 0x79, 0x7c, 0xd0, 0x6b, 0x96, 0xd8, 0xe3, 0x3b, 0xb5, 0xbb, 0x98, 0x0e,
+    0x19, 0xf1, 0x76, 0x5c, 0x71, 0x0f, 0x88, 0xcb, 0xc7, 0x2e, 0x0e, 0x1f, 0xbc, 0x95, 0x80, 0x63,
+    0xf6, 0xd2, 0x4b, 0xa8, 0x79, 0x7c, 0xd0, 0x6b, 0x96, 0xd8, 0xe3, 0x3b, 0xb5, 0xbb, 0x98, 0x0e,
+    0xce, 0xaf, 0x90, 0xc2, 0xf3, 0x1a, 0x2c, 0x33, 0x5b, 0x1c, 0xc2, 0x83, 0x47, 0x18, 0x93, 0x8d,
+    0xd7, 0x5e, 0xe6, 0x9e, 0x82, 0x15, 0xa4, 0xf8, 0x9c, 0x32, 0xcc, 0x9c, 0xfb, 0x8d, 0x13, 0xee,
+    0xce, 0xaf, 0x90, 0xc2, 0xf3, 0x1a, 0x2c, 0x33, 0x5b, 0x1c, 0xc2, 0x83, 0x47, 0x18, 0x93, 0x8d,
+    0xb8, 0xbf, 0x0e, 0xcf, 0x5f, 0xeb, 0x92, 0xbe, 0x72, 0xea, 0x82, 0xaf, 0x08, 0x33, 0x3d, 0x35,
+    0x6f, 0xe1, 0xe8, 0x51, 0xdd, 0xfe, 0x36, 0x46, 0xee, 0xd8, 0x4e, 0x33, 0xf3, 0xbe, 0x2e, 0xdb,
+    0xb8, 0xbf, 0x0e, 0xcf, 0x5f, 0xeb, 0x92, 0xbe, 0x72, 0xea, 0x82, 0xaf, 0x08, 0x33, 0x3d, 0x35,
+    0x24, 0xe3, 0xed, 0x95, 0xe5, 0xc8, 0xf9, 0x9e, 0x38, 0x9b, 0xe7, 0xb5, 0x1a, 0x40, 0xa2, 0xf2,
+    0x4b, 0x02, 0x05, 0xc4, 0x38, 0x36, 0xcf, 0xd8, 0xd6, 0x43, 0xa9, 0x86, 0xe9, 0xfe, 0x8c, 0x29,
+    0x24, 0xe3, 0xed, 0x95, 0xe5, 0xc8, 0xf9, 0x9e, 0x38, 0x9b, 0xe7, 0xb5, 0x1a, 0x40, 0xa2, 0xf2,
+    0xee, 0x66, 0x7b, 0xe0, 0x68, 0xe1, 0x9f, 0x88, 0xcb, 0x82, 0xee, 0xec, 0x60, 0xc4, 0x9e, 0x4d,
+    0xa5, 0x64, 0x7e, 0x24, 0x50, 0xd7, 0x50, 0x50, 0x1d, 0xc1, 0x47, 0x6a, 0x89, 0x3a, 0x12, 0x64,
+    0xee, 0x66, 0x7b, 0xe0, 0x68, 0xe1, 0x9f, 0x88, 0xcb, 0x82, 0xee, 0xec, 0x60, 0xc4, 0x9e, 0x4d,
+    0x73, 0x5f, 0x9f, 0x05, 0x08, 0x37, 0xaf, 0xf8, 0x23, 0x62, 0x69, 0x69, 0x14, 0xe1, 0x02, 0x2b,
+    0xd6, 0x3b, 0xe1, 0x21, 0x58, 0xe0, 0xff, 0xa8, 0x3e, 0xa3, 0x2e, 0x03, 0x9d, 0xdb, 0x10, 0x4f,
+    0x73, 0x5f, 0x9f, 0x05, 0x08, 0x37, 0xaf, 0xf8, 0x23, 0x62, 0x69, 0x69, 0x14, 0xe1, 0x02, 0x2b,
+    0xc3, 0x1b, 0xc6, 0x7f, 0xed, 0x97, 0x2f, 0xbc, 0xb1, 0x47, 0xb6, 0x4c, 0xa8, 0x11, 0x64, 0xa3,
+    0x15, 0x20, 0x27, 0x5e, 0xb5, 0x77, 0xd0, 0x14, 0x8f, 0xe4, 0x98, 0x4f, 0x35, 0xca, 0x74, 0xec,
+    0xc3, 0x1b, 0xc6, 0x7f, 0xed, 0x97, 0x2f, 0xbc, 0xb1, 0x47, 0xb6, 0x4c, 0xa8, 0x11, 0x64, 0xa3,
+    0xfa, 0xde, 0xe2, 0xa4, 0xb1, 0x98, 0x2d, 0x5c, 0x0a, 0xc4, 0xa0, 0x8d, 0x2e, 0xac, 0xab, 0x42,
+    0xef, 0xfe, 0xc5, 0xfa, 0x04, 0xef, 0xfd, 0x48, 0x85, 0x20, 0x38, 0xc2, 0x1b, 0x66, 0xdf, 0xae,
+    0xfa, 0xde, 0xe2, 0xa4, 0xb1, 0x98, 0x2d, 0x5c, 0x0a, 0xc4, 0xa0, 0x8d, 0x2e, 0xac, 0xab, 0x42,
+    0x64, 0x36, 0xe7, 0xbb, 0x57, 0xf2, 0xf4, 0x40, 0xef, 0xd7, 0x9b, 0xbc, 0x4a, 0xc6, 0x90, 0x35,
+    0x8b, 0xc8, 0x22, 0x41, 0x53, 0x1d, 0x09, 0x08, 0x6a, 0xf7, 0xa3, 0x7e, 0x51, 0xa0, 0x4f, 0x9b,
+    0x64, 0x36, 0xe7, 0xbb, 0x57, 0xf2, 0xf4, 0x40, 0xef, 0xd7, 0x9b, 0xbc, 0x4a, 0xc6, 0x90, 0x35,
+    0xa4, 0x1c, 0x31, 0x6f, 0xe8, 0xa9, 0xfc, 0x3e, 0x6c, 0x56, 0x7d, 0xad, 0x94, 0x43, 0x64, 0x01,
+    0x2f, 0xd4, 0x13, 0x2e, 0xbb, 0xb4, 0xf5, 0x36, 0x06, 0xa1, 0xde, 0xd3, 0xc5, 0xe3, 0x2b, 0x9a,
+    0xa4, 0x1c, 0x31, 0x6f, 0xe8, 0xa9, 0xfc, 0x3e, 0x6c, 0x56, 0x7d, 0xad, 0x94, 0x43, 0x64, 0x01,
+    0xcc, 0x18, 0xd3, 0xd5, 0xf4, 0x76, 0x41, 0x62, 0x92, 0xf1, 0x96, 0xdd, 0xdd, 0x92, 0x85, 0x86,
+    0xe3, 0xcc, 0xc0, 0xfb, 0x4f, 0xc2, 0xb4, 0x54, 0x94, 0x50, 0x48, 0x0e, 0x18, 0x71, 0xae, 0x1c,
+    0xcc, 0x18, 0xd3, 0xd5, 0xf4, 0x76, 0x41, 0x62, 0x92, 0xf1, 0x96, 0xdd, 0xdd, 0x92, 0x85, 0x86,
+    0xcd, 0x3e, 0xdd, 0x0d, 0x73, 0x0c, 0x5c, 0x29, 0xc0, 0xfd, 0xb3, 0x6f, 0x2d, 0x40, 0x2c, 0x3c,
+    0x2e, 0xf2, 0x1d, 0xf6, 0x3c, 0xce, 0xe8, 0x7d, 0x54, 0xad, 0xfb, 0x61, 0x35, 0x31, 0x82, 0x20,
+    0xcd, 0x3e, 0xdd, 0x0d, 0x73, 0x0c, 0x5c, 0x29, 0xc0, 0xfd, 0xb3, 0x6f, 0x2d, 0x40, 0x2c, 0x3c,
+    0x31, 0xbd, 0x1d, 0x56, 0x90, 0x13, 0xf5, 0x35, 0xba, 0x69, 0x6f, 0x36, 0xa0, 0xfe, 0xb9, 0x8f,
+    0x1f, 0x4f, 0x00, 0xa0, 0xac, 0xdd, 0x1d, 0x48, 0xee, 0xc4, 0x94, 0x57, 0x95, 0xcf, 0x3b, 0xaf,
+    0x31, 0xbd, 0x1d, 0x56, 0x90, 0x13, 0xf5, 0x35, 0xba, 0x69, 0x6f, 0x36, 0xa0, 0xfe, 0xb9, 0x8f,
+    0x44, 0x00, 0x7f, 0xff, 0xa4, 0x60, 0xde, 0x42, 0xab, 0x55, 0xe6, 0x04, 0x1d, 0x6b, 0xdb, 0xbf,
+    0x5b, 0x4f, 0x7f, 0x5f, 0x08, 0xbd, 0xc3, 0x0a, 0x45, 0x91, 0x72, 0x53, 0x88, 0xa4, 0xe0, 0x10,
+    0x44, 0x00, 0x7f, 0xff, 0xa4, 0x60, 0xde, 0x42, 0xab, 0x55, 0xe6, 0x04, 0x1d, 0x6b, 0xdb, 0xbf,
+    0x1d, 0x6c, 0x64, 0xff, 0xc5, 0xa3, 0xaf, 0xf1, 0xba, 0x6b, 0xd1, 0xc6, 0xa6, 0x68, 0x92, 0x92,
+    0x46, 0x23, 0x1b, 0xa0, 0xcd, 0x1e, 0x6c, 0xfb, 0xff, 0xfa, 0xa3, 0x95, 0x2e, 0xcc, 0x72, 0x82,
+    0x1d, 0x6c, 0x64, 0xff, 0xc5, 0xa3, 0xaf, 0xf1, 0xba, 0x6b, 0xd1, 0xc6, 0xa6, 0x68, 0x92, 0x92,
+    0x32, 0x1f, 0x31, 0x27, 0xc4, 0x6d, 0xf1, 0x31, 0x25, 0xbe, 0xb2, 0x52, 0x31, 0xf3, 0x16, 0x59,
+    0x74, 0x3c, 0x2a, 0x87, 0x09, 0x73, 0x9d, 0xca, 0xda, 0x44, 0x11, 0xc7, 0x1f, 0x3f, 0x64, 0xdb,
+    0x32, 0x1f, 0x31, 0x27, 0xc4, 0x6d, 0xf1, 0x31, 0x25, 0xbe, 0xb2, 0x52, 0x31, 0xf3, 0x16, 0x59,
+    0x95, 0xb3, 0x2f, 0x8a, 0xbc, 0x58, 0xa7, 0xf3, 0x7a, 0x80, 0x9d, 0x49, 0x8d, 0x08, 0x32, 0x56,
+    0xe1, 0x8f, 0x05, 0x0d, 0xb5, 0x2b, 0x3a, 0x39, 0xa0, 0xc4, 0x8c, 0x8e, 0x92, 0x37, 0x56, 0x8d,
+    0x95, 0xb3, 0x2f, 0x8a, 0xbc, 0x58, 0xa7, 0xf3, 0x7a, 0x80, 0x9d, 0x49, 0x8d, 0x08, 0x32, 0x56,
+    0x33, 0x31, 0x00, 0xd7, 0x86, 0x7d, 0x96, 0xcc, 0x6e, 0x88, 0xec, 0xd4, 0xbb, 0x1e, 0xb6, 0x52,
+    0xd2, 0xbe, 0x05, 0xda, 0x33, 0x56, 0xac, 0xf5, 0xce, 0x4c, 0x60, 0x5a, 0x29, 0x29, 0xe0, 0xdf,
+    0x33, 0x31, 0x00, 0xd7, 0x86, 0x7d, 0x96, 0xcc, 0x6e, 0x88, 0xec, 0xd4, 0xbb, 0x1e, 0xb6, 0x52,
+    0x00, 0x27, 0xc0, 0x5b, 0x90, 0x91, 0x1d, 0x74, 0xb9, 0x33, 0x9f, 0x2f, 0xd8, 0x6b, 0xe2, 0xe1,
+    0xd2, 0x99, 0xc5, 0x81, 0xa3, 0xc7, 0xb1, 0x81, 0x77, 0x7f, 0xff, 0x75, 0xf1, 0x42, 0x02, 0x3e,
+    0x00, 0x27, 0xc0, 0x5b, 0x90, 0x91, 0x1d, 0x74, 0xb9, 0x33, 0x9f, 0x2f, 0xd8, 0x6b, 0xe2, 0xe1,
+    0x82, 0xc8, 0xbb, 0x7c, 0x65, 0x3a, 0xac, 0xac, 0xbe, 0x83, 0x0d, 0xc4, 0x45, 0xd5, 0x52, 0x8e,
+    0x50, 0x51, 0x7e, 0xfd, 0xc6, 0xfd, 0x1d, 0x2d, 0xc9, 0xfc, 0xf2, 0xb1, 0xb4, 0x97, 0x50, 0xb0,
+    0x82, 0xc8, 0xbb, 0x7c, 0x65, 0x3a, 0xac, 0xac, 0xbe, 0x83, 0x0d, 0xc4, 0x45, 0xd5, 0x52, 0x8e,
+    0x9d, 0x3f, 0xe7, 0x26, 0x38, 0x13, 0x0d, 0xf6, 0x09, 0x18, 0xa3, 0xa7, 0x2c, 0xa1, 0x71, 0xa3,
+    0xcd, 0x6e, 0x99, 0xdb, 0xfe, 0xee, 0x10, 0xdb, 0xc0, 0xe4, 0x51, 0x16, 0x98, 0x36, 0x21, 0x13,
+    0x9d, 0x3f, 0xe7, 0x26, 0x38, 0x13, 0x0d, 0xf6, 0x09, 0x18, 0xa3, 0xa7, 0x2c, 0xa1, 0x71, 0xa3,
+    0xe4, 0x4f, 0xe6, 0x0a, 0xde, 0xe9, 0x4f, 0x34, 0xf0, 0x78, 0xfa, 0x72, 0x32, 0xf4, 0xa8, 0xe8,
+    0x29, 0x21, 0x7f, 0xd1, 0x20, 0x07, 0x5f, 0xef, 0x30, 0x9c, 0xab, 0x64, 0xaa, 0xc2, 0x89, 0xfb,
+    0xe4, 0x4f, 0xe6, 0x0a, 0xde, 0xe9, 0x4f, 0x34, 0xf0, 0x78, 0xfa, 0x72, 0x32, 0xf4, 0xa8, 0xe8,
+    0x4f, 0xa1, 0x82, 0xac, 0xe4, 0x1b, 0xae, 0x0d, 0x6e, 0x56, 0x25, 0xf6, 0x01, 0x9e, 0x65, 0xbe,
+    0x66, 0x80, 0xfd, 0x7d, 0xc4, 0x1c, 0xf1, 0xe2, 0x5e, 0xca, 0x8e, 0x92, 0xab, 0x5c, 0xec, 0x45,
+    0x4f, 0xa1, 0x82, 0xac, 0xe4, 0x1b, 0xae, 0x0d, 0x6e, 0x56, 0x25, 0xf6, 0x01, 0x9e, 0x65, 0xbe,
+    0xac, 0x02, 0xbc, 0x4a, 0x90, 0xe7, 0xb1, 0x21, 0x8d, 0x4e, 0x9f, 0x06, 0x52, 0x57, 0x6e, 0x75,
+    0xca, 0x82, 0x41, 0x37, 0x54, 0xfb, 0x40, 0xc3, 0xd3, 0x84, 0x11, 0x94, 0xf9, 0x0b, 0x82, 0x30,
+    0xac, 0x02, 0xbc, 0x4a, 0x90, 0xe7, 0xb1, 0x21, 0x8d, 0x4e, 0x9f, 0x06, 0x52, 0x57, 0x6e, 0x75,
+    0xd5, 0xe1, 0x6b, 0xc0, 0x65, 0x6d, 0x3c, 0x47, 0xcf, 0xe7, 0xe2, 0x36, 0x94, 0x84, 0xc1, 0x0d,
+};
+
+static const unsigned char aes_mct_decrypt[AES_MCT_CHECKPOINTS * 48] =
+{
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0x75, 0x7e, 0xfb, 0x30, 0xad, 0x0d, 0x31, 0xc4, 0x31, 0x91, 0xd3, 0x0d, 0x42, 0x04, 0xb2,
+    0x0e, 0xdd, 0x33, 0xd3, 0xc6, 0x21, 0xe5, 0x46, 0x45, 0x5b, 0xd8, 0xba, 0x14, 0x18, 0xbe, 0xc8,
+    0x48, 0x75, 0x7e, 0xfb, 0x30, 0xad, 0x0d, 0x31, 0xc4, 0x31, 0x91, 0xd3, 0x0d, 0x42, 0x04, 0xb2,
+    0x3c, 0x7b, 0x56, 0xac, 0x49, 0x4d, 0xab, 0x34, 0x75, 0x03, 0xcf, 0xc1, 0x6f, 0x6f, 0xbd, 0x7e,
+    0xc8, 0x75, 0x7e, 0xfb, 0x30, 0xad, 0x0d, 0x31, 0xc4, 0x31, 0x91, 0xd3, 0x0d, 0x42, 0x04, 0xb2,
+    0x74, 0x0e, 0x28, 0x57, 0x79, 0xe0, 0xa6, 0x05, 0xb1, 0x32, 0x5e, 0x12, 0x62, 0x2d, 0xb9, 0xcc,
+    0x5a, 0x3b, 0x38, 0x0e, 0x25, 0x05, 0x4e, 0xe2, 0x5f, 0x87, 0x29, 0xce, 0xc8, 0xc5, 0x54, 0x94,
+    0x3c, 0x7b, 0x56, 0xac, 0x49, 0x4d, 0xab, 0x34, 0x75, 0x03, 0xcf, 0xc1, 0x6f, 0x6f, 0xbd, 0x7e,
+    0x2e, 0x35, 0x10, 0x59, 0x5c, 0xe5, 0xe8, 0xe7, 0xee, 0xb5, 0x77, 0xdc, 0xaa, 0xe8, 0xed, 0x58,
+    0x93, 0xa1, 0x30, 0x0e, 0x41, 0x19, 0xf9, 0x32, 0x78, 0x13, 0x50, 0x88, 0x2d, 0x5c, 0xb6, 0xd4,
+    0x5a, 0x3b, 0x38, 0x0e, 0x25, 0x05, 0x4e, 0xe2, 0x5f, 0x87, 0x29, 0xce, 0xc8, 0xc5, 0x54, 0x94,
+    0xbd, 0x94, 0x20, 0x57, 0x1d, 0xfc, 0x11, 0xd5, 0x96, 0xa6, 0x27, 0x54, 0x87, 0xb4, 0x5b, 0x8c,
+    0x85, 0x74, 0x6e, 0x24, 0xa3, 0xf7, 0x42, 0x86, 0xc5, 0xf9, 0x92, 0x24, 0x06, 0x68, 0x04, 0xa2,
+    0x93, 0xa1, 0x30, 0x0e, 0x41, 0x19, 0xf9, 0x32, 0x78, 0x13, 0x50, 0x88, 0x2d, 0x5c, 0xb6, 0xd4,
+    0x38, 0xe0, 0x4e, 0x73, 0xbe, 0x0b, 0x53, 0x53, 0x53, 0x5f, 0xb5, 0x70, 0x81, 0xdc, 0x5f, 0x2e,
+    0x85, 0x71, 0x91, 0xb5, 0x7c, 0x0f, 0xbe, 0xbd, 0x2b, 0x03, 0x5c, 0x94, 0x4c, 0xb4, 0x3d, 0xd7,
+    0x85, 0x74, 0x6e, 0x24, 0xa3, 0xf7, 0x42, 0x86, 0xc5, 0xf9, 0x92, 0x24, 0x06, 0x68, 0x04, 0xa2,
+    0xbd, 0x91, 0xdf, 0xc6, 0xc2, 0x04, 0xed, 0xee, 0x78, 0x5c, 0xe9, 0xe4, 0xcd, 0x68, 0x62, 0xf9,
+    0xb0, 0x95, 0x5f, 0x37, 0xbf, 0x94, 0x90, 0x55, 0xee, 0x50, 0x9f, 0x95, 0x43, 0x8f, 0x26, 0xf6,
+    0x85, 0x71, 0x91, 0xb5, 0x7c, 0x0f, 0xbe, 0xbd, 0x2b, 0x03, 0x5c, 0x94, 0x4c, 0xb4, 0x3d, 0xd7,
+    0x0d, 0x04, 0x80, 0xf1, 0x7d, 0x90, 0x7d, 0xbb, 0x96, 0x0c, 0x76, 0x71, 0x8e, 0xe7, 0x44, 0x0f,
+    0x63, 0x21, 0x00, 0x56, 0x5a, 0xff, 0x17, 0xa5, 0xe2, 0x24, 0x53, 0x98, 0x90, 0x6b, 0xb1, 0xc6,
+    0xb0, 0x95, 0x5f, 0x37, 0xbf, 0x94, 0x90, 0x55, 0xee, 0x50, 0x9f, 0x95, 0x43, 0x8f, 0x26, 0xf6,
+    0x6e, 0x25, 0x80, 0xa7, 0x27, 0x6f, 0x6a, 0x1e, 0x74, 0x28, 0x25, 0xe9, 0x1e, 0x8c, 0xf5, 0xc9,
+    0x69, 0xb3, 0x10, 0x72, 0xe0, 0x72, 0x05, 0xdb, 0xa5, 0x65, 0x36, 0x44, 0x5f, 0xe4, 0xf9, 0x97,
+    0x63, 0x21, 0x00, 0x56, 0x5a, 0xff, 0x17, 0xa5, 0xe2, 0x24, 0x53, 0x98, 0x90, 0x6b, 0xb1, 0xc6,
+    0x07, 0x96, 0x90, 0xd5, 0xc7, 0x1d, 0x6f, 0xc5, 0xd1, 0x4d, 0x13, 0xad, 0x41, 0x68, 0x0c, 0x5e,
+    0x8e, 0xd8, 0xd9, 0x00, 0x18, 0x92, 0x6d, 0x52, 0xe3, 0x19, 0x48, 0xe3, 0x90, 0xab, 0x8e, 0x8d,
+    0x69, 0xb3, 0x10, 0x72, 0xe0, 0x72, 0x05, 0xdb, 0xa5, 0x65, 0x36, 0x44, 0x5f, 0xe4, 0xf9, 0x97,
+    0x89, 0x4e, 0x49, 0xd5, 0xdf, 0x8f, 0x02, 0x97, 0x32, 0x54, 0x5b, 0x4e, 0xd1, 0xc3, 0x82, 0xd3,
+    0x9f, 0xc2, 0x58, 0x30, 0x87, 0x0b, 0x4e, 0x9e, 0xf6, 0x8a, 0xda, 0x2f, 0x66, 0xff, 0x90, 0x0d,
+    0x8e, 0xd8, 0xd9, 0x00, 0x18, 0x92, 0x6d, 0x52, 0xe3, 0x19, 0x48, 0xe3, 0x90, 0xab, 0x8e, 0x8d,
+    0x16, 0x8c, 0x11, 0xe5, 0x58, 0x84, 0x4c, 0x09, 0xc4, 0xde, 0x81, 0x61, 0xb7, 0x3c, 0x12, 0xde,
+    0xc6, 0xe9, 0x64, 0x56, 0x10, 0xcd, 0xb3, 0x3b, 0xc6, 0xf5, 0x87, 0x65, 0x54, 0x1b, 0xdd, 0x71,
+    0x9f, 0xc2, 0x58, 0x30, 0x87, 0x0b, 0x4e, 0x9e, 0xf6, 0x8a, 0xda, 0x2f, 0x66, 0xff, 0x90, 0x0d,
+    0xd0, 0x65, 0x75, 0xb3, 0x48, 0x49, 0xff, 0x32, 0x02, 0x2b, 0x06, 0x04, 0xe3, 0x27, 0xcf, 0xaf,
+    0x9d, 0xcc, 0xe1, 0xce, 0xab, 0x68, 0x41, 0x05, 0x96, 0xc1, 0xb7, 0xdf, 0x34, 0xdb, 0x33, 0xf7,
+    0xc6, 0xe9, 0x64, 0x56, 0x10, 0xcd, 0xb3, 0x3b, 0xc6, 0xf5, 0x87, 0x65, 0x54, 0x1b, 0xdd, 0x71,
+    0x4d, 0xa9, 0x94, 0x7d, 0xe3, 0x21, 0xbe, 0x37, 0x94, 0xea, 0xb1, 0xdb, 0xd7, 0xfc, 0xfc, 0x58,
+    0x8e, 0xbc, 0xe4, 0x9f, 0x68, 0x0c, 0x04, 0xbe, 0x2c, 0xa5, 0xe9, 0x70, 0x19, 0xe4, 0xf6, 0x6e,
+    0x9d, 0xcc, 0xe1, 0xce, 0xab, 0x68, 0x41, 0x05, 0x96, 0xc1, 0xb7, 0xdf, 0x34, 0xdb, 0x33, 0xf7,
+    0xc3, 0x15, 0x70, 0xe2, 0x8b, 0x2d, 0xba, 0x89, 0xb8, 0x4f, 0x58, 0xab, 0xce, 0x18, 0x0a, 0x36,
+    0x94, 0xf2, 0x3f, 0xa9, 0x31, 0x4b, 0x66, 0xd3, 0x91, 0x06, 0xbc, 0xa2, 0x2a, 0x96, 0x2e, 0x5c,
+    0x8e, 0xbc, 0xe4, 0x9f, 0x68, 0x0c, 0x04, 0xbe, 0x2c, 0xa5, 0xe9, 0x70, 0x19, 0xe4, 0xf6, 0x6e,
+    0x57, 0xe7, 0x4f, 0x4b, 0xba, 0x66, 0xdc, 0x5a, 0x29, 0x49, 0xe4, 0x09, 0xe4, 0x8e, 0x24, 0x6a,
+    0xa3, 0x6c, 0xaf, 0x66, 0x58, 0x4e, 0x99, 0x00, 0xb7, 0x6e, 0x1e, 0xde, 0x55, 0x52, 0x9d, 0x6a,
+    0x94, 0xf2, 0x3f, 0xa9, 0x31, 0x4b, 0x66, 0xd3, 0x91, 0x06, 0xbc, 0xa2, 0x2a, 0x96, 0x2e, 0x5c,
+    0xf4, 0x8b, 0xe0, 0x2d, 0xe2, 0x28, 0x45, 0x5a, 0x9e, 0x27, 0xfa, 0xd7, 0xb1, 0xdc, 0xb9, 0x00,
+    0xdb, 0x8f, 0x13, 0xe3, 0x85, 0xfd, 0x7e, 0xfe, 0x0c, 0x53, 0xe8, 0xd4, 0x93, 0xae, 0xf9, 0xba,
+    0xa3, 0x6c, 0xaf, 0x66, 0x58, 0x4e, 0x99, 0x00, 0xb7, 0x6e, 0x1e, 0xde, 0x55, 0x52, 0x9d, 0x6a,
+    0x2f, 0x04, 0xf3, 0xce, 0x67, 0xd5, 0x3b, 0xa4, 0x92, 0x74, 0x12, 0x03, 0x22, 0x72, 0x40, 0xba,
+    0x5a, 0xc4, 0x03, 0xc1, 0x57, 0x9d, 0x34, 0x43, 0xbb, 0xd5, 0x69, 0xdc, 0x7b, 0xeb, 0x48, 0x16,
+    0xdb, 0x8f, 0x13, 0xe3, 0x85, 0xfd, 0x7e, 0xfe, 0x0c, 0x53, 0xe8, 0xd4, 0x93, 0xae, 0xf9, 0xba,
+    0x75, 0xc0, 0xf0, 0x0f, 0x30, 0x48, 0x0f, 0xe7, 0x29, 0xa1, 0x7b, 0xdf, 0x59, 0x99, 0x08, 0xac,
+    0xcc, 0x96, 0x42, 0x48, 0xd2, 0xe0, 0xdc, 0xc2, 0xb4, 0xb6, 0x1a, 0x12, 0x22, 0x57, 0x81, 0xfd,
+    0x5a, 0xc4, 0x03, 0xc1, 0x57, 0x9d, 0x34, 0x43, 0xbb, 0xd5, 0x69, 0xdc, 0x7b, 0xeb, 0x48, 0x16,
+    0xb9, 0x56, 0xb2, 0x47, 0xe2, 0xa8, 0xd3, 0x25, 0x9d, 0x17, 0x61, 0xcd, 0x7b, 0xce, 0x89, 0x51,
+    0x2c, 0x87, 0x5d, 0x83, 0x23, 0x5a, 0xe9, 0x2c, 0x08, 0x28, 0xfc, 0x28, 0xce, 0x54, 0x79, 0xf3,
+    0xcc, 0x96, 0x42, 0x48, 0xd2, 0xe0, 0xdc, 0xc2, 0xb4, 0xb6, 0x1a, 0x12, 0x22, 0x57, 0x81, 0xfd,
+    0x95, 0xd1, 0xef, 0xc4, 0xc1, 0xf2, 0x3a, 0x09, 0x95, 0x3f, 0x9d, 0xe5, 0xb5, 0x9a, 0xf0, 0xa2,
+    0x08, 0x38, 0x5d, 0x7b, 0xfa, 0x99, 0xca, 0xe6, 0x7f, 0x93, 0xe6, 0xd7, 0x93, 0xa2, 0xbc, 0x8d,
+    0x2c, 0x87, 0x5d, 0x83, 0x23, 0x5a, 0xe9, 0x2c, 0x08, 0x28, 0xfc, 0x28, 0xce, 0x54, 0x79, 0xf3,
+    0x9d, 0xe9, 0xb2, 0xbf, 0x3b, 0x6b, 0xf0, 0xef, 0xea, 0xac, 0x7b, 0x32, 0x26, 0x38, 0x4c, 0x2f,
+    0x83, 0xf4, 0xc7, 0xf5, 0x18, 0x78, 0x4b, 0x33, 0x91, 0x5a, 0xbe, 0xb8, 0x05, 0x88, 0x50, 0xb3,
+    0x08, 0x38, 0x5d, 0x7b, 0xfa, 0x99, 0xca, 0xe6, 0x7f, 0x93, 0xe6, 0xd7, 0x93, 0xa2, 0xbc, 0x8d,
+    0x1e, 0x1d, 0x75, 0x4a, 0x23, 0x13, 0xbb, 0xdc, 0x7b, 0xf6, 0xc5, 0x8a, 0x23, 0xb0, 0x1c, 0x9c,
+    0x65, 0x20, 0x7c, 0xc1, 0xf8, 0x0d, 0x39, 0x38, 0x0c, 0xc9, 0x78, 0xb5, 0x96, 0xfb, 0xcd, 0xf0,
+    0x83, 0xf4, 0xc7, 0xf5, 0x18, 0x78, 0x4b, 0x33, 0x91, 0x5a, 0xbe, 0xb8, 0x05, 0x88, 0x50, 0xb3,
+    0x7b, 0x3d, 0x09, 0x8b, 0xdb, 0x1e, 0x82, 0xe4, 0x77, 0x3f, 0xbd, 0x3f, 0xb5, 0x4b, 0xd1, 0x6c,
+    0xe3, 0x7e, 0x33, 0x91, 0x7b, 0xe3, 0xb9, 0xcf, 0xe0, 0xfc, 0x2d, 0x6d, 0x21, 0x7a, 0x85, 0xe8,
+    0x65, 0x20, 0x7c, 0xc1, 0xf8, 0x0d, 0x39, 0x38, 0x0c, 0xc9, 0x78, 0xb5, 0x96, 0xfb, 0xcd, 0xf0,
+    0x98, 0x43, 0x3a, 0x1a, 0xa0, 0xfd, 0x3b, 0x2b, 0x97, 0xc3, 0x90, 0x52, 0x94, 0x31, 0x54, 0x84,
+    0x51, 0xd8, 0x93, 0xbd, 0x87, 0x13, 0x9d, 0xf4, 0xec, 0xdb, 0x68, 0x61, 0x5d, 0xd0, 0xcf, 0x69,
+    0xe3, 0x7e, 0x33, 0x91, 0x7b, 0xe3, 0xb9, 0xcf, 0xe0, 0xfc, 0x2d, 0x6d, 0x21, 0x7a, 0x85, 0xe8,
+    0xc9, 0x9b, 0xa9, 0xa7, 0x27, 0xee, 0xa6, 0xdf, 0x7b, 0x18, 0xf8, 0x33, 0xc9, 0xe1, 0x9b, 0xed,
+    0x9c, 0x67, 0xd4, 0xf8, 0xa4, 0xd8, 0x43, 0x43, 0x36, 0x8a, 0xf2, 0x67, 0x5c, 0x12, 0xbc, 0xe2,
+    0x51, 0xd8, 0x93, 0xbd, 0x87, 0x13, 0x9d, 0xf4, 0xec, 0xdb, 0x68, 0x61, 0x5d, 0xd0, 0xcf, 0x69,
+    0x55, 0xfc, 0x7d, 0x5f, 0x83, 0x36, 0xe5, 0x9c, 0x4d, 0x92, 0x0a, 0x54, 0x95, 0xf3, 0x27, 0x0f,
+    0x33, 0x05, 0x53, 0x88, 0x31, 0xab, 0x2f, 0xf6, 0xc2, 0x5f, 0x5c, 0x11, 0x6b, 0x73, 0xc1, 0xf7,
+    0x9c, 0x67, 0xd4, 0xf8, 0xa4, 0xd8, 0x43, 0x43, 0x36, 0x8a, 0xf2, 0x67, 0x5c, 0x12, 0xbc, 0xe2,
+    0x66, 0xf9, 0x2e, 0xd7, 0xb2, 0x9d, 0xca, 0x6a, 0x8f, 0xcd, 0x56, 0x45, 0xfe, 0x80, 0xe6, 0xf8,
+    0x84, 0xf6, 0x05, 0xd2, 0xe7, 0x83, 0x69, 0x7f, 0xde, 0x6d, 0xef, 0x66, 0xb7, 0x78, 0x89, 0x22,
+    0x33, 0x05, 0x53, 0x88, 0x31, 0xab, 0x2f, 0xf6, 0xc2, 0x5f, 0x5c, 0x11, 0x6b, 0x73, 0xc1, 0xf7,
+    0xe2, 0x0f, 0x2b, 0x05, 0x55, 0x1e, 0xa3, 0x15, 0x51, 0xa0, 0xb9, 0x23, 0x49, 0xf8, 0x6f, 0xda,
+    0x1b, 0x64, 0xf8, 0x49, 0x29, 0xb7, 0xae, 0x27, 0x35, 0x86, 0xb9, 0x55, 0x56, 0xbc, 0xae, 0x92,
+    0x84, 0xf6, 0x05, 0xd2, 0xe7, 0x83, 0x69, 0x7f, 0xde, 0x6d, 0xef, 0x66, 0xb7, 0x78, 0x89, 0x22,
+    0xf9, 0x6b, 0xd3, 0x4c, 0x7c, 0xa9, 0x0d, 0x32, 0x64, 0x26, 0x00, 0x76, 0x1f, 0x44, 0xc1, 0x48,
+    0x54, 0x9a, 0xab, 0x03, 0xa2, 0xe4, 0xc5, 0x94, 0x7e, 0x64, 0x5c, 0x3c, 0x58, 0xd6, 0x04, 0x99,
+    0x1b, 0x64, 0xf8, 0x49, 0x29, 0xb7, 0xae, 0x27, 0x35, 0x86, 0xb9, 0x55, 0x56, 0xbc, 0xae, 0x92,
+    0xad, 0xf1, 0x78, 0x4f, 0xde, 0x4d, 0xc8, 0xa6, 0x1a, 0x42, 0x5c, 0x4a, 0x47, 0x92, 0xc5, 0xd1,
+    0xd1, 0xac, 0x3e, 0xbf, 0xd0, 0x7f, 0x1d, 0x04, 0xe5, 0x02, 0x18, 0xfd, 0x3d, 0xb8, 0xee, 0xb1,
+    0x54, 0x9a, 0xab, 0x03, 0xa2, 0xe4, 0xc5, 0x94, 0x7e, 0x64, 0x5c, 0x3c, 0x58, 0xd6, 0x04, 0x99,
+    0x7c, 0x5d, 0x46, 0xf0, 0x0e, 0x32, 0xd5, 0xa2, 0xff, 0x40, 0x44, 0xb7, 0x7a, 0x2a, 0x2b, 0x60,
+    0xec, 0x17, 0xc8, 0x01, 0x62, 0x86, 0xc7, 0x3e, 0xb5, 0xb4, 0x12, 0xf8, 0xa6, 0xf2, 0xfb, 0x83,
+    0xd1, 0xac, 0x3e, 0xbf, 0xd0, 0x7f, 0x1d, 0x04, 0xe5, 0x02, 0x18, 0xfd, 0x3d, 0xb8, 0xee, 0xb1,
+    0x90, 0x4a, 0x8e, 0xf1, 0x6c, 0xb4, 0x12, 0x9c, 0x4a, 0xf4, 0x56, 0x4f, 0xdc, 0xd8, 0xd0, 0xe3,
+    0xc2, 0x6c, 0x54, 0x18, 0x5b, 0xb3, 0x56, 0xd7, 0xfe, 0xff, 0x06, 0x5b, 0xf8, 0xd5, 0xd1, 0xa0,
+    0xec, 0x17, 0xc8, 0x01, 0x62, 0x86, 0xc7, 0x3e, 0xb5, 0xb4, 0x12, 0xf8, 0xa6, 0xf2, 0xfb, 0x83,
+    0x52, 0x26, 0xda, 0xe9, 0x37, 0x07, 0x44, 0x4b, 0xb4, 0x0b, 0x50, 0x14, 0x24, 0x0d, 0x01, 0x43,
+    0x9b, 0x57, 0xbc, 0x83, 0xf8, 0xa7, 0x26, 0xad, 0x5c, 0x68, 0x0f, 0xfc, 0x2d, 0xb7, 0xb5, 0x92,
+    0xc2, 0x6c, 0x54, 0x18, 0x5b, 0xb3, 0x56, 0xd7, 0xfe, 0xff, 0x06, 0x5b, 0xf8, 0xd5, 0xd1, 0xa0,
+    0xc9, 0x71, 0x66, 0x6a, 0xcf, 0xa0, 0x62, 0xe6, 0xe8, 0x63, 0x5f, 0xe8, 0x09, 0xba, 0xb4, 0xd1,
+    0xe5, 0xe5, 0xae, 0xcc, 0x3f, 0x64, 0x87, 0x07, 0x18, 0x92, 0x06, 0xed, 0xd7, 0xc9, 0xba, 0x54,
+    0x9b, 0x57, 0xbc, 0x83, 0xf8, 0xa7, 0x26, 0xad, 0x5c, 0x68, 0x0f, 0xfc, 0x2d, 0xb7, 0xb5, 0x92,
+    0x2c, 0x94, 0xc8, 0xa6, 0xf0, 0xc4, 0xe5, 0xe1, 0xf0, 0xf1, 0x59, 0x05, 0xde, 0x73, 0x0e, 0x85,
+    0xdb, 0x75, 0x57, 0x3a, 0x3f, 0x9a, 0xc8, 0x58, 0xfd, 0xdf, 0x77, 0xca, 0x33, 0xb4, 0x91, 0xbe,
+    0xe5, 0xe5, 0xae, 0xcc, 0x3f, 0x64, 0x87, 0x07, 0x18, 0x92, 0x06, 0xed, 0xd7, 0xc9, 0xba, 0x54,
+    0xf7, 0xe1, 0x9f, 0x9c, 0xcf, 0x5e, 0x2d, 0xb9, 0x0d, 0x2e, 0x2e, 0xcf, 0xed, 0xc7, 0x9f, 0x3b,
+    0xd7, 0x5c, 0x2c, 0x0c, 0x0e, 0x2d, 0x12, 0x3a, 0x44, 0x2b, 0x91, 0x6f, 0x99, 0x04, 0x5b, 0xc0,
+    0xdb, 0x75, 0x57, 0x3a, 0x3f, 0x9a, 0xc8, 0x58, 0xfd, 0xdf, 0x77, 0xca, 0x33, 0xb4, 0x91, 0xbe,
+    0x20, 0xbd, 0xb3, 0x90, 0xc1, 0x73, 0x3f, 0x83, 0x49, 0x05, 0xbf, 0xa0, 0x74, 0xc3, 0xc4, 0xfb,
+    0x00, 0x22, 0x34, 0x23, 0x08, 0x9b, 0x00, 0xd6, 0x78, 0xac, 0xb6, 0x75, 0x76, 0x36, 0x71, 0x54,
+    0xd7, 0x5c, 0x2c, 0x0c, 0x0e, 0x2d, 0x12, 0x3a, 0x44, 0x2b, 0x91, 0x6f, 0x99, 0x04, 0x5b, 0xc0,
+    0x20, 0x9f, 0x87, 0xb3, 0xc9, 0xe8, 0x3f, 0x55, 0x31, 0xa9, 0x09, 0xd5, 0x02, 0xf5, 0xb5, 0xaf,
+    0x8e, 0x74, 0x3a, 0x95, 0xed, 0x84, 0x39, 0xdd, 0xf4, 0x55, 0x61, 0xc2, 0x9f, 0xa4, 0xc6, 0x81,
+    0x00, 0x22, 0x34, 0x23, 0x08, 0x9b, 0x00, 0xd6, 0x78, 0xac, 0xb6, 0x75, 0x76, 0x36, 0x71, 0x54,
+    0xae, 0xeb, 0xbd, 0x26, 0x24, 0x6c, 0x06, 0x88, 0xc5, 0xfc, 0x68, 0x17, 0x9d, 0x51, 0x73, 0x2e,
+    0xcf, 0xb8, 0x87, 0x10, 0x64, 0x21, 0xea, 0x3e, 0x4a, 0x6e, 0xf7, 0xc9, 0x3a, 0xc7, 0xd3, 0x0f,
+    0x8e, 0x74, 0x3a, 0x95, 0xed, 0x84, 0x39, 0xdd, 0xf4, 0x55, 0x61, 0xc2, 0x9f, 0xa4, 0xc6, 0x81,
+    0x61, 0x53, 0x3a, 0x36, 0x40, 0x4d, 0xec, 0xb6, 0x8f, 0x92, 0x9f, 0xde, 0xa7, 0x96, 0xa0, 0x21,
+    0xfa, 0x05, 0x8f, 0x60, 0xf8, 0xe0, 0x9e, 0x54, 0x89, 0x2e, 0xa1, 0xfe, 0x6f, 0xaa, 0xd3, 0x68,
+    0xcf, 0xb8, 0x87, 0x10, 0x64, 0x21, 0xea, 0x3e, 0x4a, 0x6e, 0xf7, 0xc9, 0x3a, 0xc7, 0xd3, 0x0f,
+    0x9b, 0x56, 0xb5, 0x56, 0xb8, 0xad, 0x72, 0xe2, 0x06, 0xbc, 0x3e, 0x20, 0xc8, 0x3c, 0x73, 0x49,
+    0x03, 0x54, 0x58, 0x24, 0x7a, 0xfa, 0x0e, 0x1d, 0xcf, 0xa9, 0xff, 0xdd, 0xff, 0xa2, 0x69, 0x7a,
+    0xfa, 0x05, 0x8f, 0x60, 0xf8, 0xe0, 0x9e, 0x54, 0x89, 0x2e, 0xa1, 0xfe, 0x6f, 0xaa, 0xd3, 0x68,
+    0x98, 0x02, 0xed, 0x72, 0xc2, 0x57, 0x7c, 0xff, 0xc9, 0x15, 0xc1, 0xfd, 0x37, 0x9e, 0x1a, 0x33,
+    0xb2, 0x4b, 0xa3, 0xe3, 0x70, 0x15, 0xee, 0x49, 0x51, 0xce, 0xcd, 0x9b, 0x0d, 0x50, 0x3b, 0x37,
+    0x03, 0x54, 0x58, 0x24, 0x7a, 0xfa, 0x0e, 0x1d, 0xcf, 0xa9, 0xff, 0xdd, 0xff, 0xa2, 0x69, 0x7a,
+    0x2a, 0x49, 0x4e, 0x91, 0xb2, 0x42, 0x92, 0xb6, 0x98, 0xdb, 0x0c, 0x66, 0x3a, 0xce, 0x21, 0x04,
+    0x39, 0xba, 0xe0, 0x27, 0x5e, 0xb3, 0x7f, 0xec, 0x12, 0x69, 0x3d, 0xaa, 0x24, 0x31, 0x3a, 0x16,
+    0xb2, 0x4b, 0xa3, 0xe3, 0x70, 0x15, 0xee, 0x49, 0x51, 0xce, 0xcd, 0x9b, 0x0d, 0x50, 0x3b, 0x37,
+    0x13, 0xf3, 0xae, 0xb6, 0xec, 0xf1, 0xed, 0x5a, 0x8a, 0xb2, 0x31, 0xcc, 0x1e, 0xff, 0x1b, 0x12,
+    0xde, 0x6d, 0xd5, 0x38, 0xca, 0x70, 0x42, 0x26, 0x13, 0x25, 0x54, 0xfd, 0x8f, 0x64, 0xe1, 0xec,
+    0x39, 0xba, 0xe0, 0x27, 0x5e, 0xb3, 0x7f, 0xec, 0x12, 0x69, 0x3d, 0xaa, 0x24, 0x31, 0x3a, 0x16,
+    0xcd, 0x9e, 0x7b, 0x8e, 0x26, 0x81, 0xaf, 0x7c, 0x99, 0x97, 0x65, 0x31, 0x91, 0x9b, 0xfa, 0xfe,
+    0x09, 0x14, 0xbb, 0xc2, 0x47, 0x76, 0xa1, 0x0c, 0x59, 0xe2, 0xf4, 0xe2, 0x27, 0x3a, 0x8d, 0x0f,
+    0xde, 0x6d, 0xd5, 0x38, 0xca, 0x70, 0x42, 0x26, 0x13, 0x25, 0x54, 0xfd, 0x8f, 0x64, 0xe1, 0xec,
+    0xc4, 0x8a, 0xc0, 0x4c, 0x61, 0xf7, 0x0e, 0x70, 0xc0, 0x75, 0x91, 0xd3, 0xb6, 0xa1, 0x77, 0xf1,
+    0x15, 0xaa, 0x5b, 0x6c, 0xee, 0xb3, 0xbf, 0xb8, 0xd6, 0xd3, 0x93, 0x77, 0x82, 0xa3, 0xf0, 0x0f,
+    0x09, 0x14, 0xbb, 0xc2, 0x47, 0x76, 0xa1, 0x0c, 0x59, 0xe2, 0xf4, 0xe2, 0x27, 0x3a, 0x8d, 0x0f,
+    0xd1, 0x20, 0x9b, 0x20, 0x8f, 0x44, 0xb1, 0xc8, 0x16, 0xa6, 0x02, 0xa4, 0x34, 0x02, 0x87, 0xfe,
+    0xd9, 0xc7, 0x7d, 0x1b, 0x1c, 0x0a, 0x02, 0x16, 0x01, 0xd5, 0x7c, 0xc4, 0x7a, 0xb7, 0x38, 0xad,
+    0x15, 0xaa, 0x5b, 0x6c, 0xee, 0xb3, 0xbf, 0xb8, 0xd6, 0xd3, 0x93, 0x77, 0x82, 0xa3, 0xf0, 0x0f,
+    0x08, 0xe7, 0xe6, 0x3b, 0x93, 0x4e, 0xb3, 0xde, 0x17, 0x73, 0x7e, 0x60, 0x4e, 0xb5, 0xbf, 0x53,
+    0xed, 0x47, 0xaf, 0x11, 0xaf, 0x6e, 0x6d, 0xf5, 0x6a, 0x12, 0x56, 0x8f, 0x92, 0x1a, 0x16, 0x68,
+    0xd9, 0xc7, 0x7d, 0x1b, 0x1c, 0x0a, 0x02, 0x16, 0x01, 0xd5, 0x7c, 0xc4, 0x7a, 0xb7, 0x38, 0xad,
+    0xe5, 0xa0, 0x49, 0x2a, 0x3c, 0x20, 0xde, 0x2b, 0x7d, 0x61, 0x28, 0xef, 0xdc, 0xaf, 0xa9, 0x3b,
+    0x08, 0xfa, 0x13, 0x7e, 0xd5, 0x5b, 0x45, 0x4d, 0xff, 0x2a, 0xde, 0x56, 0xe2, 0x65, 0x3d, 0x75,
+    0xed, 0x47, 0xaf, 0x11, 0xaf, 0x6e, 0x6d, 0xf5, 0x6a, 0x12, 0x56, 0x8f, 0x92, 0x1a, 0x16, 0x68,
+    0xed, 0x5a, 0x5a, 0x54, 0xe9, 0x7b, 0x9b, 0x66, 0x82, 0x4b, 0xf6, 0xb9, 0x3e, 0xca, 0x94, 0x4e,
+    0x0a, 0x20, 0xda, 0x89, 0xa4, 0x57, 0x3c, 0xa0, 0x39, 0xb5, 0x29, 0x18, 0xc8, 0xde, 0xbe, 0x48,
+    0x08, 0xfa, 0x13, 0x7e, 0xd5, 0x5b, 0x45, 0x4d, 0xff, 0x2a, 0xde, 0x56, 0xe2, 0x65, 0x3d, 0x75,
+    0xe7, 0x7a, 0x80, 0xdd, 0x4d, 0x2c, 0xa7, 0xc6, 0xbb, 0xfe, 0xdf, 0xa1, 0xf6, 0x14, 0x2a, 0x06,
+    0x54, 0x76, 0x8a, 0xc5, 0x01, 0x3c, 0x63, 0xbb, 0xc7, 0x22, 0x3f, 0x4c, 0x01, 0xed, 0xd6, 0x67,
+    0x0a, 0x20, 0xda, 0x89, 0xa4, 0x57, 0x3c, 0xa0, 0x39, 0xb5, 0x29, 0x18, 0xc8, 0xde, 0xbe, 0x48,
+    0xb3, 0x0c, 0x0a, 0x18, 0x4c, 0x10, 0xc4, 0x7d, 0x7c, 0xdc, 0xe0, 0xed, 0xf7, 0xf9, 0xfc, 0x61,
+    0xaa, 0x4a, 0xb6, 0x6d, 0xf8, 0xef, 0x74, 0xde, 0xbb, 0x3c, 0xac, 0xd8, 0xa4, 0x1c, 0xe6, 0xfd,
+    0x54, 0x76, 0x8a, 0xc5, 0x01, 0x3c, 0x63, 0xbb, 0xc7, 0x22, 0x3f, 0x4c, 0x01, 0xed, 0xd6, 0x67,
+    0x19, 0x46, 0xbc, 0x75, 0xb4, 0xff, 0xb0, 0xa3, 0xc7, 0xe0, 0x4c, 0x35, 0x53, 0xe5, 0x1a, 0x9c,
+    0xb5, 0xef, 0x67, 0xd4, 0x87, 0x70, 0xed, 0xbe, 0x81, 0x71, 0x12, 0x06, 0x05, 0x99, 0xb2, 0xbb,
+    0xaa, 0x4a, 0xb6, 0x6d, 0xf8, 0xef, 0x74, 0xde, 0xbb, 0x3c, 0xac, 0xd8, 0xa4, 0x1c, 0xe6, 0xfd,
+    0xac, 0xa9, 0xdb, 0xa1, 0x33, 0x8f, 0x5d, 0x1d, 0x46, 0x91, 0x5e, 0x33, 0x56, 0x7c, 0xa8, 0x27,
+    0x94, 0x9b, 0xc0, 0x89, 0x3d, 0x0b, 0xa9, 0x81, 0xd3, 0x23, 0xcc, 0xd8, 0x37, 0x92, 0x22, 0xf5,
+    0xb5, 0xef, 0x67, 0xd4, 0x87, 0x70, 0xed, 0xbe, 0x81, 0x71, 0x12, 0x06, 0x05, 0x99, 0xb2, 0xbb,
+    0x38, 0x32, 0x1b, 0x28, 0x0e, 0x84, 0xf4, 0x9c, 0x95, 0xb2, 0x92, 0xeb, 0x61, 0xee, 0x8a, 0xd2,
+    0xab, 0x69, 0x57, 0xb2, 0x8f, 0xea, 0xf4, 0xe7, 0xdc, 0x9f, 0xd9, 0xe5, 0x71, 0xff, 0x3c, 0xa1,
+    0x94, 0x9b, 0xc0, 0x89, 0x3d, 0x0b, 0xa9, 0x81, 0xd3, 0x23, 0xcc, 0xd8, 0x37, 0x92, 0x22, 0xf5,
+    0x93, 0x5b, 0x4c, 0x9a, 0x81, 0x6e, 0x00, 0x7b, 0x49, 0x2d, 0x4b, 0x0e, 0x10, 0x11, 0xb6, 0x73,
+    0x0a, 0xdf, 0x0e, 0x20, 0x99, 0x28, 0x41, 0x4f, 0x4d, 0xca, 0xd0, 0x34, 0xa1, 0xd1, 0xf4, 0xd4,
+    0xab, 0x69, 0x57, 0xb2, 0x8f, 0xea, 0xf4, 0xe7, 0xdc, 0x9f, 0xd9, 0xe5, 0x71, 0xff, 0x3c, 0xa1,
+    0x99, 0x84, 0x42, 0xba, 0x18, 0x46, 0x41, 0x34, 0x04, 0xe7, 0x9b, 0x3a, 0xb1, 0xc0, 0x42, 0xa7,
+    0xd9, 0x35, 0xc3, 0x24, 0xcd, 0x23, 0x96, 0xc0, 0xad, 0xd3, 0x7d, 0x81, 0x4f, 0xd1, 0x29, 0xaf,
+    0x0a, 0xdf, 0x0e, 0x20, 0x99, 0x28, 0x41, 0x4f, 0x4d, 0xca, 0xd0, 0x34, 0xa1, 0xd1, 0xf4, 0xd4,
+    0x40, 0xb1, 0x81, 0x9e, 0xd5, 0x65, 0xd7, 0xf4, 0xa9, 0x34, 0xe6, 0xbb, 0xfe, 0x11, 0x6b, 0x08,
+    0xca, 0x9a, 0x7d, 0x11, 0x77, 0xf8, 0x60, 0xfa, 0x3f, 0xba, 0x8a, 0x19, 0xb5, 0x59, 0xab, 0xe4,
+    0xd9, 0x35, 0xc3, 0x24, 0xcd, 0x23, 0x96, 0xc0, 0xad, 0xd3, 0x7d, 0x81, 0x4f, 0xd1, 0x29, 0xaf,
+    0x8a, 0x2b, 0xfc, 0x8f, 0xa2, 0x9d, 0xb7, 0x0e, 0x96, 0x8e, 0x6c, 0xa2, 0x4b, 0x48, 0xc0, 0xec,
+    0xf8, 0x65, 0x4b, 0x4f, 0xca, 0x95, 0xed, 0x41, 0xda, 0xed, 0x78, 0x19, 0x28, 0x6b, 0xec, 0x38,
+    0xca, 0x9a, 0x7d, 0x11, 0x77, 0xf8, 0x60, 0xfa, 0x3f, 0xba, 0x8a, 0x19, 0xb5, 0x59, 0xab, 0xe4,
+    0x72, 0x4e, 0xb7, 0xc0, 0x68, 0x08, 0x5a, 0x4f, 0x4c, 0x63, 0x14, 0xbb, 0x63, 0x23, 0x2c, 0xd4,
+    0x77, 0xe5, 0xf8, 0xb1, 0x41, 0x0a, 0xc2, 0xe4, 0x66, 0x9b, 0x60, 0x22, 0xdd, 0x08, 0xf6, 0xb2,
+    0xf8, 0x65, 0x4b, 0x4f, 0xca, 0x95, 0xed, 0x41, 0xda, 0xed, 0x78, 0x19, 0x28, 0x6b, 0xec, 0x38,
+    0x05, 0xab, 0x4f, 0x71, 0x29, 0x02, 0x98, 0xab, 0x2a, 0xf8, 0x74, 0x99, 0xbe, 0x2b, 0xda, 0x66,
+    0x9e, 0x8c, 0x10, 0x26, 0x4b, 0x08, 0xcd, 0xdf, 0xbf, 0xfb, 0x45, 0xa0, 0xc0, 0x0a, 0x82, 0x4a,
+    0x77, 0xe5, 0xf8, 0xb1, 0x41, 0x0a, 0xc2, 0xe4, 0x66, 0x9b, 0x60, 0x22, 0xdd, 0x08, 0xf6, 0xb2,
+    0x9b, 0x27, 0x5f, 0x57, 0x62, 0x0a, 0x55, 0x74, 0x95, 0x03, 0x31, 0x39, 0x7e, 0x21, 0x58, 0x2c,
+    0x59, 0xba, 0x53, 0xc6, 0x1d, 0x81, 0x06, 0x4c, 0x02, 0x88, 0x64, 0xcb, 0xcc, 0x2c, 0x3c, 0xab,
+    0x9e, 0x8c, 0x10, 0x26, 0x4b, 0x08, 0xcd, 0xdf, 0xbf, 0xfb, 0x45, 0xa0, 0xc0, 0x0a, 0x82, 0x4a,
+    0xc2, 0x9d, 0x0c, 0x91, 0x7f, 0x8b, 0x53, 0x38, 0x97, 0x8b, 0x55, 0xf2, 0xb2, 0x0d, 0x64, 0x87,
+    0x5c, 0xdf, 0x39, 0xbf, 0x6f, 0x73, 0x31, 0x3e, 0x56, 0xc0, 0x30, 0x1d, 0xb0, 0x4b, 0xf2, 0xf1,
+    0x59, 0xba, 0x53, 0xc6, 0x1d, 0x81, 0x06, 0x4c, 0x02, 0x88, 0x64, 0xcb, 0xcc, 0x2c, 0x3c, 0xab,
+    0x9e, 0x42, 0x35, 0x2e, 0x10, 0xf8, 0x62, 0x06, 0xc1, 0x4b, 0x65, 0xef, 0x02, 0x46, 0x96, 0x76,
+    0x6c, 0xaf, 0xe3, 0x45, 0xa8, 0x63, 0x45, 0xfe, 0x2a, 0xff, 0x73, 0xa9, 0x5e, 0x47, 0xe6, 0xe3,
+    0x5c, 0xdf, 0x39, 0xbf, 0x6f, 0x73, 0x31, 0x3e, 0x56, 0xc0, 0x30, 0x1d, 0xb0, 0x4b, 0xf2, 0xf1,
+    0xf2, 0xed, 0xd6, 0x6b, 0xb8, 0x9b, 0x27, 0xf8, 0xeb, 0xb4, 0x16, 0x46, 0x5c, 0x01, 0x70, 0x95,
+    0x75, 0x57, 0x18, 0x8b, 0xe0, 0x85, 0x89, 0xa4, 0x74, 0xb8, 0x07, 0x41, 0xa9, 0x8d, 0x27, 0xdf,
+    0x6c, 0xaf, 0xe3, 0x45, 0xa8, 0x63, 0x45, 0xfe, 0x2a, 0xff, 0x73, 0xa9, 0x5e, 0x47, 0xe6, 0xe3,
+    0x87, 0xba, 0xce, 0xe0, 0x58, 0x1e, 0xae, 0x5c, 0x9f, 0x0c, 0x11, 0x07, 0xf5, 0x8c, 0x57, 0x4a,
+    0x62, 0xa4, 0x3c, 0x82, 0x7d, 0x9d, 0x11, 0x94, 0x42, 0x19, 0xab, 0xe9, 0xd1, 0xd4, 0xb9, 0x9c,
+    0x75, 0x57, 0x18, 0x8b, 0xe0, 0x85, 0x89, 0xa4, 0x74, 0xb8, 0x07, 0x41, 0xa9, 0x8d, 0x27, 0xdf,
+    0xe5, 0x1e, 0xf2, 0x62, 0x25, 0x83, 0xbf, 0xc8, 0xdd, 0x15, 0xba, 0xee, 0x24, 0x58, 0xee, 0xd6,
+    0x9e, 0xaa, 0xe6, 0xd1, 0xb7, 0xce, 0xc7, 0x88, 0x19, 0xb1, 0xa7, 0x4c, 0x62, 0x20, 0x23, 0xa5,
+    0x62, 0xa4, 0x3c, 0x82, 0x7d, 0x9d, 0x11, 0x94, 0x42, 0x19, 0xab, 0xe9, 0xd1, 0xd4, 0xb9, 0x9c,
+    0x7b, 0xb4, 0x14, 0xb3, 0x92, 0x4d, 0x78, 0x40, 0xc4, 0xa4, 0x1d, 0xa2, 0x46, 0x78, 0xcd, 0x73,
+    0x95, 0x11, 0x18, 0x82, 0x61, 0xbb, 0x24, 0x03, 0xfa, 0x61, 0x0a, 0x96, 0x43, 0xcb, 0x04, 0x0f,
+    0x9e, 0xaa, 0xe6, 0xd1, 0xb7, 0xce, 0xc7, 0x88, 0x19, 0xb1, 0xa7, 0x4c, 0x62, 0x20, 0x23, 0xa5,
+    0xee, 0xa5, 0x0c, 0x31, 0xf3, 0xf6, 0x5c, 0x43, 0x3e, 0xc5, 0x17, 0x34, 0x05, 0xb3, 0xc9, 0x7c,
+    0x4d, 0x63, 0xf9, 0x71, 0x00, 0x04, 0x16, 0x9e, 0x33, 0xa0, 0xbf, 0xbe, 0x1d, 0x59, 0x98, 0x81,
+    0x95, 0x11, 0x18, 0x82, 0x61, 0xbb, 0x24, 0x03, 0xfa, 0x61, 0x0a, 0x96, 0x43, 0xcb, 0x04, 0x0f,
+    0xa3, 0xc6, 0xf5, 0x40, 0xf3, 0xf2, 0x4a, 0xdd, 0x0d, 0x65, 0xa8, 0x8a, 0x18, 0xea, 0x51, 0xfd,
+    0x03, 0xb3, 0x28, 0x5d, 0x33, 0xc8, 0x43, 0x25, 0x44, 0x70, 0xfd, 0x15, 0x0b, 0x87, 0x46, 0x18,
+    0x4d, 0x63, 0xf9, 0x71, 0x00, 0x04, 0x16, 0x9e, 0x33, 0xa0, 0xbf, 0xbe, 0x1d, 0x59, 0x98, 0x81,
+    0xa0, 0x75, 0xdd, 0x1d, 0xc0, 0x3a, 0x09, 0xf8, 0x49, 0x15, 0x55, 0x9f, 0x13, 0x6d, 0x17, 0xe5,
+    0xe7, 0x25, 0x86, 0x70, 0xa4, 0xd3, 0x4d, 0xa5, 0xa7, 0xfb, 0xec, 0x14, 0xfb, 0x52, 0x02, 0xeb,
+    0x03, 0xb3, 0x28, 0x5d, 0x33, 0xc8, 0x43, 0x25, 0x44, 0x70, 0xfd, 0x15, 0x0b, 0x87, 0x46, 0x18,
+    0x47, 0x50, 0x5b, 0x6d, 0x64, 0xe9, 0x44, 0x5d, 0xee, 0xee, 0xb9, 0x8b, 0xe8, 0x3f, 0x15, 0x0e,
+    0x8d, 0x03, 0xef, 0xd2, 0x72, 0x64, 0xd5, 0xee, 0x05, 0x97, 0x46, 0x20, 0x4f, 0x1f, 0x4e, 0xb9,
+    0xe7, 0x25, 0x86, 0x70, 0xa4, 0xd3, 0x4d, 0xa5, 0xa7, 0xfb, 0xec, 0x14, 0xfb, 0x52, 0x02, 0xeb,
+    0xca, 0x53, 0xb4, 0xbf, 0x16, 0x8d, 0x91, 0xb3, 0xeb, 0x79, 0xff, 0xab, 0xa7, 0x20, 0x5b, 0xb7,
+    0xe3, 0x6d, 0xc4, 0x14, 0xbf, 0xa2, 0x66, 0x2d, 0x94, 0xf7, 0x10, 0x4e, 0x36, 0xbf, 0xd7, 0x3f,
+    0x8d, 0x03, 0xef, 0xd2, 0x72, 0x64, 0xd5, 0xee, 0x05, 0x97, 0x46, 0x20, 0x4f, 0x1f, 0x4e, 0xb9,
+    0x29, 0x3e, 0x70, 0xab, 0xa9, 0x2f, 0xf7, 0x9e, 0x7f, 0x8e, 0xef, 0xe5, 0x91, 0x9f, 0x8c, 0x88,
+    0xf0, 0x12, 0x53, 0xca, 0x3e, 0x25, 0xc5, 0xcb, 0x8d, 0x8b, 0xb6, 0xe5, 0x26, 0xca, 0x15, 0x51,
+    0xe3, 0x6d, 0xc4, 0x14, 0xbf, 0xa2, 0x66, 0x2d, 0x94, 0xf7, 0x10, 0x4e, 0x36, 0xbf, 0xd7, 0x3f,
+    0xd9, 0x2c, 0x23, 0x61, 0x97, 0x0a, 0x32, 0x55, 0xf2, 0x05, 0x59, 0x00, 0xb7, 0x55, 0x99, 0xd9,
+    0x47, 0x5c, 0x39, 0xbf, 0x81, 0x04, 0xa3, 0xb4, 0x67, 0xc9, 0x2f, 0x64, 0x39, 0x1e, 0x1f, 0x0c,
+    0xf0, 0x12, 0x53, 0xca, 0x3e, 0x25, 0xc5, 0xcb, 0x8d, 0x8b, 0xb6, 0xe5, 0x26, 0xca, 0x15, 0x51,
+    0x9e, 0x70, 0x1a, 0xde, 0x16, 0x0e, 0x91, 0xe1, 0x95, 0xcc, 0x76, 0x64, 0x8e, 0x4b, 0x86, 0xd5,
+    0x69, 0x4a, 0x8a, 0xb8, 0x81, 0x1c, 0x20, 0x7b, 0x0b, 0x05, 0xa7, 0xa3, 0xd1, 0xce, 0x18, 0x33,
+    0x47, 0x5c, 0x39, 0xbf, 0x81, 0x04, 0xa3, 0xb4, 0x67, 0xc9, 0x2f, 0x64, 0x39, 0x1e, 0x1f, 0x0c,
+    0xf7, 0x3a, 0x90, 0x66, 0x97, 0x12, 0xb1, 0x9a, 0x9e, 0xc9, 0xd1, 0xc7, 0x5f, 0x85, 0x9e, 0xe6,
+    0x09, 0x3b, 0x7a, 0x1e, 0x71, 0x6c, 0x69, 0xae, 0xe2, 0x24, 0xd9, 0xf5, 0x66, 0x4c, 0xfd, 0x45,
+    0x69, 0x4a, 0x8a, 0xb8, 0x81, 0x1c, 0x20, 0x7b, 0x0b, 0x05, 0xa7, 0xa3, 0xd1, 0xce, 0x18, 0x33,
+    0xfe, 0x01, 0xea, 0x78, 0xe6, 0x7e, 0xd8, 0x34, 0x7c, 0xed, 0x08, 0x32, 0x39, 0xc9, 0x63, 0xa3,
+    0xe4, 0x83, 0x3d, 0xa8, 0xb6, 0xfe, 0x31, 0x19, 0x2d, 0xd2, 0xab, 0x9e, 0xdf, 0x57, 0x7c, 0x2b,
+    0x09, 0x3b, 0x7a, 0x1e, 0x71, 0x6c, 0x69, 0xae, 0xe2, 0x24, 0xd9, 0xf5, 0x66, 0x4c, 0xfd, 0x45,
+    0x1a, 0x82, 0xd7, 0xd0, 0x50, 0x80, 0xe9, 0x2d, 0x51, 0x3f, 0xa3, 0xac, 0xe6, 0x9e, 0x1f, 0x88,
+    0x45, 0xd4, 0xfd, 0xca, 0x66, 0x87, 0xc1, 0x5d, 0xf1, 0x74, 0x8d, 0xcf, 0xa6, 0xbd, 0xdb, 0x8a,
+    0xe4, 0x83, 0x3d, 0xa8, 0xb6, 0xfe, 0x31, 0x19, 0x2d, 0xd2, 0xab, 0x9e, 0xdf, 0x57, 0x7c, 0x2b,
+    0x5f, 0x56, 0x2a, 0x1a, 0x36, 0x07, 0x28, 0x70, 0xa0, 0x4b, 0x2e, 0x63, 0x40, 0x23, 0xc4, 0x02,
+    0x49, 0xe5, 0x46, 0x78, 0xa6, 0x50, 0x72, 0x82, 0x24, 0xa6, 0xeb, 0x0c, 0x76, 0xec, 0x72, 0xa0,
+    0x45, 0xd4, 0xfd, 0xca, 0x66, 0x87, 0xc1, 0x5d, 0xf1, 0x74, 0x8d, 0xcf, 0xa6, 0xbd, 0xdb, 0x8a,
+    0x16, 0xb3, 0x6c, 0x62, 0x90, 0x57, 0x5a, 0xf2, 0x84, 0xed, 0xc5, 0x6f, 0x36, 0xcf, 0xb6, 0xa2,
+    0xaf, 0x90, 0x27, 0x49, 0x06, 0xd2, 0x8f, 0xa0, 0x24, 0xfb, 0xfe, 0x08, 0xa3, 0x24, 0xc6, 0x3f,
+    0x49, 0xe5, 0x46, 0x78, 0xa6, 0x50, 0x72, 0x82, 0x24, 0xa6, 0xeb, 0x0c, 0x76, 0xec, 0x72, 0xa0,
+    0xb9, 0x23, 0x4b, 0x2b, 0x96, 0x85, 0xd5, 0x52, 0xa0, 0x16, 0x3b, 0x67, 0x95, 0xeb, 0x70, 0x9d,
+    0xe7, 0xe9, 0x44, 0xaa, 0x17, 0x6d, 0xc2, 0xbf, 0xcb, 0xd1, 0x86, 0x79, 0xf7, 0x5f, 0xc6, 0x76,
+    0xaf, 0x90, 0x27, 0x49, 0x06, 0xd2, 0x8f, 0xa0, 0x24, 0xfb, 0xfe, 0x08, 0xa3, 0x24, 0xc6, 0x3f,
+    0x5e, 0xca, 0x0f, 0x81, 0x81, 0xe8, 0x17, 0xed, 0x6b, 0xc7, 0xbd, 0x1e, 0x62, 0xb4, 0xb6, 0xeb,
+    0xdf, 0xc7, 0x20, 0xbf, 0x2d, 0x4c, 0x09, 0x0a, 0xff, 0xd0, 0xe6, 0x04, 0xca, 0x8e, 0xc6, 0x7d,
+    0xe7, 0xe9, 0x44, 0xaa, 0x17, 0x6d, 0xc2, 0xbf, 0xcb, 0xd1, 0x86, 0x79, 0xf7, 0x5f, 0xc6, 0x76,
+    0x81, 0x0d, 0x2f, 0x3e, 0xac, 0xa4, 0x1e, 0xe7, 0x94, 0x17, 0x5b, 0x1a, 0xa8, 0x3a, 0x70, 0x96,
+    0xf2, 0x9c, 0x48, 0xc2, 0xa1, 0x4c, 0xe9, 0x13, 0x4a, 0x0c, 0x65, 0x2b, 0x90, 0x99, 0xc5, 0xb9,
+    0xdf, 0xc7, 0x20, 0xbf, 0x2d, 0x4c, 0x09, 0x0a, 0xff, 0xd0, 0xe6, 0x04, 0xca, 0x8e, 0xc6, 0x7d,
+    0x73, 0x91, 0x67, 0xfc, 0x0d, 0xe8, 0xf7, 0xf4, 0xde, 0x1b, 0x3e, 0x31, 0x38, 0xa3, 0xb5, 0x2f,
+    0xf9, 0x34, 0x7e, 0x2d, 0xd6, 0x07, 0x2e, 0x9b, 0xb0, 0x95, 0x56, 0xe1, 0x5b, 0xe5, 0xf1, 0x33,
+    0xf2, 0x9c, 0x48, 0xc2, 0xa1, 0x4c, 0xe9, 0x13, 0x4a, 0x0c, 0x65, 0x2b, 0x90, 0x99, 0xc5, 0xb9,
+    0x8a, 0xa5, 0x19, 0xd1, 0xdb, 0xef, 0xd9, 0x6f, 0x6e, 0x8e, 0x68, 0xd0, 0x63, 0x46, 0x44, 0x1c,
+    0x73, 0x67, 0xd5, 0xbf, 0xbd, 0x6f, 0x16, 0x45, 0x65, 0xad, 0x39, 0x04, 0xae, 0x9f, 0x68, 0xf4,
+    0xf9, 0x34, 0x7e, 0x2d, 0xd6, 0x07, 0x2e, 0x9b, 0xb0, 0x95, 0x56, 0xe1, 0x5b, 0xe5, 0xf1, 0x33,
+    0xf9, 0xc2, 0xcc, 0x6e, 0x66, 0x80, 0xcf, 0x2a, 0x0b, 0x23, 0x51, 0xd4, 0xcd, 0xd9, 0x2c, 0xe8,
+    0xda, 0xfb, 0x39, 0xe9, 0x36, 0x99, 0x5a, 0x01, 0x0f, 0xae, 0xf3, 0x8e, 0x1e, 0xef, 0xeb, 0xf8,
+    0x73, 0x67, 0xd5, 0xbf, 0xbd, 0x6f, 0x16, 0x45, 0x65, 0xad, 0x39, 0x04, 0xae, 0x9f, 0x68, 0xf4,
+    0x23, 0x39, 0xf5, 0x87, 0x50, 0x19, 0x95, 0x2b, 0x04, 0x8d, 0xa2, 0x5a, 0xd3, 0x36, 0xc7, 0x10,
+    0xa1, 0xa0, 0xf1, 0xe5, 0xa8, 0x83, 0x53, 0x15, 0x71, 0xb1, 0xae, 0x08, 0x2c, 0xe5, 0x88, 0xec,
+    0xda, 0xfb, 0x39, 0xe9, 0x36, 0x99, 0x5a, 0x01, 0x0f, 0xae, 0xf3, 0x8e, 0x1e, 0xef, 0xeb, 0xf8,
+    0x82, 0x99, 0x04, 0x62, 0xf8, 0x9a, 0xc6, 0x3e, 0x75, 0x3c, 0x0c, 0x52, 0xff, 0xd3, 0x4f, 0xfc,
+    0x5f, 0xfb, 0x43, 0x50, 0x1d, 0x44, 0x9f, 0xcf, 0xd3, 0xa0, 0xc6, 0x77, 0xfd, 0x25, 0x78, 0xa9,
+    0xa1, 0xa0, 0xf1, 0xe5, 0xa8, 0x83, 0x53, 0x15, 0x71, 0xb1, 0xae, 0x08, 0x2c, 0xe5, 0x88, 0xec,
+    0xdd, 0x62, 0x47, 0x32, 0xe5, 0xde, 0x59, 0xf1, 0xa6, 0x9c, 0xca, 0x25, 0x02, 0xf6, 0x37, 0x55,
+    0x69, 0xdb, 0x0b, 0x27, 0x34, 0x7c, 0x44, 0xbb, 0x66, 0xfe, 0xa7, 0x97, 0x6a, 0x42, 0xde, 0xf0,
+    0x5f, 0xfb, 0x43, 0x50, 0x1d, 0x44, 0x9f, 0xcf, 0xd3, 0xa0, 0xc6, 0x77, 0xfd, 0x25, 0x78, 0xa9,
+    0xb4, 0xb9, 0x4c, 0x15, 0xd1, 0xa2, 0x1d, 0x4a, 0xc0, 0x62, 0x6d, 0xb2, 0x68, 0xb4, 0xe9, 0xa5,
+    0x02, 0x23, 0x65, 0x1d, 0xb6, 0x29, 0xd8, 0x16, 0x9e, 0x0d, 0xb6, 0x66, 0xdc, 0xe4, 0xf1, 0xf6,
+    0x69, 0xdb, 0x0b, 0x27, 0x34, 0x7c, 0x44, 0xbb, 0x66, 0xfe, 0xa7, 0x97, 0x6a, 0x42, 0xde, 0xf0,
+    0xb6, 0x9a, 0x29, 0x08, 0x67, 0x8b, 0xc5, 0x5c, 0x5e, 0x6f, 0xdb, 0xd4, 0xb4, 0x50, 0x18, 0x53,
+    0xd2, 0x36, 0xd4, 0xda, 0xb1, 0xce, 0xb0, 0xc8, 0xb0, 0x79, 0xcd, 0x7c, 0xa1, 0x5d, 0x8b, 0x31,
+    0x02, 0x23, 0x65, 0x1d, 0xb6, 0x29, 0xd8, 0x16, 0x9e, 0x0d, 0xb6, 0x66, 0xdc, 0xe4, 0xf1, 0xf6,
+    0x64, 0xac, 0xfd, 0xd2, 0xd6, 0x45, 0x75, 0x94, 0xee, 0x16, 0x16, 0xa8, 0x15, 0x0d, 0x93, 0x62,
+    0x46, 0xc5, 0xe4, 0xef, 0x97, 0xa5, 0xb7, 0xdf, 0xe9, 0x73, 0xbe, 0xbe, 0x07, 0x64, 0xd1, 0x64,
+    0xd2, 0x36, 0xd4, 0xda, 0xb1, 0xce, 0xb0, 0xc8, 0xb0, 0x79, 0xcd, 0x7c, 0xa1, 0x5d, 0x8b, 0x31,
+    0x22, 0x69, 0x19, 0x3d, 0x41, 0xe0, 0xc2, 0x4b, 0x07, 0x65, 0xa8, 0x16, 0x12, 0x69, 0x42, 0x06,
+    0x52, 0xe1, 0x24, 0xa9, 0xe2, 0x95, 0x97, 0x20, 0xd7, 0x3f, 0x88, 0xb1, 0x53, 0x8c, 0x5e, 0x5a,
+    0x46, 0xc5, 0xe4, 0xef, 0x97, 0xa5, 0xb7, 0xdf, 0xe9, 0x73, 0xbe, 0xbe, 0x07, 0x64, 0xd1, 0x64,
+    0x70, 0x88, 0x3d, 0x94, 0xa3, 0x75, 0x55, 0x6b, 0xd0, 0x5a, 0x20, 0xa7, 0x41, 0xe5, 0x1c, 0x5c,
+    0xb2, 0x50, 0x0b, 0x9d, 0xa7, 0x31, 0xbe, 0x8a, 0xde, 0x77, 0xd3, 0xd6, 0xd3, 0x28, 0xdc, 0x6d,
+    0x52, 0xe1, 0x24, 0xa9, 0xe2, 0x95, 0x97, 0x20, 0xd7, 0x3f, 0x88, 0xb1, 0x53, 0x8c, 0x5e, 0x5a,
+    0xc2, 0xd8, 0x36, 0x09, 0x04, 0x44, 0xeb, 0xe1, 0x0e, 0x2d, 0xf3, 0x71, 0x92, 0xcd, 0xc0, 0x31,
+    0x69, 0x72, 0xd1, 0x1e, 0xc1, 0xeb, 0x33, 0x31, 0x20, 0xdf, 0xe2, 0xd4, 0xba, 0xf2, 0x9f, 0xa4,
+    0xb2, 0x50, 0x0b, 0x9d, 0xa7, 0x31, 0xbe, 0x8a, 0xde, 0x77, 0xd3, 0xd6, 0xd3, 0x28, 0xdc, 0x6d,
+    0xab, 0xaa, 0xe7, 0x17, 0xc5, 0xaf, 0xd8, 0xd0, 0x2e, 0xf2, 0x11, 0xa5, 0x28, 0x3f, 0x5f, 0x95,
+    0x45, 0x42, 0xbc, 0xe4, 0x57, 0x07, 0x2e, 0xb4, 0x2b, 0x93, 0xa0, 0xf6, 0xba, 0xc4, 0x26, 0x66,
+    0x69, 0x72, 0xd1, 0x1e, 0xc1, 0xeb, 0x33, 0x31, 0x20, 0xdf, 0xe2, 0xd4, 0xba, 0xf2, 0x9f, 0xa4,
+    0xee, 0xe8, 0x5b, 0xf3, 0x92, 0xa8, 0xf6, 0x64, 0x05, 0x61, 0xb1, 0x53, 0x92, 0xfb, 0x79, 0xf3,
+    0xdf, 0x51, 0x36, 0x66, 0x8d, 0x27, 0x63, 0xb7, 0xb2, 0x8f, 0x5b, 0xc9, 0x09, 0xa1, 0xfa, 0xe0,
+    0x45, 0x42, 0xbc, 0xe4, 0x57, 0x07, 0x2e, 0xb4, 0x2b, 0x93, 0xa0, 0xf6, 0xba, 0xc4, 0x26, 0x66,
+    0x31, 0xb9, 0x6d, 0x95, 0x1f, 0x8f, 0x95, 0xd3, 0xb7, 0xee, 0xea, 0x9a, 0x9b, 0x5a, 0x83, 0x13,
+    0xb3, 0xcc, 0x83, 0x2c, 0x78, 0x47, 0x18, 0x68, 0xfa, 0xa8, 0x5d, 0xda, 0x1d, 0x62, 0x98, 0x09,
+    0xdf, 0x51, 0x36, 0x66, 0x8d, 0x27, 0x63, 0xb7, 0xb2, 0x8f, 0x5b, 0xc9, 0x09, 0xa1, 0xfa, 0xe0,
+};
+
+static const unsigned char aes_mode_plain_digest[AES_MODE_MESSAGES * 16] =
+{
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+};
+
+static const unsigned char aes_cbc_digest[AES_MODE_MESSAGES * 16] =
+{
+    0x2f, 0xdf, 0x53, 0xe7, 0xa8, 0x60, 0x91, 0xa8, 0x5e, 0x43, 0xc1, 0x8e, 0x26, 0x54, 0x3f, 0x40,
+    0x7d, 0x8c, 0x11, 0x90, 0xc2, 0xf9, 0xfb, 0xa6, 0xa8, 0x8d, 0x5c, 0xca, 0x51, 0x1f, 0x11, 0xe4,
+    0x44, 0xe4, 0xfb, 0x77, 0x0a, 0xcd, 0x28, 0xce, 0x24, 0x8a, 0x1b, 0x24, 0x43, 0x6b, 0xfb, 0x40,
+    0x25, 0xb4, 0xd7, 0x04, 0x05, 0xe1, 0x7c, 0x6d, 0x30, 0xc0, 0x8a, 0x2f, 0x33, 0xdc, 0x11, 0xed,
+    0x34, 0x24, 0xa4, 0x22, 0x6d, 0xb6, 0xd0, 0x31, 0x77, 0x6a, 0x94, 0x15, 0xd2, 0xb1, 0xc2, 0xb9,
+    0x3e, 0x53, 0x6e, 0x13, 0xba, 0xb5, 0xef, 0xfa, 0x11, 0x83, 0x31, 0x2e, 0xf0, 0xcc, 0x62, 0xbb,
+    0xd2, 0x7c, 0xa6, 0x15, 0xa3, 0xde, 0xbc, 0x8d, 0x1b, 0x6b, 0x6c, 0x87, 0x4c, 0x3b, 0x8e, 0xa6,
+    0xcd, 0x6d, 0x94, 0xbb, 0x03, 0x83, 0x1d, 0x5f, 0x84, 0x7e, 0x4d, 0x6d, 0x4f, 0x61, 0xdd, 0xb3,
+    0x94, 0x63, 0x1a, 0x1f, 0xc2, 0x13, 0x03, 0xc3, 0x06, 0xcf, 0x36, 0xb2, 0xe1, 0x16, 0x03, 0x79,
+    0x50, 0x54, 0x62, 0x3d, 0x52, 0x78, 0xf9, 0xf4, 0x44, 0x91, 0x8b, 0xbb, 0x86, 0xd9, 0x29, 0x2e,
+    0x85, 0x07, 0xfd, 0xf7, 0x25, 0xea, 0x86, 0xc9, 0x9e, 0x2f, 0x74, 0xca, 0xa6, 0x1f, 0x2f, 0x96,
+    0x41, 0xa3, 0xff, 0x47, 0xc6, 0x26, 0xba, 0xfe, 0x07, 0xfd, 0x12, 0x15, 0xc8, 0x9a, 0x76, 0x35,
+    0x65, 0x94, 0x72, 0xd7, 0x29, 0x41, 0x0f, 0x33, 0xd8, 0x6f, 0x5f, 0xca, 0x47, 0x51, 0x3d, 0x2c,
+    0x71, 0xa3, 0xa0, 0xce, 0x21, 0xfa, 0x0d, 0xda, 0x6d, 0x85, 0x41, 0xe9, 0xf8, 0xc1, 0xce, 0xb0,
+    0x6b, 0x07, 0xd7, 0xb2, 0xdb, 0x9b, 0xf6, 0x95, 0xcb, 0x8d, 0x26, 0xac, 0xe9, 0xde, 0xb6, 0xc7,
+    0x1a, 0xd1, 0xa7, 0xf1, 0x77, 0xa1, 0xa3, 0x61, 0xff, 0x10, 0x8c, 0x04, 0x38, 0xc7, 0x2a, 0x2d,
+    0xb3, 0xa7, 0xbd, 0xbf, 0x10, 0xe0, 0xe4, 0x9f, 0xa9, 0xe7, 0x16, 0x69, 0x4b, 0xdf, 0xde, 0x19,
+    0x43, 0x4d, 0x48, 0x5b, 0x02, 0x68, 0x1b, 0x54, 0x06, 0x31, 0xd5, 0x4f, 0x73, 0x1c, 0x28, 0xaa,
+    0xfd, 0xfa, 0xa4, 0xce, 0x8c, 0xef, 0xbe, 0x33, 0x20, 0x19, 0x17, 0x15, 0x9b, 0x73, 0xaa, 0x77,
+    0x52, 0x83, 0xac, 0xb3, 0x73, 0xdf, 0x91, 0x2b, 0xce, 0x91, 0x2d, 0xe0, 0x57, 0x58, 0xe2, 0xa4,
+    0x5e, 0xe4, 0x58, 0x9c, 0x0f, 0xd7, 0x7f, 0x0e, 0x49, 0x23, 0xc2, 0x06, 0xc1, 0x42, 0xb3, 0xe2,
+    0x7b, 0xb3, 0x4d, 0x6a, 0x03, 0xcc, 0x84, 0x9a, 0x20, 0xf6, 0xcc, 0xfc, 0x85, 0xde, 0xfe, 0x9a,
+    0xe2, 0xbf, 0x2c, 0xae, 0xfb, 0xcc, 0xd5, 0x84, 0xd1, 0x05, 0xe6, 0x3d, 0x9b, 0x2e, 0x68, 0xab,
+    0xbf, 0x2d, 0x34, 0x1a, 0x28, 0x5a, 0x58, 0xe6, 0xf3, 0xc5, 0x85, 0x69, 0xd7, 0xb2, 0x1d, 0xe6,
+    0xaf, 0x1b, 0x1f, 0x78, 0xba, 0x85, 0xe7, 0x44, 0x9c, 0xd0, 0xeb, 0x3a, 0x05, 0x3d, 0x1e, 0xfc,
+    0xda, 0x18, 0x4b, 0xdc, 0x74, 0xf3, 0xb6, 0x3e, 0x7d, 0x85, 0x35, 0x95, 0x38, 0x33, 0x25, 0xf3,
+    0x76, 0xf4, 0x00, 0x2c, 0x85, 0x71, 0x17, 0x6c, 0x67, 0xa6, 0xf1, 0xd3, 0x1e, 0x48, 0x5f, 0xa4,
+    0x55, 0xd4, 0x58, 0xb4, 0xb2, 0x94, 0xbb, 0x75, 0x25, 0x54, 0x52, 0x18, 0x29, 0x45, 0x45, 0xa2,
+    0x18, 0x0e, 0x4b, 0x44, 0xf1, 0xfb, 0x2f, 0x88, 0xa4, 0x44, 0x2d, 0x55, 0xd9, 0x95, 0x50, 0x6d,
+    0x87, 0x18, 0xba, 0xe9, 0x25, 0xc5, 0x6a, 0xde, 0x02, 0xa9, 0xf1, 0x76, 0x1a, 0xb4, 0xa3, 0x2e,
+    0x88, 0x87, 0x03, 0x19, 0x0f, 0x6f, 0x05, 0x46, 0xca, 0x96, 0x7c, 0xd2, 0x8a, 0xa2, 0xb2, 0xc4,
+    0x7a, 0x94, 0x51, 0x95, 0xc3, 0x97, 0x81, 0xc4, 0xae, 0x8a, 0xa6, 0x29, 0x4b, 0x31, 0x20, 0x47,
+    0x43, 0x21, 0x42, 0x93, 0xe3, 0x21, 0x2d, 0x66, 0x8e, 0xf7, 0xd6, 0xd9, 0x4e, 0xc9, 0xe0, 0x47,
+    0x9a, 0x62, 0x3c, 0x55, 0x08, 0x9d, 0x5c, 0xb8, 0xd0, 0xe4, 0x26, 0xfa, 0x52, 0x10, 0xfe, 0xec,
+    0x00, 0xd8, 0xe8, 0x24, 0x57, 0x4f, 0x2f, 0x5a, 0xf9, 0xe6, 0x41, 0xbc, 0x16, 0x9c, 0xb6, 0x2d,
+    0x7c, 0xe5, 0xb7, 0x96, 0xd9, 0x03, 0x95, 0xa3, 0x9b, 0x1a, 0x5c, 0x17, 0x9f, 0xbb, 0x62, 0x80,
+    0x65, 0x02, 0xc9, 0xe1, 0xba, 0xa1, 0xc4, 0x99, 0x67, 0x52, 0xf8, 0x07, 0x66, 0xf9, 0xef, 0xb6,
+    0x71, 0x91, 0x51, 0x00, 0x11, 0xe2, 0x0a, 0xb0, 0x0c, 0x91, 0x47, 0x08, 0xf9, 0xfc, 0x61, 0x77,
+    0xe0, 0xc1, 0xc6, 0xeb, 0xc7, 0x40, 0x31, 0x8c, 0xbb, 0xc9, 0x43, 0x39, 0x68, 0x55, 0x6e, 0x32,
+    0xdd, 0x58, 0x5d, 0x02, 0xfa, 0x9f, 0x26, 0x3b, 0xda, 0x58, 0x07, 0xd1, 0x80, 0x01, 0x86, 0x55,
+    0xbb, 0x87, 0xb1, 0x5d, 0xd2, 0xb8, 0xb1, 0x0c, 0x42, 0x7d, 0x35, 0x25, 0x43, 0xdd, 0x49, 0xeb,
+    0x72, 0xd6, 0x92, 0x20, 0xbb, 0x21, 0x2d, 0x62, 0xc3, 0x61, 0xf0, 0xe0, 0xe1, 0xfc, 0x58, 0x3e,
+    0xa5, 0x89, 0xf4, 0x38, 0x71, 0x2a, 0xed, 0xf6, 0xf9, 0x68, 0xc3, 0xde, 0xd8, 0x54, 0xe1, 0x2d,
+    0x2f, 0x20, 0x01, 0x80, 0x89, 0x0a, 0x21, 0xb8, 0x0d, 0xd8, 0xac, 0x51, 0xdd, 0x10, 0xfb, 0x3b,
+    0x23, 0x85, 0x28, 0x67, 0x07, 0x13, 0x58, 0xb0, 0x6c, 0xd3, 0xc5, 0x6a, 0x4f, 0x62, 0x55, 0xa7,
+    0xee, 0x85, 0xae, 0xd5, 0xb2, 0x3b, 0x35, 0xae, 0xf6, 0x01, 0xfb, 0x50, 0x6e, 0x37, 0x09, 0xbc,
+    0xd5, 0x6f, 0x2e, 0x51, 0xf3, 0x83, 0x08, 0x29, 0x4b, 0x00, 0xd5, 0x15, 0x0e, 0xcb, 0x33, 0x5d,
+    0xbc, 0xd2, 0x4f, 0xcc, 0x93, 0x06, 0xe2, 0xf1, 0x9b, 0x1d, 0x01, 0xbc, 0xab, 0xed, 0xd0, 0x17,
+    0x94, 0x4e, 0x8d, 0x3a, 0x36, 0x6c, 0xc8, 0x75, 0x8e, 0x67, 0x07, 0x33, 0x9c, 0x43, 0x61, 0x14,
+    0xef, 0x05, 0x92, 0x99, 0x23, 0x65, 0x89, 0x39, 0xaa, 0xcf, 0x84, 0x12, 0xc6, 0x46, 0x68, 0x0a,
+    0x5d, 0xa3, 0x70, 0x15, 0x9a, 0xa3, 0xb2, 0x59, 0xa9, 0x6b, 0xdd, 0xd4, 0xa1, 0x1c, 0xb5, 0x72,
+    0x1b, 0x13, 0x22, 0xf3, 0x2a, 0xa1, 0x8e, 0xe1, 0xe8, 0xe2, 0x2f, 0xc8, 0x76, 0x0b, 0x87, 0x7c,
+    0x22, 0x71, 0x31, 0xeb, 0x28, 0x27, 0x5e, 0x42, 0x19, 0x16, 0x92, 0x85, 0x96, 0xe8, 0x96, 0x9d,
+    0x2c, 0x69, 0xaf, 0x15, 0xda, 0x07, 0x1e, 0x57, 0x6f, 0x26, 0x03, 0x5c, 0x98, 0x9f, 0x8a, 0x5a,
+    0x6a, 0xe0, 0xc1, 0x07, 0x26, 0x4b, 0xb4, 0xd3, 0xa9, 0xba, 0x56, 0x8a, 0xe7, 0x5e, 0x99, 0x11,
+    0x41, 0x2a, 0xd3, 0xb1, 0x5f, 0x1f, 0x0d, 0x86, 0xf6, 0x16, 0x5a, 0xd7, 0x89, 0x71, 0x3a, 0x08,
+    0xe7, 0x04, 0x22, 0x93, 0x44, 0x15, 0xdd, 0x30, 0xe3, 0x9c, 0x29, 0xcf, 0x6b, 0xf8, 0x19, 0x3e,
+    0xb3, 0x33, 0x90, 0x15, 0xf0, 0x8c, 0xf7, 0x94, 0x07, 0xa7, 0xde, 0x2d, 0x89, 0x91, 0x63, 0x27,
+    0xc4, 0x1c, 0xe3, 0x56, 0x3b, 0x0a, 0x18, 0x71, 0x23, 0xdf, 0xb0, 0x50, 0xd1, 0x25, 0xbf, 0x72,
+    0x81, 0xd6, 0xf0, 0x40, 0x08, 0x23, 0x6b, 0xf9, 0xb1, 0x91, 0x8e, 0xc1, 0x64, 0x2f, 0x75, 0x88,
+    0x1d, 0x77, 0xb7, 0x0c, 0x25, 0xbb, 0x93, 0x0e, 0x2e, 0xc0, 0xb0, 0x5b, 0x7b, 0x0e, 0x68, 0x03,
+    0xcb, 0x1a, 0xeb, 0x6e, 0x46, 0xf5, 0x8e, 0x2f, 0x9d, 0x0b, 0xbb, 0x0a, 0xd7, 0x64, 0x67, 0xad,
+    0x40, 0x58, 0x50, 0x00, 0x1d, 0x5d, 0xfb, 0xdc, 0xbc, 0x61, 0x95, 0xdf, 0xec, 0x58, 0xfb, 0xcd,
+    0x17, 0xc0, 0xcb, 0x88, 0x7f, 0x7c, 0x35, 0xd1, 0x69, 0x5a, 0x8c, 0xb5, 0xaf, 0x56, 0xe6, 0x86,
+};
+
+static const unsigned char aes_ctr_digest[AES_MODE_MESSAGES * 16] =
+{
+    0x0e, 0x82, 0xfa, 0x43, 0x7c, 0xc3, 0xbc, 0xf1, 0xc0, 0x62, 0xb7, 0xb0, 0x2e, 0x99, 0xb5, 0x24,
+    0xdb, 0xb3, 0x26, 0x48, 0xf9, 0x31, 0x37, 0xdd, 0x9c, 0x62, 0x47, 0x4b, 0x48, 0x18, 0x7d, 0x3c,
+    0xf3, 0x89, 0x64, 0xa6, 0x07, 0xd3, 0xf8, 0xa3, 0xb5, 0x32, 0x11, 0x4b, 0x0a, 0x04, 0xb3, 0xb8,
+    0x7a, 0xad, 0x17, 0x54, 0x2a, 0x3d, 0x0b, 0xdf, 0x08, 0xa1, 0x09, 0xb0, 0x46, 0xaa, 0xc1, 0x35,
+    0x8e, 0xd1, 0x94, 0xbe, 0xd8, 0xe9, 0x8a, 0x6d, 0xfd, 0x44, 0xd1, 0xe6, 0xdd, 0x01, 0x51, 0x7a,
+    0x2a, 0xf2, 0x9b, 0x65, 0xc1, 0xa4, 0x3b, 0x7a, 0xd5, 0x8a, 0x23, 0x5a, 0xbe, 0x64, 0x91, 0xef,
+    0x06, 0xef, 0x51, 0x87, 0x38, 0x7c, 0xa6, 0xbe, 0xdc, 0xc0, 0x62, 0xfe, 0x52, 0x9e, 0x8e, 0x52,
+    0x0f, 0xba, 0x28, 0xa8, 0x11, 0x2d, 0xc9, 0xe6, 0xce, 0x9f, 0x28, 0x35, 0x07, 0x4c, 0x6a, 0x19,
+    0x83, 0xe4, 0x51, 0xdb, 0x09, 0xa4, 0xf0, 0x2b, 0x24, 0xd4, 0xe0, 0x89, 0x32, 0x3c, 0x03, 0x7e,
+    0xf6, 0xc3, 0x67, 0x23, 0x05, 0x31, 0x63, 0x71, 0xd0, 0x5d, 0xb1, 0x3b, 0xeb, 0x9d, 0x8b, 0x46,
+    0x0e, 0xa1, 0xe9, 0x28, 0xf0, 0x36, 0xa6, 0x34, 0xf0, 0x18, 0x1c, 0x13, 0x94, 0x08, 0xed, 0x60,
+    0xbc, 0xf5, 0xa5, 0xf6, 0xed, 0xf6, 0x40, 0x9f, 0x54, 0x6f, 0xbb, 0xef, 0xfc, 0x83, 0x9c, 0xfe,
+    0xd3, 0x08, 0x13, 0xb1, 0x23, 0xe3, 0x5c, 0x35, 0xe5, 0xd9, 0x07, 0xcb, 0x53, 0x79, 0xce, 0x37,
+    0x22, 0xbf, 0x42, 0xe6, 0x13, 0xc9, 0x28, 0x17, 0x5c, 0x43, 0x8b, 0xb8, 0xbf, 0xac, 0xff, 0xb0,
+    0xf8, 0xc3, 0xb8, 0x55, 0xf5, 0x96, 0xf6, 0x40, 0x2c, 0x8f, 0x58, 0x26, 0xb9, 0x34, 0x03, 0xcb,
+    0x78, 0x5b, 0x02, 0xaf, 0xd6, 0x82, 0x91, 0x83, 0x1f, 0xa1, 0x19, 0x67, 0x5c, 0x0c, 0xde, 0xaa,
+    0x6b, 0x54, 0x63, 0x8b, 0x6f, 0xd3, 0x70, 0x6f, 0xd0, 0x1d, 0x33, 0x99, 0xf7, 0x79, 0x41, 0x10,
+    0x8d, 0xaf, 0xf0, 0xe8, 0xd7, 0xcd, 0x14, 0xf7, 0x27, 0xce, 0x06, 0xe9, 0x27, 0xc3, 0xf9, 0x4f,
+    0x6a, 0xe7, 0xa1, 0xf5, 0x0f, 0x65, 0xe1, 0xfa, 0x7d, 0x02, 0x6d, 0xeb, 0x27, 0xb5, 0x67, 0x18,
+    0x8e, 0xc6, 0x59, 0x0f, 0xcf, 0xa6, 0x98, 0x4c, 0xa8, 0x38, 0x87, 0x9c, 0x43, 0xd3, 0x22, 0x33,
+    0x2f, 0x0d, 0x9e, 0x8f, 0x27, 0xcd, 0x22, 0xa5, 0x9a, 0x08, 0x34, 0xa2, 0xd8, 0x04, 0x7d, 0x8e,
+    0xbf, 0x0d, 0x7f, 0xa0, 0x86, 0x9a, 0x46, 0xd4, 0x3f, 0x51, 0x59, 0x7e, 0x54, 0x7c, 0x29, 0x4a,
+    0xe0, 0xb3, 0xb1, 0x2d, 0xa4, 0xca, 0x6e, 0x86, 0x2f, 0x26, 0x0e, 0x1f, 0xda, 0x25, 0xb7, 0xdf,
+    0x63, 0x2d, 0x23, 0x66, 0x95, 0x99, 0xbf, 0x5f, 0x08, 0xe4, 0x2d, 0xd9, 0x20, 0xdb, 0x75, 0xb6,
+    0xf5, 0xd3, 0xd1, 0x96, 0xb7, 0x8e, 0x24, 0x6f, 0x99, 0x82, 0x52, 0xd7, 0x27, 0x56, 0x6a, 0x6e,
+    0x11, 0x4c, 0x7e, 0x55, 0x73, 0xcb, 0xa8, 0x50, 0xf1, 0xe6, 0x63, 0x82, 0xfd, 0x00, 0x0e, 0x2f,
+    0xf1, 0x4c, 0xd5, 0x5d, 0x18, 0x13, 0x92, 0x0a, 0x99, 0xf9, 0x00, 0x7d, 0x02, 0x7d, 0x83, 0xe6,
+    0x22, 0x11, 0x4e, 0xb9, 0xab, 0xf9, 0x02, 0x57, 0x2a, 0x79, 0xe3, 0xde, 0xd6, 0x76, 0x1b, 0x4c,
+    0x98, 0x6f, 0x55, 0x61, 0x47, 0x86, 0x50, 0x3c, 0x35, 0xed, 0xb0, 0x40, 0xa5, 0xc4, 0x9d, 0x32,
+    0x6a, 0xab, 0x50, 0x88, 0xaf, 0xd6, 0x59, 0x52, 0xb0, 0x8e, 0x31, 0xae, 0x7b, 0xbf, 0xf0, 0x18,
+    0x7a, 0x6b, 0x41, 0x39, 0xee, 0x14, 0x9f, 0x14, 0x92, 0xba, 0x31, 0x03, 0xb3, 0x91, 0xfa, 0xc3,
+    0x4d, 0xc2, 0x14, 0x62, 0x24, 0x72, 0x2d, 0x84, 0xe8, 0xda, 0x2f, 0x96, 0x84, 0xea, 0x64, 0x43,
+    0x06, 0xa4, 0xde, 0xd6, 0xd2, 0x16, 0x4f, 0x54, 0x55, 0x9c, 0x85, 0x28, 0x29, 0x26, 0x39, 0x96,
+    0x5b, 0x90, 0xda, 0x26, 0xca, 0xe4, 0x0b, 0x61, 0x56, 0xd2, 0x6b, 0x7a, 0xdd, 0xd9, 0x56, 0x1a,
+    0x3a, 0x24, 0xf2, 0x9d, 0xa3, 0xe2, 0x53, 0x4f, 0xf6, 0xc1, 0x49, 0x5a, 0x68, 0x4b, 0xe5, 0xbd,
+    0x39, 0xff, 0xb3, 0x2f, 0x49, 0x55, 0x69, 0x75, 0x61, 0xa1, 0xfe, 0xd8, 0x61, 0x55, 0x6e, 0x2f,
+    0x28, 0xe9, 0xba, 0xe0, 0x1b, 0x7f, 0x3d, 0x58, 0x06, 0x75, 0x23, 0xd4, 0x1e, 0x2b, 0x4d, 0x0b,
+    0xf0, 0xbb, 0x9b, 0xd3, 0x28, 0x4f, 0xdc, 0xde, 0x94, 0x27, 0x00, 0xf4, 0xfc, 0xcc, 0x50, 0xaf,
+    0xf0, 0x1b, 0x88, 0x8c, 0x7a, 0xc0, 0x44, 0xff, 0xe5, 0x35, 0xa4, 0x62, 0x18, 0xe0, 0x67, 0x4b,
+    0x6f, 0xb1, 0x48, 0x1d, 0x1f, 0xb6, 0x45, 0xb4, 0xce, 0x58, 0xd2, 0xee, 0xec, 0xaa, 0xb2, 0xd0,
+    0x98, 0x9c, 0x73, 0x87, 0x8a, 0x27, 0x07, 0x6e, 0x8d, 0xa6, 0x63, 0xd3, 0x8d, 0xd7, 0x45, 0xfe,
+    0x01, 0xd2, 0xcb, 0x5e, 0xf2, 0x76, 0xcf, 0x71, 0xea, 0xe9, 0x80, 0x5a, 0xf9, 0xc6, 0xde, 0x8d,
+    0xe4, 0xec, 0x7f, 0x17, 0x1e, 0x34, 0x2e, 0xd5, 0x7b, 0x31, 0x82, 0x8b, 0xbe, 0x6f, 0x63, 0xe4,
+    0x02, 0x70, 0x86, 0xbf, 0x19, 0xd5, 0x01, 0x9e, 0x12, 0xc7, 0x94, 0x7a, 0x02, 0x2b, 0xbf, 0xf0,
+    0x6a, 0x9d, 0x81, 0x72, 0xa4, 0x12, 0xef, 0x07, 0x9e, 0x11, 0x65, 0xb0, 0x83, 0x13, 0x85, 0x56,
+    0x51, 0x12, 0xeb, 0x82, 0x47, 0x9f, 0xaf, 0x7c, 0x3f, 0xba, 0x43, 0x92, 0x64, 0x35, 0x40, 0x88,
+    0xe0, 0xd4, 0x17, 0x38, 0x3d, 0x17, 0x60, 0xe7, 0xe2, 0x43, 0x92, 0x9c, 0xb2, 0xa5, 0x5d, 0x7a,
+    0x30, 0x25, 0x0f, 0xad, 0x6c, 0x3b, 0xdb, 0x9a, 0x96, 0x6a, 0x91, 0xaf, 0x83, 0xaf, 0xa0, 0x19,
+    0x06, 0xb1, 0xf2, 0x9f, 0xca, 0x3c, 0xc1, 0xd7, 0xae, 0xba, 0x52, 0x29, 0x51, 0x65, 0xd5, 0xa5,
+    0xb8, 0x09, 0x0f, 0xf1, 0xbe, 0xd2, 0x8c, 0x3a, 0x69, 0x01, 0x25, 0x29, 0x07, 0x1e, 0x6d, 0xd6,
+    0x3d, 0x32, 0xd4, 0x9a, 0xa6, 0x75, 0xfa, 0xb1, 0x55, 0xdf, 0x46, 0xec, 0x37, 0x13, 0x17, 0x3f,
+    0x1e, 0xd5, 0x44, 0x26, 0x1c, 0xc3, 0x3b, 0x56, 0x3f, 0xd4, 0x23, 0x99, 0x63, 0xf3, 0x96, 0x4f,
+    0x60, 0x19, 0x0b, 0x7c, 0xb9, 0xb9, 0x10, 0xb9, 0xb0, 0x11, 0xcb, 0xeb, 0xc9, 0xd6, 0x6a, 0xe5,
+    0x24, 0x78, 0xd1, 0x1b, 0xd5, 0xb2, 0xc5, 0xb0, 0x16, 0x65, 0x38, 0xa1, 0xc9, 0x78, 0x30, 0x18,
+    0xf2, 0x02, 0x91, 0xdf, 0x8d, 0x2f, 0x73, 0x09, 0x78, 0x36, 0xdd, 0xc8, 0x1c, 0x63, 0x00, 0x62,
+    0xa8, 0x64, 0x50, 0x2a, 0xf5, 0xdc, 0xb3, 0x9b, 0xf6, 0xe4, 0x06, 0x4f, 0xc7, 0x21, 0x32, 0xbd,
+    0x84, 0x3e, 0x2a, 0x7e, 0x2c, 0xb3, 0x05, 0x7d, 0xf5, 0x56, 0xa6, 0xcb, 0x82, 0x41, 0x53, 0x9d,
+    0xae, 0x2e, 0xda, 0x2a, 0x26, 0x51, 0xbd, 0x67, 0xb1, 0xe9, 0x5a, 0xdc, 0x54, 0x41, 0x02, 0x63,
+    0x46, 0xf1, 0x02, 0x49, 0xc5, 0x6e, 0x1d, 0xf0, 0xd0, 0x92, 0x23, 0xb4, 0x04, 0x0e, 0x36, 0x34,
+    0xdf, 0xd2, 0x2b, 0xb4, 0x64, 0x21, 0x7a, 0x65, 0x6c, 0x0f, 0x76, 0xb4, 0x9f, 0x94, 0xc4, 0xb2,
+    0x04, 0xc9, 0x3f, 0xe0, 0x87, 0x14, 0xa8, 0x2e, 0x99, 0x78, 0xcf, 0x6f, 0x56, 0xb0, 0x66, 0x77,
+    0xb2, 0x5a, 0xa4, 0xc6, 0x3d, 0x2e, 0x53, 0xac, 0x08, 0x6d, 0xaf, 0xca, 0x1a, 0xb2, 0xaa, 0x5c,
+    0x82, 0xdf, 0x5b, 0x0e, 0x06, 0x50, 0xb9, 0xc1, 0x22, 0x16, 0x34, 0xd3, 0xa9, 0x6d, 0xac, 0x73,
+    0xbe, 0x6d, 0x7d, 0xd8, 0x94, 0x9a, 0x87, 0xc2, 0x7d, 0xda, 0x94, 0x9d, 0x40, 0xba, 0x2c, 0x3a,
+};
@@ -0,0 +1,157 @@
+//*****************************************************************************
+//
+// aes_modes.c
+//
+// Monte Carlo chains and the CBC and CTR modes on top of the single-block
+// cipher, see aes_modes.h.  Each workload sets its key once.  With an
+// engine that has the round-key API the key is then expanded once for the
+// whole chain or message; with the TI code, which expands the key on every
+// call and overwrites it, every call gets a fresh copy of it.
+//
+//*****************************************************************************
+
+#include <string.h>
+
+#if defined(AES_TTABLE)
+#include "aes_ttable.h"
+#elif defined(AES_BITSLICE)
+#error "the chained AES workloads need a single-block engine"
+#else
+#include "TI_aes_128.h"
+#endif
+
+#if defined(AES_KEY_BITS) && AES_KEY_BITS != 128
+#error "the chained AES workloads are AES-128 only"
+#endif
+
+#include "aes_modes.h"
+
+#define     BLOCK_BYTES         16
+
+#ifdef AES_ROUND_KEYS
+
+static aes_round_keys keys;
+
+static void set_key(const unsigned char *key)
+{
+    aes_expand_keys(&keys, key);
+}
+
+static void cipher(unsigned char *block, unsigned char dir)
+{
+    if (dir == 0)
+    {
+        aes_encrypt(block, &keys);
+    }
+    else
+    {
+        aes_decrypt(block, &keys);
+    }
+}
+
+#else
+
+static unsigned char cipher_key[BLOCK_BYTES];
+
+static void set_key(const unsigned char *key)
+{
+    memcpy(cipher_key, key, BLOCK_BYTES);
+}
+
+static void cipher(unsigned char *block, unsigned char dir)
+{
+    unsigned char key_copy[BLOCK_BYTES];
+
+    memcpy(key_copy, cipher_key, BLOCK_BYTES);
+    aes_enc_dec(block, key_copy, dir);
+}
+
+#endif
+
+static void xor_block(unsigned char *to, const unsigned char *from)
+{
+    int i = 0;
+
+    for (i = 0; i < BLOCK_BYTES; i++)
+    {
+        to[i] ^= from[i];
+    }
+}
+
+void aes_mct(unsigned char *block, const unsigned char *key, unsigned char dir)
+{
+    unsigned int i = 0;
+
+    set_key(key);
+    for (i = 0; i < AES_MCT_CHAIN; i++)
+    {
+        cipher(block, dir);
+    }
+}
+
+void aes_mode_message(unsigned char (*message)[16], const unsigned char *record)
+{
+    unsigned int b = 0;
+
+    for (b = 0; b < AES_MODE_BLOCKS; b++)
+    {
+        memcpy(message[b], record + BLOCK_BYTES, BLOCK_BYTES);
+        message[b][BLOCK_BYTES - 1] ^= (unsigned char) b;
+    }
+}
+
+void aes_cbc(unsigned char (*message)[16], const unsigned char *record, unsigned char dir)
+{
+    const unsigned char *iv = record + 2 * BLOCK_BYTES;
+    unsigned int b = 0;
+
+    set_key(record);
+    if (dir == 0)
+    {
+        for (b = 0; b < AES_MODE_BLOCKS; b++)
+        {
+            xor_block(message[b], b == 0 ? iv : message[b - 1]);
+            cipher(message[b], 0);
+        }
+    }
+    else
+    {
+        // last block first, so the previous ciphertext is still there
+        for (b = AES_MODE_BLOCKS; b-- > 0; )
+        {
+            cipher(message[b], 1);
+            xor_block(message[b], b == 0 ? iv : message[b - 1]);
+        }
+    }
+}
+
+void aes_ctr(unsigned char (*message)[16], const unsigned char *record)
+{
+    unsigned char counter[BLOCK_BYTES];
+    unsigned int b = 0;
+
+    set_key(record);
+    for (b = 0; b < AES_MODE_BLOCKS; b++)
+    {
+        memcpy(counter, record + 2 * BLOCK_BYTES, BLOCK_BYTES - 2);
+        counter[BLOCK_BYTES - 2] = (unsigned char) (b >> 8);
+        counter[BLOCK_BYTES - 1] = (unsigned char) b;
+        cipher(counter, 0);
+        xor_block(message[b], counter);
+    }
+}
+
+void aes_mode_digest(unsigned char *digest, const unsigned char (*message)[16])
+{
+    unsigned char first = 0;
+    unsigned int b = 0;
+
+    memset(digest, 0, BLOCK_BYTES);
+    for (b = 0; b < AES_MODE_BLOCKS; b++)
+    {
+        first = digest[0];
+        memmove(digest, digest + 1, BLOCK_BYTES - 1);
+        digest[BLOCK_BYTES - 1] = first;
+        xor_block(digest, message[b]);
+    }
+}
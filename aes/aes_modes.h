@@ -0,0 +1,77 @@
+//*****************************************************************************
+//
+// aes_modes.h
+//
+// The chained AES workloads.  The known-answer test (AES_KAT) does one
+// encryption and one decryption per vector, so copying the vector and
+// checking the result take most of an iteration.  The other workloads
+// chain many cipher calls between checks, so the cipher is most of the
+// time exposed to the beam:
+//
+//   AES_MCT  NIST Monte Carlo test: an iteration is one checkpoint, 1000
+//            chained encryptions and 1000 chained decryptions
+//   AES_CBC  a message of AES_MODE_BLOCKS blocks encrypted and decrypted
+//            in CBC mode
+//   AES_CTR  the same message encrypted and decrypted in CTR mode
+//
+// Select one with -DAES_WORKLOAD=AES_MCT (or AES_CBC, AES_CTR) and compile
+// aes_modes.c with the benchmark.  The messages and the MCT chains start
+// from the vectors of suite AES_MODE_SUITE, and the results are checked
+// against the golden values in aes_mode_golden.h, which
+// tools/aes_mode_gen.c computes on the host with these same functions.
+//
+//*****************************************************************************
+
+#ifndef AES_MODES_H
+#define AES_MODES_H
+
+#define     AES_KAT             0
+#define     AES_MCT             1
+#define     AES_CBC             2
+#define     AES_CTR             3
+
+#ifndef AES_WORKLOAD
+#define     AES_WORKLOAD        AES_KAT
+#endif
+
+// The name in the YAML header and the iterations between two "I am alive"
+// lines, about 500 cipher calls
+#if AES_WORKLOAD == AES_KAT
+#define     AES_WORKLOAD_NAME   "kat"
+#define     AES_HEARTBEAT       250
+#elif AES_WORKLOAD == AES_MCT
+#define     AES_WORKLOAD_NAME   "mct"
+#define     AES_HEARTBEAT       1
+#elif AES_WORKLOAD == AES_CBC
+#define     AES_WORKLOAD_NAME   "cbc"
+#define     AES_HEARTBEAT       8
+#elif AES_WORKLOAD == AES_CTR
+#define     AES_WORKLOAD_NAME   "ctr"
+#define     AES_HEARTBEAT       8
+#else
+#error "unknown AES_WORKLOAD"
+#endif
+
+#define     AES_MCT_CHAIN       1000         // cipher calls per checkpoint
+#define     AES_MCT_CHECKPOINTS 100
+#define     AES_MODE_BLOCKS     32           // 512 bytes of RAM
+#define     AES_MODE_MESSAGES   64
+#define     AES_MODE_SUITE      2            // ECBVarKey128, 256 distinct keys
+
+// AES_MCT_CHAIN chained cipher calls on block: each output is the next
+// input.  dir is 0 to encrypt and 1 to decrypt, as for aes_enc_dec().
+void aes_mct(unsigned char *block, const unsigned char *key, unsigned char dir);
+
+// Message m of a chained mode is built from a known-answer record (key,
+// plaintext, ciphertext): block b is the plaintext with b XORed into its
+// last byte.  The record's key is the key and its ciphertext the CBC IV
+// and the CTR nonce (bytes 0 to 13, the counter is bytes 14 and 15).
+void aes_mode_message(unsigned char (*message)[16], const unsigned char *record);
+void aes_cbc(unsigned char (*message)[16], const unsigned char *record, unsigned char dir);
+void aes_ctr(unsigned char (*message)[16], const unsigned char *record);
+
+// The digest checked after each pass over a message: block by block, the
+// digest is rotated by one byte and the block XORed in
+void aes_mode_digest(unsigned char *digest, const unsigned char (*message)[16]);
+
+#endif
@@ -0,0 +1,321 @@
+//*****************************************************************************
+//
+// aes_trace.c
+//
+// The capture of aes_trace.h, and the step-by-step AES that computes the
+// golden trace, written as in FIPS-197 on a 16 byte state (byte i is row
+// i % 4, column i / 4) and a byte-wise key schedule.  It shares nothing
+// with the engines, so a fault in their tables or code shows up as a
+// difference between the two traces.
+//
+// The encryption is AddRoundKey, then SubBytes, ShiftRows, MixColumns and
+// AddRoundKey per round, without MixColumns in the last; the decryption is
+// AddRoundKey, then InvShiftRows, InvSubBytes, AddRoundKey and
+// InvMixColumns per round, without InvMixColumns in the last.  Step k of
+// either is state k of the trace.  The engines give the state at the end
+// of each round: states 0, 4, 8 and so on, and the output.
+//
+//*****************************************************************************
+
+#include <string.h>
+
+#include "telemetry.h"
+#include "aes_trace.h"
+
+#define     NK                  (AES_KEY_BITS / 32)
+#define     ROUNDS              AES_TRACE_ROUNDS
+#define     BLOCK_BYTES         16
+
+static const unsigned char sbox[256] =
+{
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5,
+    0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0,
+    0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC,
+    0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A,
+    0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0,
+    0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B,
+    0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85,
+    0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5,
+    0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17,
+    0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88,
+    0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C,
+    0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9,
+    0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6,
+    0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E,
+    0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94,
+    0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68,
+    0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
+};
+
+static const unsigned char inv_sbox[256] =
+{
+    0x52, 0x09, 0x6A, 0xD5, 0x30, 0x36, 0xA5, 0x38,
+    0xBF, 0x40, 0xA3, 0x9E, 0x81, 0xF3, 0xD7, 0xFB,
+    0x7C, 0xE3, 0x39, 0x82, 0x9B, 0x2F, 0xFF, 0x87,
+    0x34, 0x8E, 0x43, 0x44, 0xC4, 0xDE, 0xE9, 0xCB,
+    0x54, 0x7B, 0x94, 0x32, 0xA6, 0xC2, 0x23, 0x3D,
+    0xEE, 0x4C, 0x95, 0x0B, 0x42, 0xFA, 0xC3, 0x4E,
+    0x08, 0x2E, 0xA1, 0x66, 0x28, 0xD9, 0x24, 0xB2,
+    0x76, 0x5B, 0xA2, 0x49, 0x6D, 0x8B, 0xD1, 0x25,
+    0x72, 0xF8, 0xF6, 0x64, 0x86, 0x68, 0x98, 0x16,
+    0xD4, 0xA4, 0x5C, 0xCC, 0x5D, 0x65, 0xB6, 0x92,
+    0x6C, 0x70, 0x48, 0x50, 0xFD, 0xED, 0xB9, 0xDA,
+    0x5E, 0x15, 0x46, 0x57, 0xA7, 0x8D, 0x9D, 0x84,
+    0x90, 0xD8, 0xAB, 0x00, 0x8C, 0xBC, 0xD3, 0x0A,
+    0xF7, 0xE4, 0x58, 0x05, 0xB8, 0xB3, 0x45, 0x06,
+    0xD0, 0x2C, 0x1E, 0x8F, 0xCA, 0x3F, 0x0F, 0x02,
+    0xC1, 0xAF, 0xBD, 0x03, 0x01, 0x13, 0x8A, 0x6B,
+    0x3A, 0x91, 0x11, 0x41, 0x4F, 0x67, 0xDC, 0xEA,
+    0x97, 0xF2, 0xCF, 0xCE, 0xF0, 0xB4, 0xE6, 0x73,
+    0x96, 0xAC, 0x74, 0x22, 0xE7, 0xAD, 0x35, 0x85,
+    0xE2, 0xF9, 0x37, 0xE8, 0x1C, 0x75, 0xDF, 0x6E,
+    0x47, 0xF1, 0x1A, 0x71, 0x1D, 0x29, 0xC5, 0x89,
+    0x6F, 0xB7, 0x62, 0x0E, 0xAA, 0x18, 0xBE, 0x1B,
+    0xFC, 0x56, 0x3E, 0x4B, 0xC6, 0xD2, 0x79, 0x20,
+    0x9A, 0xDB, 0xC0, 0xFE, 0x78, 0xCD, 0x5A, 0xF4,
+    0x1F, 0xDD, 0xA8, 0x33, 0x88, 0x07, 0xC7, 0x31,
+    0xB1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xEC, 0x5F,
+    0x60, 0x51, 0x7F, 0xA9, 0x19, 0xB5, 0x4A, 0x0D,
+    0x2D, 0xE5, 0x7A, 0x9F, 0x93, 0xC9, 0x9C, 0xEF,
+    0xA0, 0xE0, 0x3B, 0x4D, 0xAE, 0x2A, 0xF5, 0xB0,
+    0xC8, 0xEB, 0xBB, 0x3C, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2B, 0x04, 0x7E, 0xBA, 0x77, 0xD6, 0x26,
+    0xE1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0C, 0x7D
+};
+
+static const unsigned char enc_steps[4] =
+{
+    TRACE_SUB_BYTES, TRACE_SHIFT_ROWS, TRACE_MIX_COLUMNS, TRACE_ADD_ROUND_KEY
+};
+
+static const unsigned char dec_steps[4] =
+{
+    TRACE_INV_SHIFT_ROWS, TRACE_INV_SUB_BYTES, TRACE_ADD_ROUND_KEY, TRACE_INV_MIX_COLUMNS
+};
+
+static void expand_key(const unsigned char *key, unsigned char *rk)
+{
+    unsigned char temp[4];
+    unsigned char rcon = 1;
+    unsigned char first = 0;
+    int i = 0;
+    int j = 0;
+
+    memcpy(rk, key, 4 * NK);
+    for (i = NK; i < 4 * (ROUNDS + 1); i++)
+    {
+        memcpy(temp, rk + 4 * (i - 1), 4);
+        if (i % NK == 0)
+        {
+            first = temp[0];
+            temp[0] = sbox[temp[1]] ^ rcon;
+            temp[1] = sbox[temp[2]];
+            temp[2] = sbox[temp[3]];
+            temp[3] = sbox[first];
+            rcon = (unsigned char) ((rcon << 1) ^ ((rcon & 0x80) ? 0x1B : 0));
+        }
+        else if (NK > 6 && i % NK == 4)
+        {
+            for (j = 0; j < 4; j++)
+            {
+                temp[j] = sbox[temp[j]];
+            }
+        }
+        for (j = 0; j < 4; j++)
+        {
+            rk[4 * i + j] = rk[4 * (i - NK) + j] ^ temp[j];
+        }
+    }
+}
+
+static unsigned char xtime(unsigned char x)
+{
+    return (unsigned char) ((x << 1) ^ ((x & 0x80) ? 0x1B : 0));
+}
+
+static void mix_columns(unsigned char *s)
+{
+    unsigned char a0, a1, a2, a3, all;
+    int c = 0;
+
+    for (c = 0; c < 16; c += 4)
+    {
+        a0 = s[c];
+        a1 = s[c + 1];
+        a2 = s[c + 2];
+        a3 = s[c + 3];
+        all = a0 ^ a1 ^ a2 ^ a3;
+        s[c] ^= all ^ xtime(a0 ^ a1);
+        s[c + 1] ^= all ^ xtime(a1 ^ a2);
+        s[c + 2] ^= all ^ xtime(a2 ^ a3);
+        s[c + 3] ^= all ^ xtime(a3 ^ a0);
+    }
+}
+
+// InvMixColumns is MixColumns after a multiply by (5, 0, 4, 0)
+static void inv_mix_columns(unsigned char *s)
+{
+    unsigned char u, v;
+    int c = 0;
+
+    for (c = 0; c < 16; c += 4)
+    {
+        u = xtime(xtime(s[c] ^ s[c + 2]));
+        v = xtime(xtime(s[c + 1] ^ s[c + 3]));
+        s[c] ^= u;
+        s[c + 1] ^= v;
+        s[c + 2] ^= u;
+        s[c + 3] ^= v;
+    }
+    mix_columns(s);
+}
+
+// Row r moves r columns left to encrypt, right to decrypt
+static void shift_rows(unsigned char *s, int right)
+{
+    unsigned char t[BLOCK_BYTES];
+    int i = 0;
+    int shift = 0;
+
+    memcpy(t, s, BLOCK_BYTES);
+    for (i = 0; i < BLOCK_BYTES; i++)
+    {
+        shift = right ? 4 - i % 4 : i % 4;
+        s[i] = t[(i + 4 * shift) % BLOCK_BYTES];
+    }
+}
+
+// Step k of the cipher, and its round
+static int step_of(int k, unsigned char dir, int *round)
+{
+    int pos = 0;
+
+    if (k == 0)
+    {
+        *round = 0;
+        return TRACE_ADD_ROUND_KEY;
+    }
+    *round = (k - 1) / 4 + 1;
+    pos = (k - 1) % 4;
+    if (dir == 0)
+    {
+        return *round == ROUNDS && pos == 2 ? TRACE_ADD_ROUND_KEY : enc_steps[pos];
+    }
+    return dec_steps[pos];
+}
+
+static void apply_step(unsigned char *s, const unsigned char *rk, int step, int round,
+                       unsigned char dir)
+{
+    int i = 0;
+
+    switch (step)
+    {
+    case TRACE_ADD_ROUND_KEY:
+        rk += BLOCK_BYTES * (dir == 0 ? round : ROUNDS - round);
+        for (i = 0; i < BLOCK_BYTES; i++)
+        {
+            s[i] ^= rk[i];
+        }
+        break;
+    case TRACE_SUB_BYTES:
+        for (i = 0; i < BLOCK_BYTES; i++)
+        {
+            s[i] = sbox[s[i]];
+        }
+        break;
+    case TRACE_INV_SUB_BYTES:
+        for (i = 0; i < BLOCK_BYTES; i++)
+        {
+            s[i] = inv_sbox[s[i]];
+        }
+        break;
+    case TRACE_SHIFT_ROWS:
+        shift_rows(s, 0);
+        break;
+    case TRACE_INV_SHIFT_ROWS:
+        shift_rows(s, 1);
+        break;
+    case TRACE_MIX_COLUMNS:
+        mix_columns(s);
+        break;
+    default:
+        inv_mix_columns(s);
+        break;
+    }
+}
+
+AES_TRACE_LOCAL aes_trace *aes_trace_active = 0;
+
+void aes_trace_start(aes_trace *trace)
+{
+    memset(trace->captured, 0, sizeof(trace->captured));
+    aes_trace_active = trace;
+}
+
+// Round r ends with state 4 * r, the last round one step early
+void aes_trace_round(int round, const unsigned char *state)
+{
+    int k = round < ROUNDS ? 4 * round : AES_TRACE_STATES - 1;
+
+    if (aes_trace_active != 0 && round >= 0 && round <= ROUNDS)
+    {
+        memcpy(aes_trace_active->state[k], state, BLOCK_BYTES);
+        aes_trace_active->captured[k] = 1;
+    }
+}
+
+void aes_trace_stop(const unsigned char *output)
+{
+    aes_trace_round(ROUNDS, output);
+    aes_trace_active = 0;
+}
+
+int aes_trace_compare(const aes_trace *trace, const unsigned char *block,
+                      const unsigned char *key, unsigned char dir,
+                      int *round, int *step)
+{
+    unsigned char rk[BLOCK_BYTES * (ROUNDS + 1)];
+    unsigned char s[BLOCK_BYTES];
+    int bytes = 0;
+    int i = 0;
+    int k = 0;
+
+    expand_key(key, rk);
+    memcpy(s, block, BLOCK_BYTES);
+    for (k = 0; k < AES_TRACE_STATES; k++)
+    {
+        *step = step_of(k, dir, round);
+        apply_step(s, rk, *step, *round, dir);
+        if (!trace->captured[k])
+        {
+            continue;
+        }
+        for (i = 0; i < BLOCK_BYTES; i++)
+        {
+            bytes += s[i] != trace->state[k][i];
+        }
+        if (bytes > 0)
+        {
+            return bytes;
+        }
+    }
+    *round = 0;
+    *step = TRACE_CLEAN;
+    return 0;
+}
@@ -0,0 +1,74 @@
+//*****************************************************************************
+//
+// aes_trace.h
+//
+// Round-by-round states of the engine under test, for diagnosing a vector
+// that failed its E or D check.  Built with -DAES_TRACE, aes_test() ciphers
+// such a vector again with the same engine between aes_trace_start() and
+// aes_trace_stop().  An engine with trace hooks (the T-table engine, see
+// aes_ttable.c) hands its state after every round to aes_trace_round() in
+// the meantime; aes_trace_stop() adds the output block, which is all that
+// is seen of an engine without hooks.  aes_trace_compare() then walks the
+// golden trace, which the step-by-step FIPS-197 AES of aes_trace.c computes
+// from the stored vector, to find the first captured state that differs.
+// The result is reported as a TE or TD record (see telemetry.h).
+//
+// The capture is 4 * rounds states of 16 bytes, one for each step of the
+// reference (AddRoundKey, SubBytes, ShiftRows, MixColumns or their
+// inverses): 640 bytes for AES-128, 768 and 896 for AES-192 and AES-256.
+// The engines only show the state that ends each round, so the step
+// reported is the last step of the first round that went wrong.  The
+// hooks cost one test per round while no capture runs, and nothing at all
+// without AES_TRACE.
+//
+//*****************************************************************************
+
+#ifndef AES_TRACE_H
+#define AES_TRACE_H
+
+#ifndef AES_KEY_BITS
+#define     AES_KEY_BITS        128
+#endif
+
+#define     AES_TRACE_ROUNDS    (AES_KEY_BITS / 32 + 6)
+#define     AES_TRACE_STATES    (4 * AES_TRACE_ROUNDS)
+
+// The host threads cipher other vectors while one is traced
+#ifdef AES_THREADS
+#define     AES_TRACE_LOCAL     _Thread_local
+#else
+#define     AES_TRACE_LOCAL
+#endif
+
+typedef struct
+{
+    unsigned char state[AES_TRACE_STATES][16];
+    unsigned char captured[AES_TRACE_STATES];   // nonzero where the engine
+                                                // gave the state
+} aes_trace;
+
+// The trace being captured, or 0
+extern AES_TRACE_LOCAL aes_trace *aes_trace_active;
+
+// Captures the states the engine gives from now on into trace
+void aes_trace_start(aes_trace *trace);
+
+// Engine hook: state is the block after round (0 for the first
+// AddRoundKey), in the byte order of the input.  A decryption round may be
+// one of the equivalent inverse cipher: its state is the same as after the
+// InvMixColumns of the inverse cipher.  Ignored while no capture runs.
+void aes_trace_round(int round, const unsigned char *state);
+
+// Ends the capture with the output block of the engine
+void aes_trace_stop(const unsigned char *output);
+
+// Returns the number of bytes that differ in the first state of trace that
+// was captured and is not the golden one of block ciphered with key in
+// direction dir (0 encrypts, 1 decrypts), with its round and step
+// (TRACE_* in telemetry.h), or 0 with TRACE_CLEAN if every captured state
+// matches
+int aes_trace_compare(const aes_trace *trace, const unsigned char *block,
+                      const unsigned char *key, unsigned char dir,
+                      int *round, int *step);
+
+#endif
@@ -0,0 +1,59 @@
+//*****************************************************************************
+//
+// aes_ttable.h
+//
+// AES with 32 bit T-tables, a drop-in for the TI aes_enc_dec().  Build
+// the AES benchmark with -DAES_TTABLE and aes_ttable.c in place of
+// TI_aes_128.c to use it.  The key is 128 bits unless AES_KEY_BITS says
+// 192 or 256; the longer keys have 12 and 14 rounds, and their schedules
+// take 208 and 240 bytes of stack instead of 176.
+//
+// The tables live in flash by default.  -DAES_TABLES_IN_RAM puts them in
+// RAM instead, to expose them to upsets: the C startup copies them there
+// before main().  The full set of eight 1 KB tables does not fit in the
+// 4 KB of RAM of the MSP430F2619, so in RAM only Te0 and Td0 are kept and
+// the other six are rotations of them (2.5 KB with the two S-boxes).
+//
+//*****************************************************************************
+
+#ifndef AES_TTABLE_H
+#define AES_TTABLE_H
+
+#ifndef AES_KEY_BITS
+#define     AES_KEY_BITS        128
+#endif
+
+#if AES_KEY_BITS != 128 && AES_KEY_BITS != 192 && AES_KEY_BITS != 256
+#error "AES_KEY_BITS must be 128, 192 or 256"
+#endif
+
+#ifdef AES_TABLES_IN_RAM
+#define     AES_ENGINE          "ttable-ram"
+#else
+#define     AES_ENGINE          "ttable-flash"
+#endif
+
+#define     AES_ROUND_KEYS                   // the round-key API below
+#define     AES_KEY_WORDS       (4 * (AES_KEY_BITS / 32 + 7))
+
+// Same contract as the TI code: state is encrypted (dir = 0) or decrypted
+// (dir = 1) in place with the AES_KEY_BITS / 8 byte cipher key.  The key
+// is left alone; the benchmark passes a separate copy to each direction
+// regardless.
+void aes_enc_dec(unsigned char *state, unsigned char *key, unsigned char dir);
+
+// The key schedule of one key, expanded once for any number of blocks:
+// the encryption round keys, and the decryption round keys of the
+// equivalent inverse cipher (in reverse order, InvMixColumns applied).
+// 352 bytes for AES-128, 480 for AES-256.
+typedef struct
+{
+    unsigned long enc[AES_KEY_WORDS];
+    unsigned long dec[AES_KEY_WORDS];
+} aes_round_keys;
+
+void aes_expand_keys(aes_round_keys *keys, const unsigned char *key);
+void aes_encrypt(unsigned char *state, const aes_round_keys *keys);
+void aes_decrypt(unsigned char *state, const aes_round_keys *keys);
+
+#endif
@@ -0,0 +1,113 @@
+//*****************************************************************************
+//
+// aes_vectors.h
+//
+// The NIST known-answer suites the AES benchmark runs.  The data is in
+// aes_kat.h, which tools/aes_kat_gen generates from the NIST .rsp files:
+// adding a suite is a matter of regenerating it.  Only the suites of the
+// key size the engine was built for, AES_KEY_BITS, are compiled in.
+//
+// A record is the key, the plaintext and the ciphertext, packed (48, 56
+// or 64 bytes).  aes_suites[] lists the suites in the order the benchmark
+// runs them as {name, key size, kind, count, records, digest} descriptors,
+// digest being the CRC-32 of the suite's ciphertexts (see aes_test()).  Most
+// suites store every record.  The VarKey and VarTxt suites, a one bit
+// walking through a zero key or plaintext, store only their ciphertexts:
+// aes_record() builds the key and plaintext of vector j from j, so they
+// take a sixth of the flash of the packed records, or less.
+//
+//*****************************************************************************
+
+#ifndef AES_VECTORS_H
+#define AES_VECTORS_H
+
+#include <string.h>
+
+#ifndef AES_KEY_BITS
+#define     AES_KEY_BITS        128
+#endif
+
+#define     AES_BLOCK_BYTES     16
+#define     AES_KEY_BYTES       (AES_KEY_BITS / 8)
+
+// Suite kinds.  In an AES_VARKEY suite the key of vector j has j % n + 1
+// leading one bits, n being the key size in bits, and the plaintext is
+// zero; AES_VARTXT is the same with the plaintext, n = 128, and a zero key.
+#define     AES_PACKED          0
+#define     AES_VARKEY          1
+#define     AES_VARTXT          2
+
+typedef struct
+{
+    const char *name;
+    unsigned char key_bytes;                 // 16, 24 or 32
+    unsigned char kind;
+    unsigned int count;
+    const unsigned char *records;            // count records, or n ciphertexts
+    unsigned long digest;
+} aes_suite;
+
+#define     AES_RECORD_BYTES(suite)     ((suite)->key_bytes + 2 * AES_BLOCK_BYTES)
+#define     AES_RECORD_MAX_BYTES        (AES_KEY_BYTES + 2 * AES_BLOCK_BYTES)
+
+#if defined(__GNUC__) || defined(__TI_COMPILER_VERSION__)
+#define     AES_WORD_ALIGNED    __attribute__((aligned(2)))
+#else
+#define     AES_WORD_ALIGNED
+#endif
+
+// The working copy of one vector in RAM.  key2 is the key for the
+// decryption (the TI code overwrites the key it is given) and input is
+// the block that is ciphered in place.  Every field is an even number of
+// bytes and the struct is word aligned, so check_arrays() can compare the
+// blocks a word at a time.
+typedef struct AES_WORD_ALIGNED
+{
+    unsigned char key[AES_KEY_BYTES];
+    unsigned char key2[AES_KEY_BYTES];
+    unsigned char cipher[AES_BLOCK_BYTES];
+    unsigned char plain[AES_BLOCK_BYTES];
+    unsigned char input[AES_BLOCK_BYTES];
+} aes_vector;
+
+#include "aes_kat.h"
+
+#define     AES_SUITES          (sizeof(aes_suites) / sizeof(aes_suites[0]))
+
+// Record j of suite.  A stored record is returned where it is; the record
+// of a VarKey or VarTxt vector is built in buffer (AES_RECORD_MAX_BYTES)
+// and buffer is returned.
+static inline const unsigned char *aes_record(const aes_suite *suite, unsigned int j,
+                                              unsigned char *buffer)
+{
+    unsigned char *ones = buffer;
+    unsigned int n = 8 * suite->key_bytes;
+    unsigned int bits = 0;
+    unsigned int i = 0;
+
+    if (suite->kind == AES_PACKED)
+    {
+        return suite->records + j * AES_RECORD_BYTES(suite);
+    }
+    if (suite->kind == AES_VARTXT)
+    {
+        ones = buffer + suite->key_bytes;
+        n = 8 * AES_BLOCK_BYTES;
+    }
+
+    j %= n;
+    memset(buffer, 0, suite->key_bytes + AES_BLOCK_BYTES);
+    for (bits = j + 1; bits >= 8; bits -= 8)
+    {
+        ones[i++] = 0xFF;
+    }
+    if (bits > 0)
+    {
+        ones[i] = (unsigned char) (0xFF00U >> bits);
+    }
+    memcpy(buffer + suite->key_bytes + AES_BLOCK_BYTES,
+           suite->records + j * AES_BLOCK_BYTES, AES_BLOCK_BYTES);
+    return buffer;
+}
+
+#endif
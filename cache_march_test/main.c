@@ -11,17 +11,36 @@
 // testing for filling the memory array.  There are four different memory patterns in the
 // pattern file: 0x0, 0xFFFF, 0x5555, 0xAAAA.  Unlike the other benchmarks, the  memory
 // array can change size or values with only a simple change to the number of data_array_elements.
-// The pattern is hard coded into the test.  
+// The march is a table run by the engine in ../memtest/march.c, which needs to be
+// compiled with the test.  The original march is the default; -DMARCH=MARCH_C_MINUS
+// (or MARCH_X, MARCH_Y, MARCH_MATS_PLUS, MARCH_SS) selects another one, and on Linux
+// BENCH_MARCH=<name> does at run time.  The march is named in the YAML header.
+// The elements walk the array in linear order by default; -DADDR_ORDER=ADDR_GRAY
+// (or ADDR_COMPLEMENT, ADDR_STRIDE, ADDR_LFSR) compiles in only that order, and on
+// Linux BENCH_ORDER=<name> selects one at run time.  The order is in the header too.
 //
 // The test code now also does double reads on error to check to see if there is an error
 // in address decoding for the array under test or the pattern.  For the MSP430F2619 these
-// double reads help determine whether the problem is in flash or static memory.
+// double reads help determine whether the problem is in flash or static memory.  They are
+// classified like those of the static cache test, by ../memtest/double_read.c with the
+// expected word for both pattern reads, and the heartbeat counts each class.  The words
+// that failed in a pass are also reported as the bits that flipped, with the runs of
+// adjacent words among them, by ../memtest/flip.c.
+//
+// With -DSCRUB (and ../memtest/scrub.c) the array is scrubbed incrementally, as in the
+// static cache test: the slice timer wakes the test every SCRUB_PERIOD_US microseconds
+// to run the whole march over the next SCRUB_WORDS words, and it sleeps in between.
+// Each slice with errors ends with an "L" record, the longest the errors can have gone
+// unseen; the heartbeat counts slices that overran their period.  The bound holds for
+// a march that reads before it writes, like the original one; one that starts with an
+// initializing write only finds what goes wrong while it runs.  On Linux,
+// BENCH_SCRUB_WORDS and BENCH_SCRUB_US override the two, and the header gives both.
 //
 // This software is otimized for TI microcontrollers, specifically the
 // MSP430F2619.
 //
 // The output is designed to go out the UART at a speed of 9,600 baud and uses a
-// tiny printf to reduce printf footprint.  The tiny printf can be downloaded from 
+// tiny printf to reduce printf footprint.  The tiny printf in the platform layer follows 
 // http://www.43oh.com/forum/viewtopic.php?f=10&t=1732  All of the output is YAML
 // parsable.
 //
@@ -30,16 +49,23 @@
 
 
 
-#include <msp430.h>
-#include <string.h>
-#include "stdio.h"
+#ifdef PLATFORM_POSIX
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+#include "platform.h"
+#include "telemetry.h"
+#include "march.h"
+#include "double_read.h"
+#include "flip.h"
+#ifdef SCRUB
+#include "scrub.h"
+#endif
 
 void printHeader(void);
-void sendByte(char);
-void initUART(void);
-void initMSP430();
 
-#define     robust_printing         1
+#define     robust_printing         PRINTING_ADAPTIVE
 #define     data_array_elements     848
 
 int array[data_array_elements];
@@ -48,6 +74,18 @@ unsigned long int ind = 0;
 int local_errors = 0;
 int sum_errors = 0;
 int in_block = 0;
+int robust = -1;                    // decided once per check
+const march_test *march = &marches[MARCH];
+#ifdef ADDR_ORDER
+int order = ADDR_ORDER;
+#else
+int order = ADDR_LINEAR;
+#endif
+#ifdef SCRUB
+int scrub_words = SCRUB_WORDS;
+unsigned long scrub_period = SCRUB_PERIOD_US;
+int slice_first = 0;                // the index of word 0 of the slice
+#endif
 
 void init_array(int *array)
 {
@@ -60,103 +98,127 @@ void init_array(int *array)
     }
 }
 
+void report_double_read(int de_class, int sarr_val1, int sarr_val2)
+{
+    int reads[2] = { sarr_val1, sarr_val2 };
+
+    if (robust < 0)
+    {
+        robust = robustPrinting(robust_printing, ind);
+    }
+    if (robust)
+    {
+        reportIteration(ind);
+        reportDecoderError(de_class, reads, 2);
+    }
+}
+
+void report_mismatch(int index, unsigned int expected, unsigned int read1,
+                     unsigned int read2)
+{
+    int de_class = dr_classify_sarr((int) read1, (int) read2);
+
+    report_double_read(de_class, (int) read1, (int) read2);
+#ifdef SCRUB
+    index += slice_first;
+#endif
+    // the read that differs, the first one unless it was right
+    flip_word(index, expected, read1 != expected ? read1 : read2);
+}
+
 int check_array(int *array)
 {
-    int i = 0;
-    int first_error = 0;
     int numberOfErrors = 0;
 
-    for (i = 0; i < data_array_elements; i++)
-        {
+    robust = -1;
+    flip_begin();
+    numberOfErrors = march_run(march, order, array, data_array_elements, report_mismatch);
 
-            int sarr_val1 = array[i];
-            int sarr_val2 = array[i];
-            if (sarr_val1 != 0 || sarr_val2 != 0) //there is either an SEU or SET
-            {
-                numberOfErrors++;
-                if (sarr_val1 == sarr_val2) //second read doesn't match either
-                {
-                    printf(" - i: %u\r\n", ind);
-                    printf("   SARR_SEU: {%i: %i}\n\r", sarr_val1, sarr_val2);
-                }
-                else
-                {
-                    printf(" - i: %u\r\n", ind);
-                    printf("   SET: {%i: %i}\n\r", sarr_val1, sarr_val2);
-                }
-            }
-            array[i] = 0xFFFF;
-        }
+    if (!robust && numberOfErrors > 0)
+    {
+        reportIteration(ind);
+        reportCount('E', numberOfErrors);
+    }
+    if (robust > 0)
+    {
+        flip_report(ind, 0);
+    }
+    local_errors += numberOfErrors;
 
-        for (i = data_array_elements - 1; i > -1; i--)
-        {
+    return 1;
+
+}
+
+#ifdef SCRUB
+// Runs the march over one slice of the scrub, and bounds how long its errors went
+// unseen
+void scrub_slice(int *array, int first, int last)
+{
+    int numberOfErrors = 0;
 
-            int sarr_val1 = array[i];
-            int sarr_val2 = array[i];
-            if (sarr_val1 != 0xFFFF || sarr_val2 != 0xFFFF) //there is either an SEU or SET
-            {
-                numberOfErrors++;
-                if (sarr_val1 == sarr_val2) //second read doesn't match either
-                {
-                    printf(" - i: %u\r\n", ind);
-                    printf("   SARR_SEU: {%i: %i}\n\r", sarr_val1, sarr_val2);
-                }
-                else
-                {
-                    printf(" - i: %u\r\n", ind);
-                    printf("   SET: {%i: %i}\n\r", sarr_val1, sarr_val2);
-                }
-            }
-            array[i] = 0xAAAA;
+    robust = -1;
+    flip_begin();
+    slice_first = first;
+    numberOfErrors = march_run(march, order, array + first, last - first, report_mismatch);
+
+    if (numberOfErrors > 0)
+    {
+        if (!robust)
+        {
+            reportIteration(ind);
+            reportCount('E', numberOfErrors);
         }
-        for (i = 0; i < data_array_elements; i++)
+        else
         {
+            flip_report(ind, 0);
+        }
+        reportLatency(scrub_latency());
+    }
+    local_errors += numberOfErrors;
+}
+
+// A pass is one round of the slices, so ind counts passes as it does below
+void cache_test(void)
+{
+    int first = 0;
+    int last = 0;
+    int total_errors = 0;
+    int tests_with_errors = 0;
 
-            int sarr_val1 = array[i];
-            int sarr_val2 = array[i];
-            if (sarr_val1 != 0xAAAA || sarr_val2 != 0xAAAA) //there is either an SEU or SET
-            {
-                numberOfErrors++;
-                if (sarr_val1 == sarr_val2) //second read doesn't match either
-                {
-                    printf(" - i: %u\r\n", ind);
-                    printf("   SARR_SEU: {%i: %i}\n\r", sarr_val1, sarr_val2);
-                }
-                else
-                {
-                    printf(" - i: %u\r\n", ind);
-                    printf("   SET: {%i: %i}\n\r", sarr_val1, sarr_val2);
-                }
-            }
-            array[i] = 0x5555;
+    init_array(array);
+    scrub_start(data_array_elements, scrub_words, scrub_period);
+
+    while (1)
+    {
+        int pass_done = scrub_next(&first, &last);
+
+        scrub_slice(array, first, last);
+        if (!pass_done)
+        {
+            continue;
         }
 
-        for (i = data_array_elements - 1; i > -1; i--)
+        if (ind % 60 == 0)
         {
+            int counters[4 + DE_CLASSES] = { total_errors, tests_with_errors,
+                                             sum_errors, (int) scrub_overruns() };
 
-            int sarr_val1 = array[i];
-            int sarr_val2 = array[i];
-            if (sarr_val1 != 0x5555 || sarr_val2 != 0x5555) //there is either an SEU or SET
-            {
-                numberOfErrors++;
-                if (sarr_val1 == sarr_val2) //second read doesn't match either
-                {
-                    printf(" - i: %u\r\n", ind);
-                    printf("   SARR_SEU: {%i: %i}\n\r", sarr_val1, sarr_val2);
-                }
-                else
-                {
-                    printf(" - i: %u\r\n", ind);
-                    printf("   SET: {%i: %i}\n\r", sarr_val1, sarr_val2);
-                }
-            }
-            array[i] = 0x0;
+            initUART();
+            reportHeartbeat(ind, counters, 4 + dr_counters(counters + 4));
         }
 
-    return 1;
-
+        ind++;
+        iterationDone();
+        total_errors += local_errors;
+        if (local_errors > 0)
+        {
+            tests_with_errors++;
+        }
+        local_errors = 0;
+        in_block = 0;
+    }
 }
-
+#else
 void cache_test(void)
 {
 
@@ -174,12 +236,15 @@ void cache_test(void)
 
         if (ind % 60 == 0)
         {
+            int counters[3 + DE_CLASSES] = { total_errors, tests_with_errors,
+                                             sum_errors };
+
             initUART();
-            printf("# %u, %i, %i, %i\r\n", ind, total_errors, tests_with_errors,
-                   sum_errors);
+            reportHeartbeat(ind, counters, 3 + dr_counters(counters + 3));
         }
 
         ind++;
+        iterationDone();
         total_errors += local_errors;
         if (local_errors > 0)
         {
@@ -189,106 +254,62 @@ void cache_test(void)
         in_block = 0;
     }
 }
+#endif
 
 int main(void)
 {
+#ifdef PLATFORM_POSIX
+    const char *name = getenv("BENCH_MARCH");
+
+    if (name != NULL)
+    {
+        march = march_find(name);
+        if (march == NULL)
+        {
+            fprintf(stderr, "cache_march: no march called %s\n", name);
+            return 1;
+        }
+    }
+#ifndef ADDR_ORDER
+    name = getenv("BENCH_ORDER");
+    if (name != NULL)
+    {
+        order = addr_order_find(name);
+        if (order < 0)
+        {
+            fprintf(stderr, "cache_march: no address order called %s\n", name);
+            return 1;
+        }
+    }
+#endif
+#ifdef SCRUB
+    if (getenv("BENCH_SCRUB_WORDS"))
+    {
+        scrub_words = atoi(getenv("BENCH_SCRUB_WORDS"));
+    }
+    if (getenv("BENCH_SCRUB_US"))
+    {
+        scrub_period = strtoul(getenv("BENCH_SCRUB_US"), 0, 10);
+    }
+#endif
+#endif
 
-    initMSP430();
+    initPlatform();
 
     printf("\n\r---\n\r");
-    printf("hw: MSP430F2619\r\n");
+    printf("hw: %s\r\n", PLATFORM_HW);
     printf("test: cache_march\r\n");
     printf("mit: none\r\n");
     printf("printing: %i\r\n", robust_printing);
     printf("Array size: %i\r\n", data_array_elements);
-    printf("ver: 1.0\r\n");
+    printf("march: %s\r\n", march->name);
+    printf("order: %s\r\n", addr_order_names[order]);
+#ifdef SCRUB
+    printf("scrub: %i words every %n us\r\n", scrub_words, scrub_period);
+#endif
+    printf("ver: 1.1\r\n");
     printf("fac: LANSCE Oct 2019\r\n");
     printf("d:\r\n");
 
     cache_test();
 }
-
-void initMSP430()
-{
-//MSP430F2619 initialization code
-    WDTCTL = WDTPW + WDTHOLD;
-
-    if (CALBC1_1MHZ == 0xFF)				// If calibration constant erased
-    {
-        while (1)
-            ;                               // do not load, trap CPU!!
-    }
-    DCOCTL = 0;                          // Select lowest DCOx and MODx settings
-    BCSCTL1 = CALBC1_1MHZ;                    // Set DCO
-    DCOCTL = CALDCO_1MHZ;
-
-    initUART();
-}
-
-/**
- * Initializes the UART for 9600 baud with a RX interrupt
- **/
-void initUART(void)
-{
-
-    P3SEL = 0x30;                             // P3.4,5 = USCI_A0 TXD/RXD
-    UCA0CTL1 |= UCSSEL_2;                     // SMCLK
-    UCA0BR0 = 104;                           // 1MHz 9600; (104)decimal = 0x068h
-    UCA0BR1 = 0;                              // 1MHz 9600
-    UCA0MCTL = UCBRS0;                        // Modulation UCBRSx = 1
-    UCA0CTL1 &= ~UCSWRST;                   // **Initialize USCI state machine**
-//IE2 |= UCA0RXIE; 						  // Enable USCI_A0 RX interrupt
-}
-
-/**
- * puts() is used by printf() to display or send a string.. This function
- * determines where printf prints to. For this case it sends a string
- * out over UART, another option could be to display the string on an
- * LCD display.
- **/
-int puts(const char *_ptr)
-{
-    unsigned int i, len;
-
-    len = strlen(_ptr);
-
-    for (i = 0; i < len; i++)
-    {
-        sendByte(_ptr[i]);
-    }
-
-    return len;
-}
-/**
- * puts() is used by printf() to display or send a character. This function
- * determines where printf prints to. For this case it sends a character
- * out over UART.
- **/
-int putc(int _x, FILE *_fp)
-{
-    sendByte(_x);
-
-    return _x;
-}
-
-/**
- * Sends a single byte out through UART
- **/
-void sendByte(char byte)
-{
-    while (!(IFG2 & UCA0TXIFG))
-        ; // USCI_A0 TX buffer ready?
-    UCA0TXBUF = byte; // TX -> RXed character
-}
-
-//  Echo back RXed character, confirm TX buffer is ready first
-#pragma vector=USCIAB0RX_VECTOR
-__interrupt void USCI0RX_ISR(void)
-{
-
-    while (!(IFG2 & UCA0TXIFG))
-        ;                // USCI_A0 TX buffer ready?
-    UCA0TXBUF = UCA0RXBUF;                    // TX -> RXed character
-}
-
-
@@ -58,11 +58,30 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 // Keep in mind that the sum checker is hardcoded.  If the memory arrays change
 // size or values, it is necessary to change the sum values, too.
 //
+// With -DSIGNATURE_CHECK (and -I../memtest, ../memtest/signature.c) each pass folds
+// the array into a running signature instead, and compares it with the signature of
+// the pattern.  The element-by-element check and the sum only run when they differ.
+// A signature that differs while the elements and the sum are right is reported as a
+// sum error.  The header's "check" field is "signature" or "compare".
+//
+// The elements that failed in a pass are also reported as the bits that flipped, with
+// the runs of adjacent elements among them, by ../memtest/flip.c, which needs
+// -I../memtest and to be compiled with the test.
+//
+// With -DSCRUB (and ../memtest/scrub.c) the array is scrubbed incrementally, as in the
+// static cache test: the slice timer wakes the test every SCRUB_PERIOD_US microseconds
+// to check the next SCRUB_WORDS elements, and it sleeps in between.  Each slice with
+// errors is reported under its own " - i:" item and ends with an "L" record, the longest
+// the errors can have gone unseen.  The sum is added up over the slices of a pass and
+// checked when the pass ends.  The heartbeat counts slices that overran their period.
+// On Linux, BENCH_SCRUB_WORDS and BENCH_SCRUB_US override the two.  The "check" field
+// is then "scrub".
+//
 // This software is otimized for TI microcontrollers, specifically the
 // MSP430F2619.
 //
 // The output is designed to go out the UART at a speed of 9,600 baud and uses a
-// tiny printf to reduce printf footprint.  The tiny printf can be downloaded from 
+// tiny printf to reduce printf footprint.  The tiny printf in the platform layer follows 
 // http://www.43oh.com/forum/viewtopic.php?f=10&t=1732  All of the output is YAML
 // parsable.
 //
@@ -70,18 +89,30 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 //*****************************************************************************
 
 
-#include <msp430.h>
-#include <string.h>
+#if defined(SCRUB) && defined(PLATFORM_POSIX)
+#include <stdlib.h>
+#endif
+
+#include "platform.h"
+#include "telemetry.h"
+#include "flip.h"
+#ifdef SIGNATURE_CHECK
+#include "signature.h"
+#endif
+#ifdef SCRUB
+#ifdef SIGNATURE_CHECK
+#error "SCRUB checks its slices element by element; build it without SIGNATURE_CHECK"
+#endif
+#include "scrub.h"
+#endif
 
-void sendByte(char);
-void printf(char *, ...);
-void initUART(void);
-void initMSP430();
 void cache_test(void);
 void init_array(int array[]);
+int check_elements(int array[], int first, int last, int *sum);
+void check_sum(int sum);
 int calc_sum(int array[]);
 
-#define 	robust_printing			1
+#define 	robust_printing			PRINTING_ADAPTIVE
 #define		data_array_elements		600
 #define		sum_const				-16908
 
@@ -91,6 +122,16 @@ unsigned long int ind = 0;
 int local_errors = 0;
 int sum_errors = 0;
 int in_block = 0;
+#ifdef SIGNATURE_CHECK
+#define		CHECK_MODE				"signature"
+signature golden;						// of the pattern
+#elif defined(SCRUB)
+#define		CHECK_MODE				"scrub"
+int scrub_words = SCRUB_WORDS;
+unsigned long scrub_period = SCRUB_PERIOD_US;
+#else
+#define		CHECK_MODE				"compare"
+#endif
 
 void init_array(int *array) {
 	int i = 0;
@@ -102,63 +143,81 @@ void init_array(int *array) {
 	}
 }
 
-int calc_sum(int *array) {
+//Checks elements first to last - 1, adds them to *sum and rewrites the ones
+//that are wrong.  Returns the number of errors.
+int check_elements(int *array, int first, int last, int *sum) {
 	int i = 0;
-	int sum = 0;
+	int partial = 0;
 	int first_error = 0;
+	int robust = -1;
 	int numberOfErrors = 0;
 
-	for ( i = 0; i < data_array_elements; i++)
+	flip_begin();
+	for ( i = first; i < last; i++)
 	{
-		sum += array[i];
+		partial += array[i];
 
 		if ( array[i] != i )
 		{
 			numberOfErrors++;
 
+			// printing is decided at the first mismatch, by the output budget
+			if (robust < 0) {
+				robust = robustPrinting(robust_printing, ind);
+			}
 			if (!first_error) {
-				if (!in_block && robust_printing) {
-					printf(" - i: %n\r\n", ind);
-					printf("   E: {%i: %i,", i, array[i]);
+				if (!in_block && robust) {
+					reportIteration(ind);
+					reportElementIndexValue('E', 1, i, array[i]);
 					first_error = 1;
 					in_block = 1;
 
 				}
-				else if (in_block && robust_printing){
-					printf("   E: {%i: %i,", i, array[i]);
+				else if (in_block && robust){
+					reportElementIndexValue('E', 1, i, array[i]);
 					first_error = 1;
 				}
 			}
 			else{
-				if (robust_printing)
-					printf("%i: %i,", i, array[i]);
+				if (robust)
+					reportElementIndexValue('E', 0, i, array[i]);
 			}
 
 			//printf("* E,%i,%i\r\n", i, array[i]);
 
+			flip_word(i, i, array[i]);
 			array[i] = i;
 			local_errors++;
 		}
 
 	}
+	*sum += partial;
 
-	if (first_error && robust_printing) {
-		printf("}\r\n");
+	if (first_error && robust) {
+		reportElementsEnd();
 		first_error = 0;
 	}
 
-	if (!robust_printing && numberOfErrors > 0) {
+	if (!robust && numberOfErrors > 0) {
 		if (!in_block) {
-			printf(" - i: %n\r\n", ind);
-			printf("   E: %i\r\n", numberOfErrors);
+			reportIteration(ind);
+			reportCount('E', numberOfErrors);
 			in_block = 1;
 		}
 		else {
-			printf("   E: %i\r\n", numberOfErrors);
+			reportCount('E', numberOfErrors);
 		}
 	}
+	if (robust > 0) {
+		flip_report(ind, in_block);
+	}
+	return numberOfErrors;
+}
 
-	if (sum != sum_const) {
+//Compares the sum of every element with the hardcoded one
+void check_sum(int sum) {
+	//sum_const is the 16 bit sum, so compare at that width on wider ints too
+	if ((short) sum != sum_const) {
 		//the difference between robust and not robust printing is trivial for this one, so let it go
 
 		//only count sum errors if there have been no other errors
@@ -167,23 +226,96 @@ int calc_sum(int *array) {
 			local_errors++;
 
 			if (!in_block) {
-				printf(" - i: %n\r\n", ind);
-				printf("   S: {%i: %i}\r\n", sum_const, sum);
-				first_error = 1;
+				reportIteration(ind);
+				reportSum(sum_const, sum);
 				in_block = 1;
 
 			}
 			else if (in_block){
-				printf("   S: {%i: %i}\r\n", sum_const, sum);
-				first_error = 1;
+				reportSum(sum_const, sum);
 			}
 		}
 	}
+}
 
+int calc_sum(int *array) {
+	int sum = 0;
+#ifdef SIGNATURE_CHECK
+	signature sig;
+
+	signature_init(&sig);
+	signature_fold(&sig, array, data_array_elements);
+	if (signature_equal(&sig, &golden)) {
+		return sum_const;
+	}
+#endif
+
+	check_elements(array, 0, data_array_elements, &sum);
+	check_sum(sum);
+
+#ifdef SIGNATURE_CHECK
+	//every element and the sum are right, so the upset was in the fold
+	if (local_errors == 0) {
+		sum_errors++;
+		local_errors++;
+
+		if (!in_block) {
+			reportIteration(ind);
+			in_block = 1;
+		}
+		reportSum((int) signature_value(&golden), (int) signature_value(&sig));
+	}
+#endif
 
 	return sum;
 }
 
+#ifdef SCRUB
+//A pass is one round of the slices, so ind counts passes as it does below.
+//Each slice with errors gets an item of its own, with the latency bound.
+void cache_test(void) {
+	int first = 0;
+	int last = 0;
+	int sum = 0;
+	int total_errors = 0;
+	int tests_with_errors = 0;
+
+	init_array(array);
+	scrub_start(data_array_elements, scrub_words, scrub_period);
+
+	while (1) {
+		int pass_done = scrub_next(&first, &last);
+
+		if (check_elements(array, first, last, &sum) > 0) {
+			reportLatency(scrub_latency());
+			in_block = 0;
+		}
+		if (!pass_done) {
+			continue;
+		}
+
+		check_sum(sum);
+		sum = 0;
+
+		if (ind % 1000 == 0 && ind != 0) {
+			int counters[] = { total_errors, tests_with_errors, sum_errors,
+					   (int) scrub_overruns() };
+
+			initUART();
+			reportHeartbeat(ind, counters, 4);
+		}
+
+		ind++;
+		iterationDone();
+		total_errors += local_errors;
+		if (local_errors > 0) {
+			tests_with_errors++;
+		}
+		local_errors = 0;
+		in_block = 0;
+	}
+}
+#else
 void cache_test(void) {
 	//int data_array[data_array_elements];
 	int sum = 0;
@@ -198,11 +330,14 @@ void cache_test(void) {
 		sum = calc_sum(array);
 
 		if (ind % 1000 == 0 && ind != 0) {
+			int counters[] = { total_errors, tests_with_errors, sum_errors };
+
 			initUART();
-			printf("# %n, %i, %i, %i\r\n", ind, total_errors, tests_with_errors, sum_errors);
+			reportHeartbeat(ind, counters, 3);
 		}
 
 		ind++;
+		iterationDone();
 		total_errors += local_errors;
 		if (local_errors > 0) {
 			tests_with_errors++;
@@ -211,19 +346,41 @@ void cache_test(void) {
 		in_block = 0;
 	}
 }
+#endif
 
 
 int main(void)
 {
+#ifdef SIGNATURE_CHECK
+	int i = 0;
+
+	signature_init(&golden);
+	for ( i = 0; i < data_array_elements; i++ )
+	{
+		signature_word(&golden, i, i);
+	}
+#endif
+#if defined(SCRUB) && defined(PLATFORM_POSIX)
+	if (getenv("BENCH_SCRUB_WORDS")) {
+		scrub_words = atoi(getenv("BENCH_SCRUB_WORDS"));
+	}
+	if (getenv("BENCH_SCRUB_US")) {
+		scrub_period = strtoul(getenv("BENCH_SCRUB_US"), 0, 10);
+	}
+#endif
 
-	initMSP430();
+	initPlatform();
 
 	printf("\r\n---\r\n");
-	printf("hw: msp430f2619\r\n");
+	printf("hw: %s\r\n", PLATFORM_HW);
 	printf("test: cache\r\n");
 	printf("mit: none\r\n");
 	printf("printing: %i\r\n", robust_printing);
 	printf("Array size: %i\r\n", data_array_elements);
+	printf("check: %s\r\n", CHECK_MODE);
+#ifdef SCRUB
+	printf("scrub: %i words every %n us\r\n", scrub_words, scrub_period);
+#endif
 	printf("ver: 1.0\r\n");
 	printf("fac: LANSCE Nov 2015\r\n");
 	printf("d:\r\n");
@@ -232,72 +389,3 @@ int main(void)
 
 
 }
-
-void initMSP430() {
-	//MSP430F2619 initialization code
-	WDTCTL = WDTPW + WDTHOLD;                 // Stop WDT
-	if (CALBC1_1MHZ==0xFF)					// If calibration constant erased
-	{
-		while(1);                               // do not load, trap CPU!!
-	}
-	DCOCTL = 0;                               // Select lowest DCOx and MODx settings
-	BCSCTL1 = CALBC1_1MHZ;                    // Set DCO
-	DCOCTL = CALDCO_1MHZ;
-
-	initUART();
-}
-
-/**
- * Initializes the UART for 9600 baud with a RX interrupt
- **/
-void initUART(void) {
-
-	P3SEL = 0x30;                             // P3.4,5 = USCI_A0 TXD/RXD
-	UCA0CTL1 |= UCSSEL_2;                     // SMCLK
-	UCA0BR0 = 104;                            // 1MHz 9600; (104)decimal = 0x068h
-	UCA0BR1 = 0;                              // 1MHz 9600
-	UCA0MCTL = UCBRS0;                        // Modulation UCBRSx = 1
-	UCA0CTL1 &= ~UCSWRST;                     // **Initialize USCI state machine**
-	//IE2 |= UCA0RXIE; 						  // Enable USCI_A0 RX interrupt
-}
-
-/**
- * puts() is used by printf() to display or send a string.. This function
- * determines where printf prints to. For this case it sends a string
- * out over UART, another option could be to display the string on an
- * LCD display.
- **/
-void puts(char *s) {
-	char c;
-
-	// Loops through each character in string 's'
-	while (c = *s++) {
-		sendByte(c);
-	}
-}
-/**
- * puts() is used by printf() to display or send a character. This function
- * determines where printf prints to. For this case it sends a character
- * out over UART.
- **/
-void putc(char b) {
-	sendByte(b);
-}
-
-/**
- * Sends a single byte out through UART
- **/
-void sendByte(char byte )
-{
-	while (!(IFG2&UCA0TXIFG)); // USCI_A0 TX buffer ready?
-	UCA0TXBUF = byte; // TX -> RXed character
-}
-
-//  Echo back RXed character, confirm TX buffer is ready first
-#pragma vector=USCIAB0RX_VECTOR
-__interrupt void USCI0RX_ISR(void)
-{
-
-	while (!(IFG2&UCA0TXIFG));                // USCI_A0 TX buffer ready?
-	UCA0TXBUF = UCA0RXBUF;                    // TX -> RXed character
-}
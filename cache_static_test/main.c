@@ -11,22 +11,46 @@
 // for filling the memory array.  There are four different memory patterns in the
 // pattern file: mostly zeros, mostly ones, most As, and mostly 5s.  Each value has
 // the address encoded so that it is possible to tell whether the memory address
-// decoder had a fault on reading, and pulled the wrong address.  If the memory arrays change
-// size or values, it is necessary to change the pattern, too.  The pattern includes
+// decoder had a fault on reading, and pulled the wrong address.  The array is the size
+// of the pattern; to change its size or values, generate pattern.h again with
+// tools/pattern_gen (the rule is in ../memtest/pattern_rule.h).  The pattern includes
 // three versions of the pattern: in memory blocks, sorted forward, and reverse sorted.
 // In this manner the same pattern can be used for this test and quicksort.  The checker
 // software is simplified by this code by completing a compare between the static memory
 // and the flash memory.
 //
+// With -DPATTERN_ARITHMETIC (and -I../memtest) the pattern is not read from flash:
+// each expected value is computed from its index, the block's background XOR the
+// address, so a pass reads SRAM only and an upset in the flash table cannot look like
+// one in SRAM.  The "flash" reads of the double-read check are then recomputations.
+// The header's "pattern" field says which mode ran.
+//
+// With -DSIGNATURE_CHECK (and ../memtest/signature.c) a pass folds the array into a
+// running signature and compares it with the signature of the pattern; the word-by-word
+// check only runs when they differ, to find and report the words.  A signature that
+// differs while every word is right is reported as a sum error.  The header's "check"
+// field is "signature" or "compare".
+//
+// With -DSCRUB (and ../memtest/scrub.c) the array is scrubbed incrementally: the
+// slice timer wakes the test every SCRUB_PERIOD_US microseconds to check the next
+// SCRUB_WORDS words, and it sleeps in between.  Each slice with errors ends with an
+// "L" record, the longest the errors can have gone unseen; the heartbeat counts slices
+// that overran their period.  On Linux, BENCH_SCRUB_WORDS and BENCH_SCRUB_US override
+// the two.  The "check" field is then "scrub".
+//
 // The test code now also does double reads on error to check to see if there is an error
 // in address decoding for the array under test or the pattern.  For the MSP430F2619 these
-// double reads help determine whether the problem is in flash or static memory.
+// double reads help determine whether the problem is in flash or static memory.  The
+// reads are classified by the table in ../memtest/double_read.c, which needs -I../memtest
+// and to be compiled with the test; the heartbeat carries a count for each class.
+// The words that failed are also reported as the bits that flipped, with the runs of
+// adjacent words among them, by ../memtest/flip.c.
 //
 // This software is otimized for TI microcontrollers, specifically the
 // MSP430F2619.
 //
 // The output is designed to go out the UART at a speed of 9,600 baud and uses a
-// tiny printf to reduce printf footprint.  The tiny printf can be downloaded from 
+// tiny printf to reduce printf footprint.  The tiny printf in the platform layer follows 
 // http://www.43oh.com/forum/viewtopic.php?f=10&t=1732  All of the output is YAML
 // parsable.
 //
@@ -34,19 +58,55 @@
 //*****************************************************************************
 
 
-#include <msp430.h>
-#include <string.h>
-#include "stdio.h"
+#if defined(SCRUB) && defined(PLATFORM_POSIX)
+#include <stdlib.h>
+#endif
 
+#include "platform.h"
+#include "telemetry.h"
+#include "double_read.h"
+#include "flip.h"
+
+#ifdef PATTERN_ARITHMETIC
+#include "pattern_rule.h"
+#else
 #include "pattern.h"
+#endif
+#ifdef SIGNATURE_CHECK
+#include "signature.h"
+#endif
+#ifdef SCRUB
+#ifdef SIGNATURE_CHECK
+#error "SCRUB checks its slices word by word; build it without SIGNATURE_CHECK"
+#endif
+#include "scrub.h"
+#endif
 
 void printHeader(void);
-void sendByte(char);
-void initUART(void);
-void initMSP430();
 
-#define     robust_printing         1
+#define     robust_printing         PRINTING_ADAPTIVE
+#ifdef PATTERN_ARITHMETIC
 #define     data_array_elements     848
+#else
+#define     data_array_elements     PATTERN_ELEMENTS    // 848
+#endif
+
+#ifdef PATTERN_ARITHMETIC
+#define     PATTERN_MODE            "xor"
+#define     backgrounds             4
+#define     block_elements          PATTERN_BLOCK(data_array_elements, backgrounds)
+
+const unsigned int background[backgrounds] = PATTERN_BACKGROUNDS;
+
+// The pattern word at index i, computed instead of read from flash
+int pattern_at(int i)
+{
+    return PATTERN_INT(PATTERN_WORD(PATTERN_XOR, background[i / block_elements], i, 0));
+}
+#else
+#define     PATTERN_MODE            "flash"
+#define     pattern_at(i)           static_pattern[i]
+#endif
 
 int array[data_array_elements];
 
@@ -54,6 +114,17 @@ unsigned long int ind = 0;
 int local_errors = 0;
 int sum_errors = 0;
 int in_block = 0;
+int robust = -1;                    // decided once per check
+#ifdef SIGNATURE_CHECK
+#define     CHECK_MODE              "signature"
+signature golden;                   // of the pattern
+#elif defined(SCRUB)
+#define     CHECK_MODE              "scrub"
+int scrub_words = SCRUB_WORDS;
+unsigned long scrub_period = SCRUB_PERIOD_US;
+#else
+#define     CHECK_MODE              "compare"
+#endif
 
 void init_array(int *array)
 {
@@ -61,122 +132,209 @@ void init_array(int *array)
 
     for (i = 0; i < data_array_elements; i++)
     {
-        array[i] = static_pattern[i];
+        array[i] = pattern_at(i);
 
     }
 }
 
-int calc_sum(int *array)
+void report_double_read(int de_class, int sarr_val1, int farr_val1,
+                        int sarr_val2, int farr_val2)
+{
+    int reads[4] = { sarr_val1, farr_val1, sarr_val2, farr_val2 };
+
+    if (robust < 0)
+    {
+        robust = robustPrinting(robust_printing, ind);
+    }
+    if (robust)
+    {
+        reportIteration(ind);
+        reportDecoderError(de_class, reads, 4);
+    }
+}
+
+// Reads a word that did not match the pattern again, with the pattern, to tell
+// an upset in SRAM from one in the pattern and from address decoder errors
+// (../memtest/double_read.c has the classes), reports it and writes the pattern
+// back.  Returns the number of errors.
+int check_word(int *array, int i, int sarr_val1, int farr_val1)
+{
+    int sarr_val2 = array[i];
+    int farr_val2 = pattern_at(i);
+    int de_class = dr_classify(sarr_val1, farr_val1, sarr_val2, farr_val2);
+
+    if (de_class != DE_NONE)
+    {
+        report_double_read(de_class, sarr_val1, farr_val1, sarr_val2, farr_val2);
+        flip_word(i, (unsigned int) farr_val1, (unsigned int) sarr_val1);
+    }
+
+    //printf("* E,%i,%i\r\n", i, array[i]);
+
+    array[i] = pattern_at(i);
+    local_errors++;
+
+    return de_class != DE_NONE;
+}
+
+// Checks words first to last - 1 against the pattern.  Returns the number of
+// errors.
+int check_words(int *array, int first, int last)
 {
     int i = 0;
-    int sum = 0;
-    int first_error = 0;
     int numberOfErrors = 0;
 
-    for (i = 0; i < data_array_elements; i++)
+#ifdef PATTERN_ARITHMETIC
     {
-        int sarr_val1 = array[i];
-        int farr_val1 = static_pattern[i];
-        if (sarr_val1 != farr_val1) //there is either an SEU or SET
+        int b = 0;
+
+        // one tight loop per background, without flash reads or division
+        for (b = first / block_elements; b < backgrounds; b++)
         {
-            int sarr_val2 = array[i];
-            int farr_val2 = static_pattern[i];
-            if (sarr_val2 != farr_val1) //second read doesn't match either
+            int from = b * block_elements < first ? first : b * block_elements;
+            int to = (b + 1) * block_elements < last ? (b + 1) * block_elements : last;
+            int word = PATTERN_INT(background[b]);
+
+            for (i = from; i < to; i++)
             {
-                if (sarr_val1 == sarr_val2)  //the issue is not SRAM
-                {
-                    if (farr_val1 == farr_val2)
-                    {
-                        numberOfErrors++;
-
-                        printf(" - i: %u\r\n", ind);
-                        printf("   SARR_SEU: {%i: %i, %i: %i}\n\r", sarr_val1,
-                               farr_val1, sarr_val2, farr_val2);
-
-                    }
-                    else
-                    {
-                        if (sarr_val1 == farr_val2)
-                        {
-                            //decoder error on farr_val1
-                            numberOfErrors++;
-
-                            printf(" - i: %u\r\n", ind);
-                            printf("   DE_FARR1: {%i: %i, %i: %i}\n\r",
-                                   sarr_val1, farr_val1, sarr_val2, farr_val2);
-                        }
-                        else
-                        {
-                            //decoder err on both flash reads
-                            numberOfErrors++;
-
-                            printf(" - i: %u\r\n", ind);
-                            printf("   DE_FARR1&2: {%i: %i, %i: %i}\n\r",
-                                   sarr_val1, farr_val1, sarr_val2, farr_val2);
-                        }
-                    }
-                }
-                else
-                {
-                    //issue is SRAM
-                    if (sarr_val2 == farr_val2)
-                    {
-                        //decoder err on farr val1 or sarr val1
-                        numberOfErrors++;
-
-                        printf(" - i: %u\r\n", ind);
-                        printf("   DE_FARR1orSARR1: {%i: %i, %i: %i}\n\r",
-                               sarr_val1, farr_val1, sarr_val2, farr_val2);
-                    }
-                    else
-                    {
-                        if (farr_val2 == sarr_val1)
-                        {
-                            //decoder error on both SRAM values
-                            numberOfErrors++;
-
-                            printf(" - i: %u\r\n", ind);
-                            printf("   DE_SARR1&2: {%i: %i, %i: %i}\n\r",
-                                   sarr_val1, farr_val1, sarr_val2, farr_val2);
-                        }
-                        else
-                        {
-                            //decoder errors everywhere
-                            numberOfErrors++;
-
-                            printf(" - i: %u\r\n", ind);
-                            printf("   DE_all: {%i: %i, %i: %i}\n\r", sarr_val1,
-                                   farr_val1, sarr_val2, farr_val2);
-                        }
-                    }
-                }
+                int sarr_val1 = array[i];
+                int farr_val1 = word ^ i;
 
-            }
-            else
-            {  //possible issue with the first read
-                if (sarr_val1 != sarr_val2)
+                if (sarr_val1 != farr_val1) //there is either an SEU or SET
                 {
-                    //decoder error on farr_val1
-                    numberOfErrors++;
-
-                    printf(" - i: %u\r\n", ind);
-                    printf("   DE_SARR1: {%i: %i, %i: %i}\n\r", sarr_val1,
-                           farr_val1, sarr_val2, farr_val2);
+                    numberOfErrors += check_word(array, i, sarr_val1, farr_val1);
                 }
             }
+        }
+    }
+#else
+    for (i = first; i < last; i++)
+    {
+        int sarr_val1 = array[i];
+        int farr_val1 = static_pattern[i];
 
-            //printf("* E,%i,%i\r\n", i, array[i]);
-
-            array[i] = static_pattern[i];
-            local_errors++;
+        if (sarr_val1 != farr_val1) //there is either an SEU or SET
+        {
+            numberOfErrors += check_word(array, i, sarr_val1, farr_val1);
         }
+    }
+#endif
 
+    return numberOfErrors;
+}
+
+int calc_sum(int *array)
+{
+    int numberOfErrors = 0;
+#ifdef SIGNATURE_CHECK
+    signature sig;
+#endif
+
+    robust = -1;
+    flip_begin();
+#ifdef SIGNATURE_CHECK
+    signature_init(&sig);
+    signature_fold(&sig, array, data_array_elements);
+    if (signature_equal(&sig, &golden))
+    {
+        return 1;
     }
+#endif
+    numberOfErrors = check_words(array, 0, data_array_elements);
+
+    if (!robust && numberOfErrors > 0)
+    {
+        reportIteration(ind);
+        reportCount('E', numberOfErrors);
+    }
+    if (robust > 0)
+    {
+        flip_report(ind, 0);
+    }
+#ifdef SIGNATURE_CHECK
+    if (numberOfErrors == 0)
+    {
+        // every word is right, so the upset was in the fold
+        sum_errors++;
+        local_errors++;
+        reportIteration(ind);
+        reportSum((int) signature_value(&golden), (int) signature_value(&sig));
+    }
+#endif
 
     return 1;
 
 }
 
+#ifdef SCRUB
+// Checks one slice of the scrub, and bounds how long its errors went unseen
+void scrub_slice(int *array, int first, int last)
+{
+    int numberOfErrors = 0;
+
+    robust = -1;
+    flip_begin();
+    numberOfErrors = check_words(array, first, last);
+
+    if (numberOfErrors > 0)
+    {
+        if (!robust)
+        {
+            reportIteration(ind);
+            reportCount('E', numberOfErrors);
+        }
+        else
+        {
+            flip_report(ind, 0);
+        }
+        reportLatency(scrub_latency());
+    }
+}
+#endif
+
+#ifdef SCRUB
+// A pass is one round of the slices, so ind counts passes as it does below
+void cache_test(void)
+{
+    int first = 0;
+    int last = 0;
+    int total_errors = 0;
+    int tests_with_errors = 0;
+
+    init_array(array);
+    scrub_start(data_array_elements, scrub_words, scrub_period);
+
+    while (1)
+    {
+        int pass_done = scrub_next(&first, &last);
+
+        scrub_slice(array, first, last);
+        if (!pass_done)
+        {
+            continue;
+        }
+
+        if (ind % 60 == 0)
+        {
+            int counters[4 + DE_CLASSES] = { total_errors, tests_with_errors,
+                                             sum_errors, (int) scrub_overruns() };
+
+            initUART();
+            reportHeartbeat(ind, counters, 4 + dr_counters(counters + 4));
+        }
+
+        ind++;
+        iterationDone();
+        total_errors += local_errors;
+        if (local_errors > 0)
+        {
+            tests_with_errors++;
+        }
+        local_errors = 0;
+        in_block = 0;
+    }
+}
+#else
 void cache_test(void)
 {
 //int data_array[data_array_elements];
@@ -194,12 +352,15 @@ void cache_test(void)
 
         if (ind % 60 == 0)
         {
+            int counters[3 + DE_CLASSES] = { total_errors, tests_with_errors,
+                                             sum_errors };
+
             initUART();
-            printf("# %u, %i, %i, %i\r\n", ind, total_errors, tests_with_errors,
-                   sum_errors);
+            reportHeartbeat(ind, counters, 3 + dr_counters(counters + 3));
         }
 
         ind++;
+        iterationDone();
         total_errors += local_errors;
         if (local_errors > 0)
         {
@@ -209,107 +370,47 @@ void cache_test(void)
         in_block = 0;
     }
 }
+#endif
 
 int main(void)
 {
 
-    initMSP430();
+#ifdef SIGNATURE_CHECK
+    int i = 0;
+
+    signature_init(&golden);
+    for (i = 0; i < data_array_elements; i++)
+    {
+        signature_word(&golden, i, pattern_at(i));
+    }
+#endif
+#if defined(SCRUB) && defined(PLATFORM_POSIX)
+    if (getenv("BENCH_SCRUB_WORDS"))
+    {
+        scrub_words = atoi(getenv("BENCH_SCRUB_WORDS"));
+    }
+    if (getenv("BENCH_SCRUB_US"))
+    {
+        scrub_period = strtoul(getenv("BENCH_SCRUB_US"), 0, 10);
+    }
+#endif
+
+    initPlatform();
 
     printf("\n\r---\n\r");
-    printf("hw: MSP430F2619\r\n");
+    printf("hw: %s\r\n", PLATFORM_HW);
     printf("test: cache_static\r\n");
     printf("mit: none\r\n");
     printf("printing: %i\r\n", robust_printing);
     printf("Array size: %i\r\n", data_array_elements);
+    printf("pattern: %s\r\n", PATTERN_MODE);
+    printf("check: %s\r\n", CHECK_MODE);
+#ifdef SCRUB
+    printf("scrub: %i words every %n us\r\n", scrub_words, scrub_period);
+#endif
     printf("ver: 1.0\r\n");
     printf("fac: LANSCE Oct 2019\r\n");
     printf("d:\r\n");
 
     cache_test();
 }
-
-void initMSP430()
-{
-//MSP430F2619 initialization code
-    WDTCTL = WDTPW + WDTHOLD;
-
-    if (CALBC1_1MHZ == 0xFF)				// If calibration constant erased
-    {
-        while (1)
-            ;                               // do not load, trap CPU!!
-    }
-    DCOCTL = 0;                          // Select lowest DCOx and MODx settings
-    BCSCTL1 = CALBC1_1MHZ;                    // Set DCO
-    DCOCTL = CALDCO_1MHZ;
-
-    initUART();
-
-}
-
-/**
- * Initializes the UART for 9600 baud with a RX interrupt
- **/
-void initUART(void)
-{
-
-    P3SEL = 0x30;                             // P3.4,5 = USCI_A0 TXD/RXD
-    UCA0CTL1 |= UCSSEL_2;                     // SMCLK
-    UCA0BR0 = 104;                           // 1MHz 9600; (104)decimal = 0x068h
-    UCA0BR1 = 0;                              // 1MHz 9600
-    UCA0MCTL = UCBRS0;                        // Modulation UCBRSx = 1
-    UCA0CTL1 &= ~UCSWRST;                   // **Initialize USCI state machine**
-}
-
-/**
- * puts() is used by printf() to display or send a string.. This function
- * determines where printf prints to. For this case it sends a string
- * out over UART, another option could be to display the string on an
- * LCD display.
- **/
-int puts(const char *_ptr)
-{
-    unsigned int i, len;
-
-    len = strlen(_ptr);
-
-    for (i = 0; i < len; i++)
-    {
-        sendByte(_ptr[i]);
-    }
-
-    return len;
-}
-/**
- * puts() is used by printf() to display or send a character. This function
- * determines where printf prints to. For this case it sends a character
- * out over UART.
- **/
-int putc(int _x, FILE *_fp)
-{
-    sendByte(_x);
-
-    return _x;
-}
-
-/**
- * Sends a single byte out through UART
- **/
-void sendByte(char byte)
-{
-    while (!(IFG2 & UCA0TXIFG))
-        ; // USCI_A0 TX buffer ready?
-    UCA0TXBUF = byte; // TX -> RXed character
-}
-
-//  Echo back RXed character, confirm TX buffer is ready first
-#pragma vector=USCIAB0RX_VECTOR
-__interrupt void USCI0RX_ISR(void)
-{
-
-    while (!(IFG2 & UCA0TXIFG))
-        ;                // USCI_A0 TX buffer ready?
-    UCA0TXBUF = UCA0RXBUF;                    // TX -> RXed character
-}
-
-
-
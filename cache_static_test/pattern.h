@@ -1,564 +1,341 @@
-const unsigned int static_pattern[] = { 0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7,
-                                        0x8, 0x9, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf,
-                                        0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-                                        0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b,
-                                        0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21,
-                                        0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-                                        0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d,
-                                        0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33,
-                                        0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-                                        0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
-                                        0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
-                                        0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
-                                        0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51,
-                                        0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
-                                        0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d,
-                                        0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63,
-                                        0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
-                                        0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
-                                        0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
-                                        0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-                                        0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81,
-                                        0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
-                                        0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d,
-                                        0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93,
-                                        0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
-                                        0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
-                                        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5,
-                                        0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab,
-                                        0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1,
-                                        0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
-                                        0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd,
-                                        0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0xc3,
-                                        0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
-                                        0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
-                                        0xd0, 0xd1, 0xd2, 0xd3, 0x3fd4, 0x3fd5,
-                                        0x3fd6, 0x3fd7, 0x3fd8, 0x3fd9, 0x3fda,
-                                        0x3fdb, 0x3fdc, 0x3fdd, 0x3fde, 0x3fdf,
-                                        0x3fe0, 0x3fe1, 0x3fe2, 0x3fe3, 0x3fe4,
-                                        0x3fe5, 0x3fe6, 0x3fe7, 0x3fe8, 0x3fe9,
-                                        0x3fea, 0x3feb, 0x3fec, 0x3fed, 0x3fee,
-                                        0x3fef, 0x3ff0, 0x3ff1, 0x3ff2, 0x3ff3,
-                                        0x3ff4, 0x3ff5, 0x3ff6, 0x3ff7, 0x3ff8,
-                                        0x3ff9, 0x3ffa, 0x3ffb, 0x3ffc, 0x3ffd,
-                                        0x3ffe, 0x3fff, 0x7f00, 0x7f01, 0x7f02,
-                                        0x7f03, 0x7f04, 0x7f05, 0x7f06, 0x7f07,
-                                        0x7f08, 0x7f09, 0x7f0a, 0x7f0b, 0x7f0c,
-                                        0x7f0d, 0x7f0e, 0x7f0f, 0x7f10, 0x7f11,
-                                        0x7f12, 0x7f13, 0x7f14, 0x7f15, 0x7f16,
-                                        0x7f17, 0x7f18, 0x7f19, 0x7f1a, 0x7f1b,
-                                        0x7f1c, 0x7f1d, 0x7f1e, 0x7f1f, 0x7f20,
-                                        0x7f21, 0x7f22, 0x7f23, 0x7f24, 0x7f25,
-                                        0x7f26, 0x7f27, 0x7f28, 0x7f29, 0x7f2a,
-                                        0x7f2b, 0x7f2c, 0x7f2d, 0x7f2e, 0x7f2f,
-                                        0x7f30, 0x7f31, 0x7f32, 0x7f33, 0x7f34,
-                                        0x7f35, 0x7f36, 0x7f37, 0x7f38, 0x7f39,
-                                        0x7f3a, 0x7f3b, 0x7f3c, 0x7f3d, 0x7f3e,
-                                        0x7f3f, 0x7f40, 0x7f41, 0x7f42, 0x7f43,
-                                        0x7f44, 0x7f45, 0x7f46, 0x7f47, 0x7f48,
-                                        0x7f49, 0x7f4a, 0x7f4b, 0x7f4c, 0x7f4d,
-                                        0x7f4e, 0x7f4f, 0x7f50, 0x7f51, 0x7f52,
-                                        0x7f53, 0x7f54, 0x7f55, 0x7f56, 0x7f57,
-                                        0x7f58, 0x7f59, 0x7f5a, 0x7f5b, 0x7f5c,
-                                        0x7f5d, 0x7f5e, 0x7f5f, 0x7f60, 0x7f61,
-                                        0x7f62, 0x7f63, 0x7f64, 0x7f65, 0x7f66,
-                                        0x7f67, 0x7f68, 0x7f69, 0x7f6a, 0x7f6b,
-                                        0x7f6c, 0x7f6d, 0x7f6e, 0x7f6f, 0x7f70,
-                                        0x7f71, 0x7f72, 0x7f73, 0x7f74, 0x7f75,
-                                        0x7f76, 0x7f77, 0x7f78, 0x7f79, 0x7f7a,
-                                        0x7f7b, 0x7f7c, 0x7f7d, 0x7f7e, 0x7f7f,
-                                        0x7f80, 0x7f81, 0x7f82, 0x7f83, 0x7f84,
-                                        0x7f85, 0x7f86, 0x7f87, 0x7f88, 0x7f89,
-                                        0x7f8a, 0x7f8b, 0x7f8c, 0x7f8d, 0x7f8e,
-                                        0x7f8f, 0x7f90, 0x7f91, 0x7f92, 0x7f93,
-                                        0x7f94, 0x7f95, 0x7f96, 0x7f97, 0x7f98,
-                                        0x7f99, 0x7f9a, 0x7f9b, 0x7f9c, 0x7f9d,
-                                        0x7f9e, 0x7f9f, 0x7fa0, 0x7fa1, 0x7fa2,
-                                        0x7fa3, 0x7fa4, 0x7fa5, 0x7fa6, 0x7fa7,
-                                        0x55a8, 0x55a9, 0x55aa, 0x55ab, 0x55ac,
-                                        0x55ad, 0x55ae, 0x55af, 0x55b0, 0x55b1,
-                                        0x55b2, 0x55b3, 0x55b4, 0x55b5, 0x55b6,
-                                        0x55b7, 0x55b8, 0x55b9, 0x55ba, 0x55bb,
-                                        0x55bc, 0x55bd, 0x55be, 0x55bf, 0x55c0,
-                                        0x55c1, 0x55c2, 0x55c3, 0x55c4, 0x55c5,
-                                        0x55c6, 0x55c7, 0x55c8, 0x55c9, 0x55ca,
-                                        0x55cb, 0x55cc, 0x55cd, 0x55ce, 0x55cf,
-                                        0x55d0, 0x55d1, 0x55d2, 0x55d3, 0x55d4,
-                                        0x55d5, 0x55d6, 0x55d7, 0x55d8, 0x55d9,
-                                        0x55da, 0x55db, 0x55dc, 0x55dd, 0x55de,
-                                        0x55df, 0x55e0, 0x55e1, 0x55e2, 0x55e3,
-                                        0x55e4, 0x55e5, 0x55e6, 0x55e7, 0x55e8,
-                                        0x55e9, 0x55ea, 0x55eb, 0x55ec, 0x55ed,
-                                        0x55ee, 0x55ef, 0x55f0, 0x55f1, 0x55f2,
-                                        0x55f3, 0x55f4, 0x55f5, 0x55f6, 0x55f7,
-                                        0x55f8, 0x55f9, 0x55fa, 0x55fb, 0x55fc,
-                                        0x55fd, 0x55fe, 0x55ff, 0xaa00, 0xaa01,
-                                        0xaa02, 0xaa03, 0xaa04, 0xaa05, 0xaa06,
-                                        0xaa07, 0xaa08, 0xaa09, 0xaa0a, 0xaa0b,
-                                        0xaa0c, 0xaa0d, 0xaa0e, 0xaa0f, 0xaa10,
-                                        0xaa11, 0xaa12, 0xaa13, 0xaa14, 0xaa15,
-                                        0xaa16, 0xaa17, 0xaa18, 0xaa19, 0xaa1a,
-                                        0xaa1b, 0xaa1c, 0xaa1d, 0xaa1e, 0xaa1f,
-                                        0xaa20, 0xaa21, 0xaa22, 0xaa23, 0xaa24,
-                                        0xaa25, 0xaa26, 0xaa27, 0xaa28, 0xaa29,
-                                        0xaa2a, 0xaa2b, 0xaa2c, 0xaa2d, 0xaa2e,
-                                        0xaa2f, 0xaa30, 0xaa31, 0xaa32, 0xaa33,
-                                        0xaa34, 0xaa35, 0xaa36, 0xaa37, 0xaa38,
-                                        0xaa39, 0xaa3a, 0xaa3b, 0xaa3c, 0xaa3d,
-                                        0xaa3e, 0xaa3f, 0xaa40, 0xaa41, 0xaa42,
-                                        0xaa43, 0xaa44, 0xaa45, 0xaa46, 0xaa47,
-                                        0xaa48, 0xaa49, 0xaa4a, 0xaa4b, 0xaa4c,
-                                        0xaa4d, 0xaa4e, 0xaa4f, 0xaa50, 0xaa51,
-                                        0xaa52, 0xaa53, 0xaa54, 0xaa55, 0xaa56,
-                                        0xaa57, 0xaa58, 0xaa59, 0xaa5a, 0xaa5b,
-                                        0xaa5c, 0xaa5d, 0xaa5e, 0xaa5f, 0xaa60,
-                                        0xaa61, 0xaa62, 0xaa63, 0xaa64, 0xaa65,
-                                        0xaa66, 0xaa67, 0xaa68, 0xaa69, 0xaa6a,
-                                        0xaa6b, 0xaa6c, 0xaa6d, 0xaa6e, 0xaa6f,
-                                        0xaa70, 0xaa71, 0xaa72, 0xaa73, 0xaa74,
-                                        0xaa75, 0xaa76, 0xaa77, 0xaa78, 0xaa79,
-                                        0xaa7a, 0xaa7b, 0x567c, 0x567d, 0x567e,
-                                        0x567f, 0x5680, 0x5681, 0x5682, 0x5683,
-                                        0x5684, 0x5685, 0x5686, 0x5687, 0x5688,
-                                        0x5689, 0x568a, 0x568b, 0x568c, 0x568d,
-                                        0x568e, 0x568f, 0x5690, 0x5691, 0x5692,
-                                        0x5693, 0x5694, 0x5695, 0x5696, 0x5697,
-                                        0x5698, 0x5699, 0x569a, 0x569b, 0x569c,
-                                        0x569d, 0x569e, 0x569f, 0x56a0, 0x56a1,
-                                        0x56a2, 0x56a3, 0x56a4, 0x56a5, 0x56a6,
-                                        0x56a7, 0x56a8, 0x56a9, 0x56aa, 0x56ab,
-                                        0x56ac, 0x56ad, 0x56ae, 0x56af, 0x56b0,
-                                        0x56b1, 0x56b2, 0x56b3, 0x56b4, 0x56b5,
-                                        0x56b6, 0x56b7, 0x56b8, 0x56b9, 0x56ba,
-                                        0x56bb, 0x56bc, 0x56bd, 0x56be, 0x56bf,
-                                        0x56c0, 0x56c1, 0x56c2, 0x56c3, 0x56c4,
-                                        0x56c5, 0x56c6, 0x56c7, 0x56c8, 0x56c9,
-                                        0x56ca, 0x56cb, 0x56cc, 0x56cd, 0x56ce,
-                                        0x56cf, 0x56d0, 0x56d1, 0x56d2, 0x56d3,
-                                        0x56d4, 0x56d5, 0x56d6, 0x56d7, 0x56d8,
-                                        0x56d9, 0x56da, 0x56db, 0x56dc, 0x56dd,
-                                        0x56de, 0x56df, 0x56e0, 0x56e1, 0x56e2,
-                                        0x56e3, 0x56e4, 0x56e5, 0x56e6, 0x56e7,
-                                        0x56e8, 0x56e9, 0x56ea, 0x56eb, 0x56ec,
-                                        0x56ed, 0x56ee, 0x56ef, 0x56f0, 0x56f1,
-                                        0x56f2, 0x56f3, 0x56f4, 0x56f5, 0x56f6,
-                                        0x56f7, 0x56f8, 0x56f9, 0x56fa, 0x56fb,
-                                        0x56fc, 0x56fd, 0x56fe, 0x56ff, 0x5700,
-                                        0x5701, 0x5702, 0x5703, 0x5704, 0x5705,
-                                        0x5706, 0x5707, 0x5708, 0x5709, 0x570a,
-                                        0x570b, 0x570c, 0x570d, 0x570e, 0x570f,
-                                        0x5710, 0x5711, 0x5712, 0x5713, 0x5714,
-                                        0x5715, 0x5716, 0x5717, 0x5718, 0x5719,
-                                        0x571a, 0x571b, 0x571c, 0x571d, 0x571e,
-                                        0x571f, 0x5720, 0x5721, 0x5722, 0x5723,
-                                        0x5724, 0x5725, 0x5726, 0x5727, 0x5728,
-                                        0x5729, 0x572a, 0x572b, 0x572c, 0x572d,
-                                        0x572e, 0x572f, 0x5730, 0x5731, 0x5732,
-                                        0x5733, 0x5734, 0x5735, 0x5736, 0x5737,
-                                        0x5738, 0x5739, 0x573a, 0x573b, 0x573c,
-                                        0x573d, 0x573e, 0x573f, 0x5740, 0x5741,
-                                        0x5742, 0x5743, 0x5744, 0x5745, 0x5746,
-                                        0x5747, 0x5748, 0x5749, 0x574a, 0x574b,
-                                        0x574c, 0x574d, 0x574e, 0x574f, };
-const unsigned int static_pattern_forward[] = { 0x0, 0x1, 0x2, 0x3, 0x4, 0x5,
-                                                0x6, 0x7, 0x8, 0x9, 0xa, 0xb,
-                                                0xc, 0xd, 0xe, 0xf, 0x10, 0x11,
-                                                0x12, 0x13, 0x14, 0x15, 0x16,
-                                                0x17, 0x18, 0x19, 0x1a, 0x1b,
-                                                0x1c, 0x1d, 0x1e, 0x1f, 0x20,
-                                                0x21, 0x22, 0x23, 0x24, 0x25,
-                                                0x26, 0x27, 0x28, 0x29, 0x2a,
-                                                0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
-                                                0x30, 0x31, 0x32, 0x33, 0x34,
-                                                0x35, 0x36, 0x37, 0x38, 0x39,
-                                                0x3a, 0x3b, 0x3c, 0x3d, 0x3e,
-                                                0x3f, 0x40, 0x41, 0x42, 0x43,
-                                                0x44, 0x45, 0x46, 0x47, 0x48,
-                                                0x49, 0x4a, 0x4b, 0x4c, 0x4d,
-                                                0x4e, 0x4f, 0x50, 0x51, 0x52,
-                                                0x53, 0x54, 0x55, 0x56, 0x57,
-                                                0x58, 0x59, 0x5a, 0x5b, 0x5c,
-                                                0x5d, 0x5e, 0x5f, 0x60, 0x61,
-                                                0x62, 0x63, 0x64, 0x65, 0x66,
-                                                0x67, 0x68, 0x69, 0x6a, 0x6b,
-                                                0x6c, 0x6d, 0x6e, 0x6f, 0x70,
-                                                0x71, 0x72, 0x73, 0x74, 0x75,
-                                                0x76, 0x77, 0x78, 0x79, 0x7a,
-                                                0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
-                                                0x80, 0x81, 0x82, 0x83, 0x84,
-                                                0x85, 0x86, 0x87, 0x88, 0x89,
-                                                0x8a, 0x8b, 0x8c, 0x8d, 0x8e,
-                                                0x8f, 0x90, 0x91, 0x92, 0x93,
-                                                0x94, 0x95, 0x96, 0x97, 0x98,
-                                                0x99, 0x9a, 0x9b, 0x9c, 0x9d,
-                                                0x9e, 0x9f, 0xa0, 0xa1, 0xa2,
-                                                0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
-                                                0xa8, 0xa9, 0xaa, 0xab, 0xac,
-                                                0xad, 0xae, 0xaf, 0xb0, 0xb1,
-                                                0xb2, 0xb3, 0xb4, 0xb5, 0xb6,
-                                                0xb7, 0xb8, 0xb9, 0xba, 0xbb,
-                                                0xbc, 0xbd, 0xbe, 0xbf, 0xc0,
-                                                0xc1, 0xc2, 0xc3, 0xc4, 0xc5,
-                                                0xc6, 0xc7, 0xc8, 0xc9, 0xca,
-                                                0xcb, 0xcc, 0xcd, 0xce, 0xcf,
-                                                0xd0, 0xd1, 0xd2, 0xd3, 0x3fd4,
-                                                0x3fd5, 0x3fd6, 0x3fd7, 0x3fd8,
-                                                0x3fd9, 0x3fda, 0x3fdb, 0x3fdc,
-                                                0x3fdd, 0x3fde, 0x3fdf, 0x3fe0,
-                                                0x3fe1, 0x3fe2, 0x3fe3, 0x3fe4,
-                                                0x3fe5, 0x3fe6, 0x3fe7, 0x3fe8,
-                                                0x3fe9, 0x3fea, 0x3feb, 0x3fec,
-                                                0x3fed, 0x3fee, 0x3fef, 0x3ff0,
-                                                0x3ff1, 0x3ff2, 0x3ff3, 0x3ff4,
-                                                0x3ff5, 0x3ff6, 0x3ff7, 0x3ff8,
-                                                0x3ff9, 0x3ffa, 0x3ffb, 0x3ffc,
-                                                0x3ffd, 0x3ffe, 0x3fff, 0x55a8,
-                                                0x55a9, 0x55aa, 0x55ab, 0x55ac,
-                                                0x55ad, 0x55ae, 0x55af, 0x55b0,
-                                                0x55b1, 0x55b2, 0x55b3, 0x55b4,
-                                                0x55b5, 0x55b6, 0x55b7, 0x55b8,
-                                                0x55b9, 0x55ba, 0x55bb, 0x55bc,
-                                                0x55bd, 0x55be, 0x55bf, 0x55c0,
-                                                0x55c1, 0x55c2, 0x55c3, 0x55c4,
-                                                0x55c5, 0x55c6, 0x55c7, 0x55c8,
-                                                0x55c9, 0x55ca, 0x55cb, 0x55cc,
-                                                0x55cd, 0x55ce, 0x55cf, 0x55d0,
-                                                0x55d1, 0x55d2, 0x55d3, 0x55d4,
-                                                0x55d5, 0x55d6, 0x55d7, 0x55d8,
-                                                0x55d9, 0x55da, 0x55db, 0x55dc,
-                                                0x55dd, 0x55de, 0x55df, 0x55e0,
-                                                0x55e1, 0x55e2, 0x55e3, 0x55e4,
-                                                0x55e5, 0x55e6, 0x55e7, 0x55e8,
-                                                0x55e9, 0x55ea, 0x55eb, 0x55ec,
-                                                0x55ed, 0x55ee, 0x55ef, 0x55f0,
-                                                0x55f1, 0x55f2, 0x55f3, 0x55f4,
-                                                0x55f5, 0x55f6, 0x55f7, 0x55f8,
-                                                0x55f9, 0x55fa, 0x55fb, 0x55fc,
-                                                0x55fd, 0x55fe, 0x55ff, 0x567c,
-                                                0x567d, 0x567e, 0x567f, 0x5680,
-                                                0x5681, 0x5682, 0x5683, 0x5684,
-                                                0x5685, 0x5686, 0x5687, 0x5688,
-                                                0x5689, 0x568a, 0x568b, 0x568c,
-                                                0x568d, 0x568e, 0x568f, 0x5690,
-                                                0x5691, 0x5692, 0x5693, 0x5694,
-                                                0x5695, 0x5696, 0x5697, 0x5698,
-                                                0x5699, 0x569a, 0x569b, 0x569c,
-                                                0x569d, 0x569e, 0x569f, 0x56a0,
-                                                0x56a1, 0x56a2, 0x56a3, 0x56a4,
-                                                0x56a5, 0x56a6, 0x56a7, 0x56a8,
-                                                0x56a9, 0x56aa, 0x56ab, 0x56ac,
-                                                0x56ad, 0x56ae, 0x56af, 0x56b0,
-                                                0x56b1, 0x56b2, 0x56b3, 0x56b4,
-                                                0x56b5, 0x56b6, 0x56b7, 0x56b8,
-                                                0x56b9, 0x56ba, 0x56bb, 0x56bc,
-                                                0x56bd, 0x56be, 0x56bf, 0x56c0,
-                                                0x56c1, 0x56c2, 0x56c3, 0x56c4,
-                                                0x56c5, 0x56c6, 0x56c7, 0x56c8,
-                                                0x56c9, 0x56ca, 0x56cb, 0x56cc,
-                                                0x56cd, 0x56ce, 0x56cf, 0x56d0,
-                                                0x56d1, 0x56d2, 0x56d3, 0x56d4,
-                                                0x56d5, 0x56d6, 0x56d7, 0x56d8,
-                                                0x56d9, 0x56da, 0x56db, 0x56dc,
-                                                0x56dd, 0x56de, 0x56df, 0x56e0,
-                                                0x56e1, 0x56e2, 0x56e3, 0x56e4,
-                                                0x56e5, 0x56e6, 0x56e7, 0x56e8,
-                                                0x56e9, 0x56ea, 0x56eb, 0x56ec,
-                                                0x56ed, 0x56ee, 0x56ef, 0x56f0,
-                                                0x56f1, 0x56f2, 0x56f3, 0x56f4,
-                                                0x56f5, 0x56f6, 0x56f7, 0x56f8,
-                                                0x56f9, 0x56fa, 0x56fb, 0x56fc,
-                                                0x56fd, 0x56fe, 0x56ff, 0x5700,
-                                                0x5701, 0x5702, 0x5703, 0x5704,
-                                                0x5705, 0x5706, 0x5707, 0x5708,
-                                                0x5709, 0x570a, 0x570b, 0x570c,
-                                                0x570d, 0x570e, 0x570f, 0x5710,
-                                                0x5711, 0x5712, 0x5713, 0x5714,
-                                                0x5715, 0x5716, 0x5717, 0x5718,
-                                                0x5719, 0x571a, 0x571b, 0x571c,
-                                                0x571d, 0x571e, 0x571f, 0x5720,
-                                                0x5721, 0x5722, 0x5723, 0x5724,
-                                                0x5725, 0x5726, 0x5727, 0x5728,
-                                                0x5729, 0x572a, 0x572b, 0x572c,
-                                                0x572d, 0x572e, 0x572f, 0x5730,
-                                                0x5731, 0x5732, 0x5733, 0x5734,
-                                                0x5735, 0x5736, 0x5737, 0x5738,
-                                                0x5739, 0x573a, 0x573b, 0x573c,
-                                                0x573d, 0x573e, 0x573f, 0x5740,
-                                                0x5741, 0x5742, 0x5743, 0x5744,
-                                                0x5745, 0x5746, 0x5747, 0x5748,
-                                                0x5749, 0x574a, 0x574b, 0x574c,
-                                                0x574d, 0x574e, 0x574f, 0x7f00,
-                                                0x7f01, 0x7f02, 0x7f03, 0x7f04,
-                                                0x7f05, 0x7f06, 0x7f07, 0x7f08,
-                                                0x7f09, 0x7f0a, 0x7f0b, 0x7f0c,
-                                                0x7f0d, 0x7f0e, 0x7f0f, 0x7f10,
-                                                0x7f11, 0x7f12, 0x7f13, 0x7f14,
-                                                0x7f15, 0x7f16, 0x7f17, 0x7f18,
-                                                0x7f19, 0x7f1a, 0x7f1b, 0x7f1c,
-                                                0x7f1d, 0x7f1e, 0x7f1f, 0x7f20,
-                                                0x7f21, 0x7f22, 0x7f23, 0x7f24,
-                                                0x7f25, 0x7f26, 0x7f27, 0x7f28,
-                                                0x7f29, 0x7f2a, 0x7f2b, 0x7f2c,
-                                                0x7f2d, 0x7f2e, 0x7f2f, 0x7f30,
-                                                0x7f31, 0x7f32, 0x7f33, 0x7f34,
-                                                0x7f35, 0x7f36, 0x7f37, 0x7f38,
-                                                0x7f39, 0x7f3a, 0x7f3b, 0x7f3c,
-                                                0x7f3d, 0x7f3e, 0x7f3f, 0x7f40,
-                                                0x7f41, 0x7f42, 0x7f43, 0x7f44,
-                                                0x7f45, 0x7f46, 0x7f47, 0x7f48,
-                                                0x7f49, 0x7f4a, 0x7f4b, 0x7f4c,
-                                                0x7f4d, 0x7f4e, 0x7f4f, 0x7f50,
-                                                0x7f51, 0x7f52, 0x7f53, 0x7f54,
-                                                0x7f55, 0x7f56, 0x7f57, 0x7f58,
-                                                0x7f59, 0x7f5a, 0x7f5b, 0x7f5c,
-                                                0x7f5d, 0x7f5e, 0x7f5f, 0x7f60,
-                                                0x7f61, 0x7f62, 0x7f63, 0x7f64,
-                                                0x7f65, 0x7f66, 0x7f67, 0x7f68,
-                                                0x7f69, 0x7f6a, 0x7f6b, 0x7f6c,
-                                                0x7f6d, 0x7f6e, 0x7f6f, 0x7f70,
-                                                0x7f71, 0x7f72, 0x7f73, 0x7f74,
-                                                0x7f75, 0x7f76, 0x7f77, 0x7f78,
-                                                0x7f79, 0x7f7a, 0x7f7b, 0x7f7c,
-                                                0x7f7d, 0x7f7e, 0x7f7f, 0x7f80,
-                                                0x7f81, 0x7f82, 0x7f83, 0x7f84,
-                                                0x7f85, 0x7f86, 0x7f87, 0x7f88,
-                                                0x7f89, 0x7f8a, 0x7f8b, 0x7f8c,
-                                                0x7f8d, 0x7f8e, 0x7f8f, 0x7f90,
-                                                0x7f91, 0x7f92, 0x7f93, 0x7f94,
-                                                0x7f95, 0x7f96, 0x7f97, 0x7f98,
-                                                0x7f99, 0x7f9a, 0x7f9b, 0x7f9c,
-                                                0x7f9d, 0x7f9e, 0x7f9f, 0x7fa0,
-                                                0x7fa1, 0x7fa2, 0x7fa3, 0x7fa4,
-                                                0x7fa5, 0x7fa6, 0x7fa7, 0xaa00,
-                                                0xaa01, 0xaa02, 0xaa03, 0xaa04,
-                                                0xaa05, 0xaa06, 0xaa07, 0xaa08,
-                                                0xaa09, 0xaa0a, 0xaa0b, 0xaa0c,
-                                                0xaa0d, 0xaa0e, 0xaa0f, 0xaa10,
-                                                0xaa11, 0xaa12, 0xaa13, 0xaa14,
-                                                0xaa15, 0xaa16, 0xaa17, 0xaa18,
-                                                0xaa19, 0xaa1a, 0xaa1b, 0xaa1c,
-                                                0xaa1d, 0xaa1e, 0xaa1f, 0xaa20,
-                                                0xaa21, 0xaa22, 0xaa23, 0xaa24,
-                                                0xaa25, 0xaa26, 0xaa27, 0xaa28,
-                                                0xaa29, 0xaa2a, 0xaa2b, 0xaa2c,
-                                                0xaa2d, 0xaa2e, 0xaa2f, 0xaa30,
-                                                0xaa31, 0xaa32, 0xaa33, 0xaa34,
-                                                0xaa35, 0xaa36, 0xaa37, 0xaa38,
-                                                0xaa39, 0xaa3a, 0xaa3b, 0xaa3c,
-                                                0xaa3d, 0xaa3e, 0xaa3f, 0xaa40,
-                                                0xaa41, 0xaa42, 0xaa43, 0xaa44,
-                                                0xaa45, 0xaa46, 0xaa47, 0xaa48,
-                                                0xaa49, 0xaa4a, 0xaa4b, 0xaa4c,
-                                                0xaa4d, 0xaa4e, 0xaa4f, 0xaa50,
-                                                0xaa51, 0xaa52, 0xaa53, 0xaa54,
-                                                0xaa55, 0xaa56, 0xaa57, 0xaa58,
-                                                0xaa59, 0xaa5a, 0xaa5b, 0xaa5c,
-                                                0xaa5d, 0xaa5e, 0xaa5f, 0xaa60,
-                                                0xaa61, 0xaa62, 0xaa63, 0xaa64,
-                                                0xaa65, 0xaa66, 0xaa67, 0xaa68,
-                                                0xaa69, 0xaa6a, 0xaa6b, 0xaa6c,
-                                                0xaa6d, 0xaa6e, 0xaa6f, 0xaa70,
-                                                0xaa71, 0xaa72, 0xaa73, 0xaa74,
-                                                0xaa75, 0xaa76, 0xaa77, 0xaa78,
-                                                0xaa79, 0xaa7a, 0xaa7b, };
-const unsigned int static_pattern_reverse[] = { 0xaa7b, 0xaa7a, 0xaa79, 0xaa78,
-                                                0xaa77, 0xaa76, 0xaa75, 0xaa74,
-                                                0xaa73, 0xaa72, 0xaa71, 0xaa70,
-                                                0xaa6f, 0xaa6e, 0xaa6d, 0xaa6c,
-                                                0xaa6b, 0xaa6a, 0xaa69, 0xaa68,
-                                                0xaa67, 0xaa66, 0xaa65, 0xaa64,
-                                                0xaa63, 0xaa62, 0xaa61, 0xaa60,
-                                                0xaa5f, 0xaa5e, 0xaa5d, 0xaa5c,
-                                                0xaa5b, 0xaa5a, 0xaa59, 0xaa58,
-                                                0xaa57, 0xaa56, 0xaa55, 0xaa54,
-                                                0xaa53, 0xaa52, 0xaa51, 0xaa50,
-                                                0xaa4f, 0xaa4e, 0xaa4d, 0xaa4c,
-                                                0xaa4b, 0xaa4a, 0xaa49, 0xaa48,
-                                                0xaa47, 0xaa46, 0xaa45, 0xaa44,
-                                                0xaa43, 0xaa42, 0xaa41, 0xaa40,
-                                                0xaa3f, 0xaa3e, 0xaa3d, 0xaa3c,
-                                                0xaa3b, 0xaa3a, 0xaa39, 0xaa38,
-                                                0xaa37, 0xaa36, 0xaa35, 0xaa34,
-                                                0xaa33, 0xaa32, 0xaa31, 0xaa30,
-                                                0xaa2f, 0xaa2e, 0xaa2d, 0xaa2c,
-                                                0xaa2b, 0xaa2a, 0xaa29, 0xaa28,
-                                                0xaa27, 0xaa26, 0xaa25, 0xaa24,
-                                                0xaa23, 0xaa22, 0xaa21, 0xaa20,
-                                                0xaa1f, 0xaa1e, 0xaa1d, 0xaa1c,
-                                                0xaa1b, 0xaa1a, 0xaa19, 0xaa18,
-                                                0xaa17, 0xaa16, 0xaa15, 0xaa14,
-                                                0xaa13, 0xaa12, 0xaa11, 0xaa10,
-                                                0xaa0f, 0xaa0e, 0xaa0d, 0xaa0c,
-                                                0xaa0b, 0xaa0a, 0xaa09, 0xaa08,
-                                                0xaa07, 0xaa06, 0xaa05, 0xaa04,
-                                                0xaa03, 0xaa02, 0xaa01, 0xaa00,
-                                                0x7fa7, 0x7fa6, 0x7fa5, 0x7fa4,
-                                                0x7fa3, 0x7fa2, 0x7fa1, 0x7fa0,
-                                                0x7f9f, 0x7f9e, 0x7f9d, 0x7f9c,
-                                                0x7f9b, 0x7f9a, 0x7f99, 0x7f98,
-                                                0x7f97, 0x7f96, 0x7f95, 0x7f94,
-                                                0x7f93, 0x7f92, 0x7f91, 0x7f90,
-                                                0x7f8f, 0x7f8e, 0x7f8d, 0x7f8c,
-                                                0x7f8b, 0x7f8a, 0x7f89, 0x7f88,
-                                                0x7f87, 0x7f86, 0x7f85, 0x7f84,
-                                                0x7f83, 0x7f82, 0x7f81, 0x7f80,
-                                                0x7f7f, 0x7f7e, 0x7f7d, 0x7f7c,
-                                                0x7f7b, 0x7f7a, 0x7f79, 0x7f78,
-                                                0x7f77, 0x7f76, 0x7f75, 0x7f74,
-                                                0x7f73, 0x7f72, 0x7f71, 0x7f70,
-                                                0x7f6f, 0x7f6e, 0x7f6d, 0x7f6c,
-                                                0x7f6b, 0x7f6a, 0x7f69, 0x7f68,
-                                                0x7f67, 0x7f66, 0x7f65, 0x7f64,
-                                                0x7f63, 0x7f62, 0x7f61, 0x7f60,
-                                                0x7f5f, 0x7f5e, 0x7f5d, 0x7f5c,
-                                                0x7f5b, 0x7f5a, 0x7f59, 0x7f58,
-                                                0x7f57, 0x7f56, 0x7f55, 0x7f54,
-                                                0x7f53, 0x7f52, 0x7f51, 0x7f50,
-                                                0x7f4f, 0x7f4e, 0x7f4d, 0x7f4c,
-                                                0x7f4b, 0x7f4a, 0x7f49, 0x7f48,
-                                                0x7f47, 0x7f46, 0x7f45, 0x7f44,
-                                                0x7f43, 0x7f42, 0x7f41, 0x7f40,
-                                                0x7f3f, 0x7f3e, 0x7f3d, 0x7f3c,
-                                                0x7f3b, 0x7f3a, 0x7f39, 0x7f38,
-                                                0x7f37, 0x7f36, 0x7f35, 0x7f34,
-                                                0x7f33, 0x7f32, 0x7f31, 0x7f30,
-                                                0x7f2f, 0x7f2e, 0x7f2d, 0x7f2c,
-                                                0x7f2b, 0x7f2a, 0x7f29, 0x7f28,
-                                                0x7f27, 0x7f26, 0x7f25, 0x7f24,
-                                                0x7f23, 0x7f22, 0x7f21, 0x7f20,
-                                                0x7f1f, 0x7f1e, 0x7f1d, 0x7f1c,
-                                                0x7f1b, 0x7f1a, 0x7f19, 0x7f18,
-                                                0x7f17, 0x7f16, 0x7f15, 0x7f14,
-                                                0x7f13, 0x7f12, 0x7f11, 0x7f10,
-                                                0x7f0f, 0x7f0e, 0x7f0d, 0x7f0c,
-                                                0x7f0b, 0x7f0a, 0x7f09, 0x7f08,
-                                                0x7f07, 0x7f06, 0x7f05, 0x7f04,
-                                                0x7f03, 0x7f02, 0x7f01, 0x7f00,
-                                                0x574f, 0x574e, 0x574d, 0x574c,
-                                                0x574b, 0x574a, 0x5749, 0x5748,
-                                                0x5747, 0x5746, 0x5745, 0x5744,
-                                                0x5743, 0x5742, 0x5741, 0x5740,
-                                                0x573f, 0x573e, 0x573d, 0x573c,
-                                                0x573b, 0x573a, 0x5739, 0x5738,
-                                                0x5737, 0x5736, 0x5735, 0x5734,
-                                                0x5733, 0x5732, 0x5731, 0x5730,
-                                                0x572f, 0x572e, 0x572d, 0x572c,
-                                                0x572b, 0x572a, 0x5729, 0x5728,
-                                                0x5727, 0x5726, 0x5725, 0x5724,
-                                                0x5723, 0x5722, 0x5721, 0x5720,
-                                                0x571f, 0x571e, 0x571d, 0x571c,
-                                                0x571b, 0x571a, 0x5719, 0x5718,
-                                                0x5717, 0x5716, 0x5715, 0x5714,
-                                                0x5713, 0x5712, 0x5711, 0x5710,
-                                                0x570f, 0x570e, 0x570d, 0x570c,
-                                                0x570b, 0x570a, 0x5709, 0x5708,
-                                                0x5707, 0x5706, 0x5705, 0x5704,
-                                                0x5703, 0x5702, 0x5701, 0x5700,
-                                                0x56ff, 0x56fe, 0x56fd, 0x56fc,
-                                                0x56fb, 0x56fa, 0x56f9, 0x56f8,
-                                                0x56f7, 0x56f6, 0x56f5, 0x56f4,
-                                                0x56f3, 0x56f2, 0x56f1, 0x56f0,
-                                                0x56ef, 0x56ee, 0x56ed, 0x56ec,
-                                                0x56eb, 0x56ea, 0x56e9, 0x56e8,
-                                                0x56e7, 0x56e6, 0x56e5, 0x56e4,
-                                                0x56e3, 0x56e2, 0x56e1, 0x56e0,
-                                                0x56df, 0x56de, 0x56dd, 0x56dc,
-                                                0x56db, 0x56da, 0x56d9, 0x56d8,
-                                                0x56d7, 0x56d6, 0x56d5, 0x56d4,
-                                                0x56d3, 0x56d2, 0x56d1, 0x56d0,
-                                                0x56cf, 0x56ce, 0x56cd, 0x56cc,
-                                                0x56cb, 0x56ca, 0x56c9, 0x56c8,
-                                                0x56c7, 0x56c6, 0x56c5, 0x56c4,
-                                                0x56c3, 0x56c2, 0x56c1, 0x56c0,
-                                                0x56bf, 0x56be, 0x56bd, 0x56bc,
-                                                0x56bb, 0x56ba, 0x56b9, 0x56b8,
-                                                0x56b7, 0x56b6, 0x56b5, 0x56b4,
-                                                0x56b3, 0x56b2, 0x56b1, 0x56b0,
-                                                0x56af, 0x56ae, 0x56ad, 0x56ac,
-                                                0x56ab, 0x56aa, 0x56a9, 0x56a8,
-                                                0x56a7, 0x56a6, 0x56a5, 0x56a4,
-                                                0x56a3, 0x56a2, 0x56a1, 0x56a0,
-                                                0x569f, 0x569e, 0x569d, 0x569c,
-                                                0x569b, 0x569a, 0x5699, 0x5698,
-                                                0x5697, 0x5696, 0x5695, 0x5694,
-                                                0x5693, 0x5692, 0x5691, 0x5690,
-                                                0x568f, 0x568e, 0x568d, 0x568c,
-                                                0x568b, 0x568a, 0x5689, 0x5688,
-                                                0x5687, 0x5686, 0x5685, 0x5684,
-                                                0x5683, 0x5682, 0x5681, 0x5680,
-                                                0x567f, 0x567e, 0x567d, 0x567c,
-                                                0x55ff, 0x55fe, 0x55fd, 0x55fc,
-                                                0x55fb, 0x55fa, 0x55f9, 0x55f8,
-                                                0x55f7, 0x55f6, 0x55f5, 0x55f4,
-                                                0x55f3, 0x55f2, 0x55f1, 0x55f0,
-                                                0x55ef, 0x55ee, 0x55ed, 0x55ec,
-                                                0x55eb, 0x55ea, 0x55e9, 0x55e8,
-                                                0x55e7, 0x55e6, 0x55e5, 0x55e4,
-                                                0x55e3, 0x55e2, 0x55e1, 0x55e0,
-                                                0x55df, 0x55de, 0x55dd, 0x55dc,
-                                                0x55db, 0x55da, 0x55d9, 0x55d8,
-                                                0x55d7, 0x55d6, 0x55d5, 0x55d4,
-                                                0x55d3, 0x55d2, 0x55d1, 0x55d0,
-                                                0x55cf, 0x55ce, 0x55cd, 0x55cc,
-                                                0x55cb, 0x55ca, 0x55c9, 0x55c8,
-                                                0x55c7, 0x55c6, 0x55c5, 0x55c4,
-                                                0x55c3, 0x55c2, 0x55c1, 0x55c0,
-                                                0x55bf, 0x55be, 0x55bd, 0x55bc,
-                                                0x55bb, 0x55ba, 0x55b9, 0x55b8,
-                                                0x55b7, 0x55b6, 0x55b5, 0x55b4,
-                                                0x55b3, 0x55b2, 0x55b1, 0x55b0,
-                                                0x55af, 0x55ae, 0x55ad, 0x55ac,
-                                                0x55ab, 0x55aa, 0x55a9, 0x55a8,
-                                                0x3fff, 0x3ffe, 0x3ffd, 0x3ffc,
-                                                0x3ffb, 0x3ffa, 0x3ff9, 0x3ff8,
-                                                0x3ff7, 0x3ff6, 0x3ff5, 0x3ff4,
-                                                0x3ff3, 0x3ff2, 0x3ff1, 0x3ff0,
-                                                0x3fef, 0x3fee, 0x3fed, 0x3fec,
-                                                0x3feb, 0x3fea, 0x3fe9, 0x3fe8,
-                                                0x3fe7, 0x3fe6, 0x3fe5, 0x3fe4,
-                                                0x3fe3, 0x3fe2, 0x3fe1, 0x3fe0,
-                                                0x3fdf, 0x3fde, 0x3fdd, 0x3fdc,
-                                                0x3fdb, 0x3fda, 0x3fd9, 0x3fd8,
-                                                0x3fd7, 0x3fd6, 0x3fd5, 0x3fd4,
-                                                0xd3, 0xd2, 0xd1, 0xd0, 0xcf,
-                                                0xce, 0xcd, 0xcc, 0xcb, 0xca,
-                                                0xc9, 0xc8, 0xc7, 0xc6, 0xc5,
-                                                0xc4, 0xc3, 0xc2, 0xc1, 0xc0,
-                                                0xbf, 0xbe, 0xbd, 0xbc, 0xbb,
-                                                0xba, 0xb9, 0xb8, 0xb7, 0xb6,
-                                                0xb5, 0xb4, 0xb3, 0xb2, 0xb1,
-                                                0xb0, 0xaf, 0xae, 0xad, 0xac,
-                                                0xab, 0xaa, 0xa9, 0xa8, 0xa7,
-                                                0xa6, 0xa5, 0xa4, 0xa3, 0xa2,
-                                                0xa1, 0xa0, 0x9f, 0x9e, 0x9d,
-                                                0x9c, 0x9b, 0x9a, 0x99, 0x98,
-                                                0x97, 0x96, 0x95, 0x94, 0x93,
-                                                0x92, 0x91, 0x90, 0x8f, 0x8e,
-                                                0x8d, 0x8c, 0x8b, 0x8a, 0x89,
-                                                0x88, 0x87, 0x86, 0x85, 0x84,
-                                                0x83, 0x82, 0x81, 0x80, 0x7f,
-                                                0x7e, 0x7d, 0x7c, 0x7b, 0x7a,
-                                                0x79, 0x78, 0x77, 0x76, 0x75,
-                                                0x74, 0x73, 0x72, 0x71, 0x70,
-                                                0x6f, 0x6e, 0x6d, 0x6c, 0x6b,
-                                                0x6a, 0x69, 0x68, 0x67, 0x66,
-                                                0x65, 0x64, 0x63, 0x62, 0x61,
-                                                0x60, 0x5f, 0x5e, 0x5d, 0x5c,
-                                                0x5b, 0x5a, 0x59, 0x58, 0x57,
-                                                0x56, 0x55, 0x54, 0x53, 0x52,
-                                                0x51, 0x50, 0x4f, 0x4e, 0x4d,
-                                                0x4c, 0x4b, 0x4a, 0x49, 0x48,
-                                                0x47, 0x46, 0x45, 0x44, 0x43,
-                                                0x42, 0x41, 0x40, 0x3f, 0x3e,
-                                                0x3d, 0x3c, 0x3b, 0x3a, 0x39,
-                                                0x38, 0x37, 0x36, 0x35, 0x34,
-                                                0x33, 0x32, 0x31, 0x30, 0x2f,
-                                                0x2e, 0x2d, 0x2c, 0x2b, 0x2a,
-                                                0x29, 0x28, 0x27, 0x26, 0x25,
-                                                0x24, 0x23, 0x22, 0x21, 0x20,
-                                                0x1f, 0x1e, 0x1d, 0x1c, 0x1b,
-                                                0x1a, 0x19, 0x18, 0x17, 0x16,
-                                                0x15, 0x14, 0x13, 0x12, 0x11,
-                                                0x10, 0xf, 0xe, 0xd, 0xc, 0xb,
-                                                0xa, 0x9, 0x8, 0x7, 0x6, 0x5,
-                                                0x4, 0x3, 0x2, 0x1, 0x0, };
+//*****************************************************************************
+//
+// pattern.h
+//
+// Generated by tools/pattern_gen for 848 words, from the table of
+// version 1.0, rule PATTERN_LEGACY; do not edit.  See memtest/pattern_rule.h.
+//
+//*****************************************************************************
+
+#define     PATTERN_ELEMENTS        848
+
+const int static_pattern[848] =
+{
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+    0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+    0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+    0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+    0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+    0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+    0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+    0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+    0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x3fd4, 0x3fd5, 0x3fd6, 0x3fd7,
+    0x3fd8, 0x3fd9, 0x3fda, 0x3fdb, 0x3fdc, 0x3fdd, 0x3fde, 0x3fdf,
+    0x3fe0, 0x3fe1, 0x3fe2, 0x3fe3, 0x3fe4, 0x3fe5, 0x3fe6, 0x3fe7,
+    0x3fe8, 0x3fe9, 0x3fea, 0x3feb, 0x3fec, 0x3fed, 0x3fee, 0x3fef,
+    0x3ff0, 0x3ff1, 0x3ff2, 0x3ff3, 0x3ff4, 0x3ff5, 0x3ff6, 0x3ff7,
+    0x3ff8, 0x3ff9, 0x3ffa, 0x3ffb, 0x3ffc, 0x3ffd, 0x3ffe, 0x3fff,
+    0x7f00, 0x7f01, 0x7f02, 0x7f03, 0x7f04, 0x7f05, 0x7f06, 0x7f07,
+    0x7f08, 0x7f09, 0x7f0a, 0x7f0b, 0x7f0c, 0x7f0d, 0x7f0e, 0x7f0f,
+    0x7f10, 0x7f11, 0x7f12, 0x7f13, 0x7f14, 0x7f15, 0x7f16, 0x7f17,
+    0x7f18, 0x7f19, 0x7f1a, 0x7f1b, 0x7f1c, 0x7f1d, 0x7f1e, 0x7f1f,
+    0x7f20, 0x7f21, 0x7f22, 0x7f23, 0x7f24, 0x7f25, 0x7f26, 0x7f27,
+    0x7f28, 0x7f29, 0x7f2a, 0x7f2b, 0x7f2c, 0x7f2d, 0x7f2e, 0x7f2f,
+    0x7f30, 0x7f31, 0x7f32, 0x7f33, 0x7f34, 0x7f35, 0x7f36, 0x7f37,
+    0x7f38, 0x7f39, 0x7f3a, 0x7f3b, 0x7f3c, 0x7f3d, 0x7f3e, 0x7f3f,
+    0x7f40, 0x7f41, 0x7f42, 0x7f43, 0x7f44, 0x7f45, 0x7f46, 0x7f47,
+    0x7f48, 0x7f49, 0x7f4a, 0x7f4b, 0x7f4c, 0x7f4d, 0x7f4e, 0x7f4f,
+    0x7f50, 0x7f51, 0x7f52, 0x7f53, 0x7f54, 0x7f55, 0x7f56, 0x7f57,
+    0x7f58, 0x7f59, 0x7f5a, 0x7f5b, 0x7f5c, 0x7f5d, 0x7f5e, 0x7f5f,
+    0x7f60, 0x7f61, 0x7f62, 0x7f63, 0x7f64, 0x7f65, 0x7f66, 0x7f67,
+    0x7f68, 0x7f69, 0x7f6a, 0x7f6b, 0x7f6c, 0x7f6d, 0x7f6e, 0x7f6f,
+    0x7f70, 0x7f71, 0x7f72, 0x7f73, 0x7f74, 0x7f75, 0x7f76, 0x7f77,
+    0x7f78, 0x7f79, 0x7f7a, 0x7f7b, 0x7f7c, 0x7f7d, 0x7f7e, 0x7f7f,
+    0x7f80, 0x7f81, 0x7f82, 0x7f83, 0x7f84, 0x7f85, 0x7f86, 0x7f87,
+    0x7f88, 0x7f89, 0x7f8a, 0x7f8b, 0x7f8c, 0x7f8d, 0x7f8e, 0x7f8f,
+    0x7f90, 0x7f91, 0x7f92, 0x7f93, 0x7f94, 0x7f95, 0x7f96, 0x7f97,
+    0x7f98, 0x7f99, 0x7f9a, 0x7f9b, 0x7f9c, 0x7f9d, 0x7f9e, 0x7f9f,
+    0x7fa0, 0x7fa1, 0x7fa2, 0x7fa3, 0x7fa4, 0x7fa5, 0x7fa6, 0x7fa7,
+    0x55a8, 0x55a9, 0x55aa, 0x55ab, 0x55ac, 0x55ad, 0x55ae, 0x55af,
+    0x55b0, 0x55b1, 0x55b2, 0x55b3, 0x55b4, 0x55b5, 0x55b6, 0x55b7,
+    0x55b8, 0x55b9, 0x55ba, 0x55bb, 0x55bc, 0x55bd, 0x55be, 0x55bf,
+    0x55c0, 0x55c1, 0x55c2, 0x55c3, 0x55c4, 0x55c5, 0x55c6, 0x55c7,
+    0x55c8, 0x55c9, 0x55ca, 0x55cb, 0x55cc, 0x55cd, 0x55ce, 0x55cf,
+    0x55d0, 0x55d1, 0x55d2, 0x55d3, 0x55d4, 0x55d5, 0x55d6, 0x55d7,
+    0x55d8, 0x55d9, 0x55da, 0x55db, 0x55dc, 0x55dd, 0x55de, 0x55df,
+    0x55e0, 0x55e1, 0x55e2, 0x55e3, 0x55e4, 0x55e5, 0x55e6, 0x55e7,
+    0x55e8, 0x55e9, 0x55ea, 0x55eb, 0x55ec, 0x55ed, 0x55ee, 0x55ef,
+    0x55f0, 0x55f1, 0x55f2, 0x55f3, 0x55f4, 0x55f5, 0x55f6, 0x55f7,
+    0x55f8, 0x55f9, 0x55fa, 0x55fb, 0x55fc, 0x55fd, 0x55fe, 0x55ff,
+    -0x5600, -0x55ff, -0x55fe, -0x55fd, -0x55fc, -0x55fb, -0x55fa, -0x55f9,
+    -0x55f8, -0x55f7, -0x55f6, -0x55f5, -0x55f4, -0x55f3, -0x55f2, -0x55f1,
+    -0x55f0, -0x55ef, -0x55ee, -0x55ed, -0x55ec, -0x55eb, -0x55ea, -0x55e9,
+    -0x55e8, -0x55e7, -0x55e6, -0x55e5, -0x55e4, -0x55e3, -0x55e2, -0x55e1,
+    -0x55e0, -0x55df, -0x55de, -0x55dd, -0x55dc, -0x55db, -0x55da, -0x55d9,
+    -0x55d8, -0x55d7, -0x55d6, -0x55d5, -0x55d4, -0x55d3, -0x55d2, -0x55d1,
+    -0x55d0, -0x55cf, -0x55ce, -0x55cd, -0x55cc, -0x55cb, -0x55ca, -0x55c9,
+    -0x55c8, -0x55c7, -0x55c6, -0x55c5, -0x55c4, -0x55c3, -0x55c2, -0x55c1,
+    -0x55c0, -0x55bf, -0x55be, -0x55bd, -0x55bc, -0x55bb, -0x55ba, -0x55b9,
+    -0x55b8, -0x55b7, -0x55b6, -0x55b5, -0x55b4, -0x55b3, -0x55b2, -0x55b1,
+    -0x55b0, -0x55af, -0x55ae, -0x55ad, -0x55ac, -0x55ab, -0x55aa, -0x55a9,
+    -0x55a8, -0x55a7, -0x55a6, -0x55a5, -0x55a4, -0x55a3, -0x55a2, -0x55a1,
+    -0x55a0, -0x559f, -0x559e, -0x559d, -0x559c, -0x559b, -0x559a, -0x5599,
+    -0x5598, -0x5597, -0x5596, -0x5595, -0x5594, -0x5593, -0x5592, -0x5591,
+    -0x5590, -0x558f, -0x558e, -0x558d, -0x558c, -0x558b, -0x558a, -0x5589,
+    -0x5588, -0x5587, -0x5586, -0x5585, 0x567c, 0x567d, 0x567e, 0x567f,
+    0x5680, 0x5681, 0x5682, 0x5683, 0x5684, 0x5685, 0x5686, 0x5687,
+    0x5688, 0x5689, 0x568a, 0x568b, 0x568c, 0x568d, 0x568e, 0x568f,
+    0x5690, 0x5691, 0x5692, 0x5693, 0x5694, 0x5695, 0x5696, 0x5697,
+    0x5698, 0x5699, 0x569a, 0x569b, 0x569c, 0x569d, 0x569e, 0x569f,
+    0x56a0, 0x56a1, 0x56a2, 0x56a3, 0x56a4, 0x56a5, 0x56a6, 0x56a7,
+    0x56a8, 0x56a9, 0x56aa, 0x56ab, 0x56ac, 0x56ad, 0x56ae, 0x56af,
+    0x56b0, 0x56b1, 0x56b2, 0x56b3, 0x56b4, 0x56b5, 0x56b6, 0x56b7,
+    0x56b8, 0x56b9, 0x56ba, 0x56bb, 0x56bc, 0x56bd, 0x56be, 0x56bf,
+    0x56c0, 0x56c1, 0x56c2, 0x56c3, 0x56c4, 0x56c5, 0x56c6, 0x56c7,
+    0x56c8, 0x56c9, 0x56ca, 0x56cb, 0x56cc, 0x56cd, 0x56ce, 0x56cf,
+    0x56d0, 0x56d1, 0x56d2, 0x56d3, 0x56d4, 0x56d5, 0x56d6, 0x56d7,
+    0x56d8, 0x56d9, 0x56da, 0x56db, 0x56dc, 0x56dd, 0x56de, 0x56df,
+    0x56e0, 0x56e1, 0x56e2, 0x56e3, 0x56e4, 0x56e5, 0x56e6, 0x56e7,
+    0x56e8, 0x56e9, 0x56ea, 0x56eb, 0x56ec, 0x56ed, 0x56ee, 0x56ef,
+    0x56f0, 0x56f1, 0x56f2, 0x56f3, 0x56f4, 0x56f5, 0x56f6, 0x56f7,
+    0x56f8, 0x56f9, 0x56fa, 0x56fb, 0x56fc, 0x56fd, 0x56fe, 0x56ff,
+    0x5700, 0x5701, 0x5702, 0x5703, 0x5704, 0x5705, 0x5706, 0x5707,
+    0x5708, 0x5709, 0x570a, 0x570b, 0x570c, 0x570d, 0x570e, 0x570f,
+    0x5710, 0x5711, 0x5712, 0x5713, 0x5714, 0x5715, 0x5716, 0x5717,
+    0x5718, 0x5719, 0x571a, 0x571b, 0x571c, 0x571d, 0x571e, 0x571f,
+    0x5720, 0x5721, 0x5722, 0x5723, 0x5724, 0x5725, 0x5726, 0x5727,
+    0x5728, 0x5729, 0x572a, 0x572b, 0x572c, 0x572d, 0x572e, 0x572f,
+    0x5730, 0x5731, 0x5732, 0x5733, 0x5734, 0x5735, 0x5736, 0x5737,
+    0x5738, 0x5739, 0x573a, 0x573b, 0x573c, 0x573d, 0x573e, 0x573f,
+    0x5740, 0x5741, 0x5742, 0x5743, 0x5744, 0x5745, 0x5746, 0x5747,
+    0x5748, 0x5749, 0x574a, 0x574b, 0x574c, 0x574d, 0x574e, 0x574f
+};
+
+const int static_pattern_forward[848] =
+{
+    -0x5600, -0x55ff, -0x55fe, -0x55fd, -0x55fc, -0x55fb, -0x55fa, -0x55f9,
+    -0x55f8, -0x55f7, -0x55f6, -0x55f5, -0x55f4, -0x55f3, -0x55f2, -0x55f1,
+    -0x55f0, -0x55ef, -0x55ee, -0x55ed, -0x55ec, -0x55eb, -0x55ea, -0x55e9,
+    -0x55e8, -0x55e7, -0x55e6, -0x55e5, -0x55e4, -0x55e3, -0x55e2, -0x55e1,
+    -0x55e0, -0x55df, -0x55de, -0x55dd, -0x55dc, -0x55db, -0x55da, -0x55d9,
+    -0x55d8, -0x55d7, -0x55d6, -0x55d5, -0x55d4, -0x55d3, -0x55d2, -0x55d1,
+    -0x55d0, -0x55cf, -0x55ce, -0x55cd, -0x55cc, -0x55cb, -0x55ca, -0x55c9,
+    -0x55c8, -0x55c7, -0x55c6, -0x55c5, -0x55c4, -0x55c3, -0x55c2, -0x55c1,
+    -0x55c0, -0x55bf, -0x55be, -0x55bd, -0x55bc, -0x55bb, -0x55ba, -0x55b9,
+    -0x55b8, -0x55b7, -0x55b6, -0x55b5, -0x55b4, -0x55b3, -0x55b2, -0x55b1,
+    -0x55b0, -0x55af, -0x55ae, -0x55ad, -0x55ac, -0x55ab, -0x55aa, -0x55a9,
+    -0x55a8, -0x55a7, -0x55a6, -0x55a5, -0x55a4, -0x55a3, -0x55a2, -0x55a1,
+    -0x55a0, -0x559f, -0x559e, -0x559d, -0x559c, -0x559b, -0x559a, -0x5599,
+    -0x5598, -0x5597, -0x5596, -0x5595, -0x5594, -0x5593, -0x5592, -0x5591,
+    -0x5590, -0x558f, -0x558e, -0x558d, -0x558c, -0x558b, -0x558a, -0x5589,
+    -0x5588, -0x5587, -0x5586, -0x5585, 0x0000, 0x0001, 0x0002, 0x0003,
+    0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b,
+    0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013,
+    0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b,
+    0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023,
+    0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b,
+    0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033,
+    0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b,
+    0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b,
+    0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b,
+    0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+    0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b,
+    0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b,
+    0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b,
+    0x009c, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3,
+    0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab,
+    0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3,
+    0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb,
+    0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3,
+    0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb,
+    0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d3,
+    0x3fd4, 0x3fd5, 0x3fd6, 0x3fd7, 0x3fd8, 0x3fd9, 0x3fda, 0x3fdb,
+    0x3fdc, 0x3fdd, 0x3fde, 0x3fdf, 0x3fe0, 0x3fe1, 0x3fe2, 0x3fe3,
+    0x3fe4, 0x3fe5, 0x3fe6, 0x3fe7, 0x3fe8, 0x3fe9, 0x3fea, 0x3feb,
+    0x3fec, 0x3fed, 0x3fee, 0x3fef, 0x3ff0, 0x3ff1, 0x3ff2, 0x3ff3,
+    0x3ff4, 0x3ff5, 0x3ff6, 0x3ff7, 0x3ff8, 0x3ff9, 0x3ffa, 0x3ffb,
+    0x3ffc, 0x3ffd, 0x3ffe, 0x3fff, 0x55a8, 0x55a9, 0x55aa, 0x55ab,
+    0x55ac, 0x55ad, 0x55ae, 0x55af, 0x55b0, 0x55b1, 0x55b2, 0x55b3,
+    0x55b4, 0x55b5, 0x55b6, 0x55b7, 0x55b8, 0x55b9, 0x55ba, 0x55bb,
+    0x55bc, 0x55bd, 0x55be, 0x55bf, 0x55c0, 0x55c1, 0x55c2, 0x55c3,
+    0x55c4, 0x55c5, 0x55c6, 0x55c7, 0x55c8, 0x55c9, 0x55ca, 0x55cb,
+    0x55cc, 0x55cd, 0x55ce, 0x55cf, 0x55d0, 0x55d1, 0x55d2, 0x55d3,
+    0x55d4, 0x55d5, 0x55d6, 0x55d7, 0x55d8, 0x55d9, 0x55da, 0x55db,
+    0x55dc, 0x55dd, 0x55de, 0x55df, 0x55e0, 0x55e1, 0x55e2, 0x55e3,
+    0x55e4, 0x55e5, 0x55e6, 0x55e7, 0x55e8, 0x55e9, 0x55ea, 0x55eb,
+    0x55ec, 0x55ed, 0x55ee, 0x55ef, 0x55f0, 0x55f1, 0x55f2, 0x55f3,
+    0x55f4, 0x55f5, 0x55f6, 0x55f7, 0x55f8, 0x55f9, 0x55fa, 0x55fb,
+    0x55fc, 0x55fd, 0x55fe, 0x55ff, 0x567c, 0x567d, 0x567e, 0x567f,
+    0x5680, 0x5681, 0x5682, 0x5683, 0x5684, 0x5685, 0x5686, 0x5687,
+    0x5688, 0x5689, 0x568a, 0x568b, 0x568c, 0x568d, 0x568e, 0x568f,
+    0x5690, 0x5691, 0x5692, 0x5693, 0x5694, 0x5695, 0x5696, 0x5697,
+    0x5698, 0x5699, 0x569a, 0x569b, 0x569c, 0x569d, 0x569e, 0x569f,
+    0x56a0, 0x56a1, 0x56a2, 0x56a3, 0x56a4, 0x56a5, 0x56a6, 0x56a7,
+    0x56a8, 0x56a9, 0x56aa, 0x56ab, 0x56ac, 0x56ad, 0x56ae, 0x56af,
+    0x56b0, 0x56b1, 0x56b2, 0x56b3, 0x56b4, 0x56b5, 0x56b6, 0x56b7,
+    0x56b8, 0x56b9, 0x56ba, 0x56bb, 0x56bc, 0x56bd, 0x56be, 0x56bf,
+    0x56c0, 0x56c1, 0x56c2, 0x56c3, 0x56c4, 0x56c5, 0x56c6, 0x56c7,
+    0x56c8, 0x56c9, 0x56ca, 0x56cb, 0x56cc, 0x56cd, 0x56ce, 0x56cf,
+    0x56d0, 0x56d1, 0x56d2, 0x56d3, 0x56d4, 0x56d5, 0x56d6, 0x56d7,
+    0x56d8, 0x56d9, 0x56da, 0x56db, 0x56dc, 0x56dd, 0x56de, 0x56df,
+    0x56e0, 0x56e1, 0x56e2, 0x56e3, 0x56e4, 0x56e5, 0x56e6, 0x56e7,
+    0x56e8, 0x56e9, 0x56ea, 0x56eb, 0x56ec, 0x56ed, 0x56ee, 0x56ef,
+    0x56f0, 0x56f1, 0x56f2, 0x56f3, 0x56f4, 0x56f5, 0x56f6, 0x56f7,
+    0x56f8, 0x56f9, 0x56fa, 0x56fb, 0x56fc, 0x56fd, 0x56fe, 0x56ff,
+    0x5700, 0x5701, 0x5702, 0x5703, 0x5704, 0x5705, 0x5706, 0x5707,
+    0x5708, 0x5709, 0x570a, 0x570b, 0x570c, 0x570d, 0x570e, 0x570f,
+    0x5710, 0x5711, 0x5712, 0x5713, 0x5714, 0x5715, 0x5716, 0x5717,
+    0x5718, 0x5719, 0x571a, 0x571b, 0x571c, 0x571d, 0x571e, 0x571f,
+    0x5720, 0x5721, 0x5722, 0x5723, 0x5724, 0x5725, 0x5726, 0x5727,
+    0x5728, 0x5729, 0x572a, 0x572b, 0x572c, 0x572d, 0x572e, 0x572f,
+    0x5730, 0x5731, 0x5732, 0x5733, 0x5734, 0x5735, 0x5736, 0x5737,
+    0x5738, 0x5739, 0x573a, 0x573b, 0x573c, 0x573d, 0x573e, 0x573f,
+    0x5740, 0x5741, 0x5742, 0x5743, 0x5744, 0x5745, 0x5746, 0x5747,
+    0x5748, 0x5749, 0x574a, 0x574b, 0x574c, 0x574d, 0x574e, 0x574f,
+    0x7f00, 0x7f01, 0x7f02, 0x7f03, 0x7f04, 0x7f05, 0x7f06, 0x7f07,
+    0x7f08, 0x7f09, 0x7f0a, 0x7f0b, 0x7f0c, 0x7f0d, 0x7f0e, 0x7f0f,
+    0x7f10, 0x7f11, 0x7f12, 0x7f13, 0x7f14, 0x7f15, 0x7f16, 0x7f17,
+    0x7f18, 0x7f19, 0x7f1a, 0x7f1b, 0x7f1c, 0x7f1d, 0x7f1e, 0x7f1f,
+    0x7f20, 0x7f21, 0x7f22, 0x7f23, 0x7f24, 0x7f25, 0x7f26, 0x7f27,
+    0x7f28, 0x7f29, 0x7f2a, 0x7f2b, 0x7f2c, 0x7f2d, 0x7f2e, 0x7f2f,
+    0x7f30, 0x7f31, 0x7f32, 0x7f33, 0x7f34, 0x7f35, 0x7f36, 0x7f37,
+    0x7f38, 0x7f39, 0x7f3a, 0x7f3b, 0x7f3c, 0x7f3d, 0x7f3e, 0x7f3f,
+    0x7f40, 0x7f41, 0x7f42, 0x7f43, 0x7f44, 0x7f45, 0x7f46, 0x7f47,
+    0x7f48, 0x7f49, 0x7f4a, 0x7f4b, 0x7f4c, 0x7f4d, 0x7f4e, 0x7f4f,
+    0x7f50, 0x7f51, 0x7f52, 0x7f53, 0x7f54, 0x7f55, 0x7f56, 0x7f57,
+    0x7f58, 0x7f59, 0x7f5a, 0x7f5b, 0x7f5c, 0x7f5d, 0x7f5e, 0x7f5f,
+    0x7f60, 0x7f61, 0x7f62, 0x7f63, 0x7f64, 0x7f65, 0x7f66, 0x7f67,
+    0x7f68, 0x7f69, 0x7f6a, 0x7f6b, 0x7f6c, 0x7f6d, 0x7f6e, 0x7f6f,
+    0x7f70, 0x7f71, 0x7f72, 0x7f73, 0x7f74, 0x7f75, 0x7f76, 0x7f77,
+    0x7f78, 0x7f79, 0x7f7a, 0x7f7b, 0x7f7c, 0x7f7d, 0x7f7e, 0x7f7f,
+    0x7f80, 0x7f81, 0x7f82, 0x7f83, 0x7f84, 0x7f85, 0x7f86, 0x7f87,
+    0x7f88, 0x7f89, 0x7f8a, 0x7f8b, 0x7f8c, 0x7f8d, 0x7f8e, 0x7f8f,
+    0x7f90, 0x7f91, 0x7f92, 0x7f93, 0x7f94, 0x7f95, 0x7f96, 0x7f97,
+    0x7f98, 0x7f99, 0x7f9a, 0x7f9b, 0x7f9c, 0x7f9d, 0x7f9e, 0x7f9f,
+    0x7fa0, 0x7fa1, 0x7fa2, 0x7fa3, 0x7fa4, 0x7fa5, 0x7fa6, 0x7fa7
+};
+
+const int static_pattern_reverse[848] =
+{
+    0x7fa7, 0x7fa6, 0x7fa5, 0x7fa4, 0x7fa3, 0x7fa2, 0x7fa1, 0x7fa0,
+    0x7f9f, 0x7f9e, 0x7f9d, 0x7f9c, 0x7f9b, 0x7f9a, 0x7f99, 0x7f98,
+    0x7f97, 0x7f96, 0x7f95, 0x7f94, 0x7f93, 0x7f92, 0x7f91, 0x7f90,
+    0x7f8f, 0x7f8e, 0x7f8d, 0x7f8c, 0x7f8b, 0x7f8a, 0x7f89, 0x7f88,
+    0x7f87, 0x7f86, 0x7f85, 0x7f84, 0x7f83, 0x7f82, 0x7f81, 0x7f80,
+    0x7f7f, 0x7f7e, 0x7f7d, 0x7f7c, 0x7f7b, 0x7f7a, 0x7f79, 0x7f78,
+    0x7f77, 0x7f76, 0x7f75, 0x7f74, 0x7f73, 0x7f72, 0x7f71, 0x7f70,
+    0x7f6f, 0x7f6e, 0x7f6d, 0x7f6c, 0x7f6b, 0x7f6a, 0x7f69, 0x7f68,
+    0x7f67, 0x7f66, 0x7f65, 0x7f64, 0x7f63, 0x7f62, 0x7f61, 0x7f60,
+    0x7f5f, 0x7f5e, 0x7f5d, 0x7f5c, 0x7f5b, 0x7f5a, 0x7f59, 0x7f58,
+    0x7f57, 0x7f56, 0x7f55, 0x7f54, 0x7f53, 0x7f52, 0x7f51, 0x7f50,
+    0x7f4f, 0x7f4e, 0x7f4d, 0x7f4c, 0x7f4b, 0x7f4a, 0x7f49, 0x7f48,
+    0x7f47, 0x7f46, 0x7f45, 0x7f44, 0x7f43, 0x7f42, 0x7f41, 0x7f40,
+    0x7f3f, 0x7f3e, 0x7f3d, 0x7f3c, 0x7f3b, 0x7f3a, 0x7f39, 0x7f38,
+    0x7f37, 0x7f36, 0x7f35, 0x7f34, 0x7f33, 0x7f32, 0x7f31, 0x7f30,
+    0x7f2f, 0x7f2e, 0x7f2d, 0x7f2c, 0x7f2b, 0x7f2a, 0x7f29, 0x7f28,
+    0x7f27, 0x7f26, 0x7f25, 0x7f24, 0x7f23, 0x7f22, 0x7f21, 0x7f20,
+    0x7f1f, 0x7f1e, 0x7f1d, 0x7f1c, 0x7f1b, 0x7f1a, 0x7f19, 0x7f18,
+    0x7f17, 0x7f16, 0x7f15, 0x7f14, 0x7f13, 0x7f12, 0x7f11, 0x7f10,
+    0x7f0f, 0x7f0e, 0x7f0d, 0x7f0c, 0x7f0b, 0x7f0a, 0x7f09, 0x7f08,
+    0x7f07, 0x7f06, 0x7f05, 0x7f04, 0x7f03, 0x7f02, 0x7f01, 0x7f00,
+    0x574f, 0x574e, 0x574d, 0x574c, 0x574b, 0x574a, 0x5749, 0x5748,
+    0x5747, 0x5746, 0x5745, 0x5744, 0x5743, 0x5742, 0x5741, 0x5740,
+    0x573f, 0x573e, 0x573d, 0x573c, 0x573b, 0x573a, 0x5739, 0x5738,
+    0x5737, 0x5736, 0x5735, 0x5734, 0x5733, 0x5732, 0x5731, 0x5730,
+    0x572f, 0x572e, 0x572d, 0x572c, 0x572b, 0x572a, 0x5729, 0x5728,
+    0x5727, 0x5726, 0x5725, 0x5724, 0x5723, 0x5722, 0x5721, 0x5720,
+    0x571f, 0x571e, 0x571d, 0x571c, 0x571b, 0x571a, 0x5719, 0x5718,
+    0x5717, 0x5716, 0x5715, 0x5714, 0x5713, 0x5712, 0x5711, 0x5710,
+    0x570f, 0x570e, 0x570d, 0x570c, 0x570b, 0x570a, 0x5709, 0x5708,
+    0x5707, 0x5706, 0x5705, 0x5704, 0x5703, 0x5702, 0x5701, 0x5700,
+    0x56ff, 0x56fe, 0x56fd, 0x56fc, 0x56fb, 0x56fa, 0x56f9, 0x56f8,
+    0x56f7, 0x56f6, 0x56f5, 0x56f4, 0x56f3, 0x56f2, 0x56f1, 0x56f0,
+    0x56ef, 0x56ee, 0x56ed, 0x56ec, 0x56eb, 0x56ea, 0x56e9, 0x56e8,
+    0x56e7, 0x56e6, 0x56e5, 0x56e4, 0x56e3, 0x56e2, 0x56e1, 0x56e0,
+    0x56df, 0x56de, 0x56dd, 0x56dc, 0x56db, 0x56da, 0x56d9, 0x56d8,
+    0x56d7, 0x56d6, 0x56d5, 0x56d4, 0x56d3, 0x56d2, 0x56d1, 0x56d0,
+    0x56cf, 0x56ce, 0x56cd, 0x56cc, 0x56cb, 0x56ca, 0x56c9, 0x56c8,
+    0x56c7, 0x56c6, 0x56c5, 0x56c4, 0x56c3, 0x56c2, 0x56c1, 0x56c0,
+    0x56bf, 0x56be, 0x56bd, 0x56bc, 0x56bb, 0x56ba, 0x56b9, 0x56b8,
+    0x56b7, 0x56b6, 0x56b5, 0x56b4, 0x56b3, 0x56b2, 0x56b1, 0x56b0,
+    0x56af, 0x56ae, 0x56ad, 0x56ac, 0x56ab, 0x56aa, 0x56a9, 0x56a8,
+    0x56a7, 0x56a6, 0x56a5, 0x56a4, 0x56a3, 0x56a2, 0x56a1, 0x56a0,
+    0x569f, 0x569e, 0x569d, 0x569c, 0x569b, 0x569a, 0x5699, 0x5698,
+    0x5697, 0x5696, 0x5695, 0x5694, 0x5693, 0x5692, 0x5691, 0x5690,
+    0x568f, 0x568e, 0x568d, 0x568c, 0x568b, 0x568a, 0x5689, 0x5688,
+    0x5687, 0x5686, 0x5685, 0x5684, 0x5683, 0x5682, 0x5681, 0x5680,
+    0x567f, 0x567e, 0x567d, 0x567c, 0x55ff, 0x55fe, 0x55fd, 0x55fc,
+    0x55fb, 0x55fa, 0x55f9, 0x55f8, 0x55f7, 0x55f6, 0x55f5, 0x55f4,
+    0x55f3, 0x55f2, 0x55f1, 0x55f0, 0x55ef, 0x55ee, 0x55ed, 0x55ec,
+    0x55eb, 0x55ea, 0x55e9, 0x55e8, 0x55e7, 0x55e6, 0x55e5, 0x55e4,
+    0x55e3, 0x55e2, 0x55e1, 0x55e0, 0x55df, 0x55de, 0x55dd, 0x55dc,
+    0x55db, 0x55da, 0x55d9, 0x55d8, 0x55d7, 0x55d6, 0x55d5, 0x55d4,
+    0x55d3, 0x55d2, 0x55d1, 0x55d0, 0x55cf, 0x55ce, 0x55cd, 0x55cc,
+    0x55cb, 0x55ca, 0x55c9, 0x55c8, 0x55c7, 0x55c6, 0x55c5, 0x55c4,
+    0x55c3, 0x55c2, 0x55c1, 0x55c0, 0x55bf, 0x55be, 0x55bd, 0x55bc,
+    0x55bb, 0x55ba, 0x55b9, 0x55b8, 0x55b7, 0x55b6, 0x55b5, 0x55b4,
+    0x55b3, 0x55b2, 0x55b1, 0x55b0, 0x55af, 0x55ae, 0x55ad, 0x55ac,
+    0x55ab, 0x55aa, 0x55a9, 0x55a8, 0x3fff, 0x3ffe, 0x3ffd, 0x3ffc,
+    0x3ffb, 0x3ffa, 0x3ff9, 0x3ff8, 0x3ff7, 0x3ff6, 0x3ff5, 0x3ff4,
+    0x3ff3, 0x3ff2, 0x3ff1, 0x3ff0, 0x3fef, 0x3fee, 0x3fed, 0x3fec,
+    0x3feb, 0x3fea, 0x3fe9, 0x3fe8, 0x3fe7, 0x3fe6, 0x3fe5, 0x3fe4,
+    0x3fe3, 0x3fe2, 0x3fe1, 0x3fe0, 0x3fdf, 0x3fde, 0x3fdd, 0x3fdc,
+    0x3fdb, 0x3fda, 0x3fd9, 0x3fd8, 0x3fd7, 0x3fd6, 0x3fd5, 0x3fd4,
+    0x00d3, 0x00d2, 0x00d1, 0x00d0, 0x00cf, 0x00ce, 0x00cd, 0x00cc,
+    0x00cb, 0x00ca, 0x00c9, 0x00c8, 0x00c7, 0x00c6, 0x00c5, 0x00c4,
+    0x00c3, 0x00c2, 0x00c1, 0x00c0, 0x00bf, 0x00be, 0x00bd, 0x00bc,
+    0x00bb, 0x00ba, 0x00b9, 0x00b8, 0x00b7, 0x00b6, 0x00b5, 0x00b4,
+    0x00b3, 0x00b2, 0x00b1, 0x00b0, 0x00af, 0x00ae, 0x00ad, 0x00ac,
+    0x00ab, 0x00aa, 0x00a9, 0x00a8, 0x00a7, 0x00a6, 0x00a5, 0x00a4,
+    0x00a3, 0x00a2, 0x00a1, 0x00a0, 0x009f, 0x009e, 0x009d, 0x009c,
+    0x009b, 0x009a, 0x0099, 0x0098, 0x0097, 0x0096, 0x0095, 0x0094,
+    0x0093, 0x0092, 0x0091, 0x0090, 0x008f, 0x008e, 0x008d, 0x008c,
+    0x008b, 0x008a, 0x0089, 0x0088, 0x0087, 0x0086, 0x0085, 0x0084,
+    0x0083, 0x0082, 0x0081, 0x0080, 0x007f, 0x007e, 0x007d, 0x007c,
+    0x007b, 0x007a, 0x0079, 0x0078, 0x0077, 0x0076, 0x0075, 0x0074,
+    0x0073, 0x0072, 0x0071, 0x0070, 0x006f, 0x006e, 0x006d, 0x006c,
+    0x006b, 0x006a, 0x0069, 0x0068, 0x0067, 0x0066, 0x0065, 0x0064,
+    0x0063, 0x0062, 0x0061, 0x0060, 0x005f, 0x005e, 0x005d, 0x005c,
+    0x005b, 0x005a, 0x0059, 0x0058, 0x0057, 0x0056, 0x0055, 0x0054,
+    0x0053, 0x0052, 0x0051, 0x0050, 0x004f, 0x004e, 0x004d, 0x004c,
+    0x004b, 0x004a, 0x0049, 0x0048, 0x0047, 0x0046, 0x0045, 0x0044,
+    0x0043, 0x0042, 0x0041, 0x0040, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x003b, 0x003a, 0x0039, 0x0038, 0x0037, 0x0036, 0x0035, 0x0034,
+    0x0033, 0x0032, 0x0031, 0x0030, 0x002f, 0x002e, 0x002d, 0x002c,
+    0x002b, 0x002a, 0x0029, 0x0028, 0x0027, 0x0026, 0x0025, 0x0024,
+    0x0023, 0x0022, 0x0021, 0x0020, 0x001f, 0x001e, 0x001d, 0x001c,
+    0x001b, 0x001a, 0x0019, 0x0018, 0x0017, 0x0016, 0x0015, 0x0014,
+    0x0013, 0x0012, 0x0011, 0x0010, 0x000f, 0x000e, 0x000d, 0x000c,
+    0x000b, 0x000a, 0x0009, 0x0008, 0x0007, 0x0006, 0x0005, 0x0004,
+    0x0003, 0x0002, 0x0001, 0x0000, -0x5585, -0x5586, -0x5587, -0x5588,
+    -0x5589, -0x558a, -0x558b, -0x558c, -0x558d, -0x558e, -0x558f, -0x5590,
+    -0x5591, -0x5592, -0x5593, -0x5594, -0x5595, -0x5596, -0x5597, -0x5598,
+    -0x5599, -0x559a, -0x559b, -0x559c, -0x559d, -0x559e, -0x559f, -0x55a0,
+    -0x55a1, -0x55a2, -0x55a3, -0x55a4, -0x55a5, -0x55a6, -0x55a7, -0x55a8,
+    -0x55a9, -0x55aa, -0x55ab, -0x55ac, -0x55ad, -0x55ae, -0x55af, -0x55b0,
+    -0x55b1, -0x55b2, -0x55b3, -0x55b4, -0x55b5, -0x55b6, -0x55b7, -0x55b8,
+    -0x55b9, -0x55ba, -0x55bb, -0x55bc, -0x55bd, -0x55be, -0x55bf, -0x55c0,
+    -0x55c1, -0x55c2, -0x55c3, -0x55c4, -0x55c5, -0x55c6, -0x55c7, -0x55c8,
+    -0x55c9, -0x55ca, -0x55cb, -0x55cc, -0x55cd, -0x55ce, -0x55cf, -0x55d0,
+    -0x55d1, -0x55d2, -0x55d3, -0x55d4, -0x55d5, -0x55d6, -0x55d7, -0x55d8,
+    -0x55d9, -0x55da, -0x55db, -0x55dc, -0x55dd, -0x55de, -0x55df, -0x55e0,
+    -0x55e1, -0x55e2, -0x55e3, -0x55e4, -0x55e5, -0x55e6, -0x55e7, -0x55e8,
+    -0x55e9, -0x55ea, -0x55eb, -0x55ec, -0x55ed, -0x55ee, -0x55ef, -0x55f0,
+    -0x55f1, -0x55f2, -0x55f3, -0x55f4, -0x55f5, -0x55f6, -0x55f7, -0x55f8,
+    -0x55f9, -0x55fa, -0x55fb, -0x55fc, -0x55fd, -0x55fe, -0x55ff, -0x5600
+};
+
@@ -16,7 +16,7 @@
 // This software is otimized for the MSP430F2619.
 //
 // The output is designed to go out the UART at a speed of 9,600 baud and uses a tiny
-// print to reduce the printf footprint.  The tiny printf can be downloaded from 
+// print to reduce the printf footprint.  The tiny printf in the platform layer follows 
 // http://www.43oh.com/forum/viewtopic.php?f=10&t=1732  All of the output is YAML
 // parsable.
 //
@@ -26,18 +26,14 @@
 //*****************************************************************************/
 
 
-#include <msp430.h>
-#include <string.h>
-#include "stdio.h"
+#include "platform.h"
+#include "telemetry.h"
 
 #include "pattern.h"
 
 void printHeader(void);
-void sendByte(char);
-void initUART(void);
-void initMSP430();
 
-#define     robust_printing           1
+#define     robust_printing           PRINTING_ADAPTIVE
 #define     side                      12
 #define     change_rate               50
 
@@ -101,6 +97,7 @@ int checker(unsigned long golden_matrix[][side],
             unsigned long results_matrix[][side])
 {
     int first_error = 0;
+    int robust = -1;
     int num_of_errors = 0;
     int i = 0;
     int j = 0;
@@ -112,28 +109,33 @@ int checker(unsigned long golden_matrix[][side],
 
            if (golden_matrix[i][j] != results_matrix[i][j])
             {
+                // printing is decided at the first mismatch, by the output budget
+                if (robust < 0)
+                {
+                    robust = robustPrinting(robust_printing, ind);
+                }
                 if (!first_error)
                 {
-                    if (!in_block && robust_printing)
+                    if (!in_block && robust)
                     {
-                        printf(" - i: %u\r\n", ind);
-                        printf("   E: {%i_%i: [%x, %x],", i, j,
-                               golden_matrix[i][j], results_matrix[i][j]);
+                        reportIteration(ind);
+                        reportElementRowCol('E', 1, i, j, golden_matrix[i][j],
+                                            results_matrix[i][j]);
                         first_error = 1;
                         in_block = 1;
                     }
-                    else if (in_block && robust_printing)
+                    else if (in_block && robust)
                     {
-                        printf("   E: {%i_%i: [%x, %x],", i, j,
-                               golden_matrix[i][j], results_matrix[i][j]);
+                        reportElementRowCol('E', 1, i, j, golden_matrix[i][j],
+                                            results_matrix[i][j]);
                         first_error = 1;
                     }
                 }
                 else
                 {
-                    if (robust_printing)
-                        printf("%i_%i: [%x, %x],", i, j, golden_matrix[i][j],
-                               results_matrix[i][j]);
+                    if (robust)
+                        reportElementRowCol('E', 0, i, j, golden_matrix[i][j],
+                                            results_matrix[i][j]);
 
                 }
                 num_of_errors++;
@@ -143,21 +145,21 @@ int checker(unsigned long golden_matrix[][side],
 
     if (first_error)
     {
-        printf("}\r\n");
+        reportElementsEnd();
         first_error = 0;
     }
 
-    if (!robust_printing && (num_of_errors > 0))
+    if (!robust && (num_of_errors > 0))
     {
         if (!in_block)
         {
-            printf(" - i: %u\r\n", ind);
-            printf("   E: %i\r\n", num_of_errors);
+            reportIteration(ind);
+            reportCount('E', num_of_errors);
             in_block = 1;
         }
         else
         {
-            printf("   E: %i\r\n", num_of_errors);
+            reportCount('E', num_of_errors);
         }
     }
 
@@ -207,11 +209,12 @@ void matrix_multiply_test()
                 initUART();
             }
 
-            printf("# %u, %i\r\n", ind, total_errors);
+            reportHeartbeat(ind, &total_errors, 1);
         }
 
         //reset vars and such
         ind++;
+        iterationDone();
         total_errors += local_errors;
         local_errors = 0;
         in_block = 0;
@@ -222,10 +225,10 @@ void matrix_multiply_test()
 int main(void)
 {
 
-    initMSP430();
+    initPlatform();
 
     printf("\n\r---\n\r");
-    printf("hw: MSP430F2619\r\n");
+    printf("hw: %s\r\n", PLATFORM_HW);
     printf("test: MM_0_flash\r\n");
     printf("mit: none\r\n");
     printf("printing: %i\r\n", robust_printing);
@@ -236,87 +239,3 @@ int main(void)
 
     matrix_multiply_test();
 }
-
-void initMSP430()
-{
-    //MSP430F2619 initialization code
-    WDTCTL = WDTPW + WDTHOLD;
-
-    if (CALBC1_1MHZ == 0xFF)				// If calibration constant erased
-    {
-        while (1)
-            ;                               // do not load, trap CPU!!
-    }
-    DCOCTL = 0;                          // Select lowest DCOx and MODx settings
-    BCSCTL1 = CALBC1_1MHZ;                    // Set DCO
-    DCOCTL = CALDCO_1MHZ;
-
-    initUART();
-}
-
-/**
- * Initializes the UART for 9600 baud with a RX interrupt
- **/
-void initUART(void)
-{
-
-    P3SEL = 0x30;                             // P3.4,5 = USCI_A0 TXD/RXD
-    UCA0CTL1 |= UCSSEL_2;                     // SMCLK
-    UCA0BR0 = 104;                           // 1MHz 9600; (104)decimal = 0x068h
-    UCA0BR1 = 0;                              // 1MHz 9600
-    UCA0MCTL = UCBRS0;                        // Modulation UCBRSx = 1
-    UCA0CTL1 &= ~UCSWRST;                   // **Initialize USCI state machine**
-    //IE2 |= UCA0RXIE; 						  // Enable USCI_A0 RX interrupt
-}
-
-/**
- * puts() is used by printf() to display or send a string.. This function
- * determines where printf prints to. For this case it sends a string
- * out over UART, another option could be to display the string on an
- * LCD display.
- **/
-int puts(const char *_ptr)
-{
-    unsigned int i, len;
-
-    len = strlen(_ptr);
-
-    for (i = 0; i < len; i++)
-    {
-        sendByte(_ptr[i]);
-    }
-
-    return len;
-}
-/**
- * puts() is used by printf() to display or send a character. This function
- * determines where printf prints to. For this case it sends a character
- * out over UART.
- **/
-int putc(int _x, FILE *_fp)
-{
-    sendByte(_x);
-
-    return _x;
-}
-
-/**
- * Sends a single byte out through UART
- **/
-void sendByte(char byte)
-{
-    while (!(IFG2 & UCA0TXIFG))
-        ; // USCI_A0 TX buffer ready?
-    UCA0TXBUF = byte; // TX -> RXed character
-}
-
-//  Echo back RXed character, confirm TX buffer is ready first
-#pragma vector=USCIAB0RX_VECTOR
-__interrupt void USCI0RX_ISR(void)
-{
-
-    while (!(IFG2 & UCA0TXIFG))
-        ;                // USCI_A0 TX buffer ready?
-    UCA0TXBUF = UCA0RXBUF;                    // TX -> RXed character
-}
-
@@ -1,4 +1,4 @@
-const unsigned long golden_matrix[][0] = {
+const unsigned long golden_matrix[][12] = {
 {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, },
 {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, },
 {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, },
@@ -0,0 +1,42 @@
+//*****************************************************************************
+//
+// addr_order.c
+//
+// The names of the address orders and the LFSR feedback masks, see
+// addr_order.h.
+//
+//*****************************************************************************
+
+#include <string.h>
+
+#include "addr_order.h"
+
+const char *const addr_order_names[ADDR_ORDERS] = ADDR_ORDER_NAMES;
+
+// Maximal-length taps, so every width runs through all 2^n - 1 nonzero
+// states before it repeats
+const unsigned long addr_lfsr_taps[ADDR_LFSR_WIDTHS] =
+{
+    0x00000000UL, 0x00000000UL, 0x00000003UL, 0x00000006UL,
+    0x0000000CUL, 0x00000014UL, 0x00000030UL, 0x00000060UL,
+    0x000000B8UL, 0x00000110UL, 0x00000240UL, 0x00000500UL,
+    0x00000829UL, 0x0000100DUL, 0x00002015UL, 0x00006000UL,
+    0x0000B400UL, 0x00012000UL, 0x00020400UL, 0x00072000UL,
+    0x00090000UL, 0x00140000UL, 0x00300000UL, 0x00420000UL,
+    0x00E10000UL, 0x01200000UL, 0x02000023UL, 0x04000013UL,
+    0x09000000UL, 0x14000000UL, 0x20000029UL, 0x48000000UL,
+};
+
+int addr_order_find(const char *name)
+{
+    int order = 0;
+
+    for (order = 0; order < ADDR_ORDERS; order++)
+    {
+        if (strcmp(addr_order_names[order], name) == 0)
+        {
+            return order;
+        }
+    }
+    return -1;
+}
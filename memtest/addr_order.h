@@ -0,0 +1,254 @@
+//*****************************************************************************
+//
+// addr_order.h
+//
+// Address orders for the memory-array tests.  A test that walks its array
+// with ADDR_FOR_EACH() visits every index once in the chosen order, or in
+// the exact reverse of it:
+//
+//   ADDR_LINEAR      0, 1, 2, ...
+//   ADDR_GRAY        the Gray code of 0, 1, 2, ..., so consecutive
+//                    addresses differ in one bit
+//   ADDR_COMPLEMENT  0, n-1, 1, n-2, ..., every address next to its
+//                    complement, so most address bits change every step
+//   ADDR_STRIDE      2^i increment: 0, S, 2S, ..., then 1, 1+S, ..., with
+//                    S = 2^ADDR_STRIDE_LOG2
+//   ADDR_LFSR        the states of a maximal-length LFSR: pseudo-random,
+//                    and every address exactly once
+//
+// The linear order finds cell upsets; the others change the address
+// decoder inputs in the patterns that expose its faults.  Gray and LFSR
+// run over the next power of two and skip the indexes beyond the array.
+//
+// Each order is its own loop with the body inline, so a walk costs what
+// the hand-written loop would.  The order is chosen at run time from
+// all five loops, or with -DADDR_ORDER=ADDR_GRAY (for example) at build
+// time, in which case only that loop is compiled.
+//
+//*****************************************************************************
+
+#ifndef ADDR_ORDER_H
+#define ADDR_ORDER_H
+
+#define     ADDR_LINEAR         0
+#define     ADDR_GRAY           1
+#define     ADDR_COMPLEMENT     2
+#define     ADDR_STRIDE         3
+#define     ADDR_LFSR           4
+#define     ADDR_ORDERS         5
+
+#define     ADDR_ORDER_NAMES    { "linear", "gray", "complement", "stride", "lfsr" }
+
+#ifndef ADDR_STRIDE_LOG2
+#define     ADDR_STRIDE_LOG2    4
+#endif
+
+extern const char *const addr_order_names[ADDR_ORDERS];
+
+// Feedback masks of the right-shifting Galois LFSR of each width, 2 to 31
+// bits, indexed by the width.  A count that fits in an int needs at most
+// 31 bits, 15 on the MSP430, where the state is 16 bits wide.
+#define     ADDR_LFSR_WIDTHS    32
+
+extern const unsigned long addr_lfsr_taps[ADDR_LFSR_WIDTHS];
+
+// The order called name, or -1 if there is none
+int addr_order_find(const char *name);
+
+// The loops.  a is the int variable the body reads the index from, count
+// the number of words and down nonzero for the reverse order.  The loops
+// keep their own state in addr_ variables, which the body must not use.
+#define     ADDR_LINEAR_LOOP(down, a, count, ...)                           \
+    if (down)                                                               \
+    {                                                                       \
+        for (a = (count) - 1; a >= 0; a--)                                  \
+        {                                                                   \
+            __VA_ARGS__;                                                    \
+        }                                                                   \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        for (a = 0; a < (count); a++)                                       \
+        {                                                                   \
+            __VA_ARGS__;                                                    \
+        }                                                                   \
+    }
+
+#define     ADDR_GRAY_LOOP(down, a, count, ...)                             \
+    {                                                                       \
+        unsigned int addr_span = 1;                                         \
+        unsigned int addr_k = 0;                                            \
+                                                                            \
+        while (addr_span < (unsigned int) (count))                          \
+        {                                                                   \
+            addr_span <<= 1;                                                \
+        }                                                                   \
+        if (down)                                                           \
+        {                                                                   \
+            for (addr_k = addr_span; addr_k-- > 0; )                        \
+            {                                                               \
+                a = (int) (addr_k ^ (addr_k >> 1));                         \
+                if (a < (count))                                            \
+                {                                                           \
+                    __VA_ARGS__;                                            \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            for (addr_k = 0; addr_k < addr_span; addr_k++)                  \
+            {                                                               \
+                a = (int) (addr_k ^ (addr_k >> 1));                         \
+                if (a < (count))                                            \
+                {                                                           \
+                    __VA_ARGS__;                                            \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+    }
+
+#define     ADDR_COMPLEMENT_LOOP(down, a, count, ...)                       \
+    {                                                                       \
+        int addr_k = 0;                                                     \
+                                                                            \
+        if (down)                                                           \
+        {                                                                   \
+            for (addr_k = (count) - 1; addr_k >= 0; addr_k--)               \
+            {                                                               \
+                a = (addr_k & 1) ? (count) - 1 - (addr_k >> 1) : addr_k >> 1; \
+                __VA_ARGS__;                                                \
+            }                                                               \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            for (addr_k = 0; addr_k < (count); addr_k++)                    \
+            {                                                               \
+                a = (addr_k & 1) ? (count) - 1 - (addr_k >> 1) : addr_k >> 1; \
+                __VA_ARGS__;                                                \
+            }                                                               \
+        }                                                                   \
+    }
+
+#define     ADDR_STRIDE_LOOP(down, a, count, ...)                           \
+    {                                                                       \
+        int addr_j = 0;                                                     \
+                                                                            \
+        if (down)                                                           \
+        {                                                                   \
+            for (addr_j = (1 << ADDR_STRIDE_LOG2) - 1; addr_j >= 0; addr_j--) \
+            {                                                               \
+                if (addr_j >= (count))                                      \
+                {                                                           \
+                    continue;                                               \
+                }                                                           \
+                for (a = addr_j + ((((count) - 1 - addr_j) >> ADDR_STRIDE_LOG2) \
+                                   << ADDR_STRIDE_LOG2);                    \
+                     a >= 0; a -= 1 << ADDR_STRIDE_LOG2)                    \
+                {                                                           \
+                    __VA_ARGS__;                                            \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            for (addr_j = 0; addr_j < 1 << ADDR_STRIDE_LOG2; addr_j++)      \
+            {                                                               \
+                for (a = addr_j; a < (count); a += 1 << ADDR_STRIDE_LOG2)   \
+                {                                                           \
+                    __VA_ARGS__;                                            \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+    }
+
+// The index is the state - 1.  The up order starts from state 1 and steps
+// forward; the down order starts from 2, the state before 1, and steps
+// back.
+#define     ADDR_LFSR_LOOP(down, a, count, ...)                             \
+    {                                                                       \
+        unsigned int addr_span = 1;                                         \
+        unsigned int addr_bits = 0;                                         \
+        unsigned int addr_taps = 0;                                         \
+        unsigned int addr_state = 1;                                        \
+        unsigned int addr_k = 0;                                            \
+                                                                            \
+        while (addr_span - 1 < (unsigned int) (count) || addr_bits < 2)     \
+        {                                                                   \
+            addr_span <<= 1;                                                \
+            addr_bits++;                                                    \
+        }                                                                   \
+        addr_taps = (unsigned int) addr_lfsr_taps[addr_bits];               \
+        if (down)                                                           \
+        {                                                                   \
+            addr_state = 2;                                                 \
+            for (addr_k = 1; addr_k < addr_span; addr_k++)                  \
+            {                                                               \
+                a = (int) addr_state - 1;                                   \
+                if (a < (count))                                            \
+                {                                                           \
+                    __VA_ARGS__;                                            \
+                }                                                           \
+                addr_state = (addr_state & (addr_span >> 1))                \
+                           ? ((addr_state ^ addr_taps) << 1) | 1            \
+                           : addr_state << 1;                               \
+            }                                                               \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            for (addr_k = 1; addr_k < addr_span; addr_k++)                  \
+            {                                                               \
+                a = (int) addr_state - 1;                                   \
+                if (a < (count))                                            \
+                {                                                           \
+                    __VA_ARGS__;                                            \
+                }                                                           \
+                addr_state = (addr_state >> 1) ^ ((addr_state & 1) ? addr_taps : 0); \
+            }                                                               \
+        }                                                                   \
+    }
+
+// body once for every index a of an array of count words, in order (the
+// reverse if down is nonzero)
+#if defined(ADDR_ORDER) && ADDR_ORDER == ADDR_LINEAR
+#define     ADDR_FOR_EACH(order, down, a, count, ...)                       \
+    do { ADDR_LINEAR_LOOP(down, a, count, __VA_ARGS__) } while (0)
+#elif defined(ADDR_ORDER) && ADDR_ORDER == ADDR_GRAY
+#define     ADDR_FOR_EACH(order, down, a, count, ...)                       \
+    do { ADDR_GRAY_LOOP(down, a, count, __VA_ARGS__) } while (0)
+#elif defined(ADDR_ORDER) && ADDR_ORDER == ADDR_COMPLEMENT
+#define     ADDR_FOR_EACH(order, down, a, count, ...)                       \
+    do { ADDR_COMPLEMENT_LOOP(down, a, count, __VA_ARGS__) } while (0)
+#elif defined(ADDR_ORDER) && ADDR_ORDER == ADDR_STRIDE
+#define     ADDR_FOR_EACH(order, down, a, count, ...)                       \
+    do { ADDR_STRIDE_LOOP(down, a, count, __VA_ARGS__) } while (0)
+#elif defined(ADDR_ORDER) && ADDR_ORDER == ADDR_LFSR
+#define     ADDR_FOR_EACH(order, down, a, count, ...)                       \
+    do { ADDR_LFSR_LOOP(down, a, count, __VA_ARGS__) } while (0)
+#elif defined(ADDR_ORDER)
+#error "ADDR_ORDER must be one of the ADDR_ orders"
+#else
+#define     ADDR_FOR_EACH(order, down, a, count, ...)                       \
+    do                                                                      \
+    {                                                                       \
+        switch (order)                                                      \
+        {                                                                   \
+        case ADDR_GRAY:                                                     \
+            ADDR_GRAY_LOOP(down, a, count, __VA_ARGS__)                     \
+            break;                                                          \
+        case ADDR_COMPLEMENT:                                               \
+            ADDR_COMPLEMENT_LOOP(down, a, count, __VA_ARGS__)               \
+            break;                                                          \
+        case ADDR_STRIDE:                                                   \
+            ADDR_STRIDE_LOOP(down, a, count, __VA_ARGS__)                   \
+            break;                                                          \
+        case ADDR_LFSR:                                                     \
+            ADDR_LFSR_LOOP(down, a, count, __VA_ARGS__)                     \
+            break;                                                          \
+        default:                                                            \
+            ADDR_LINEAR_LOOP(down, a, count, __VA_ARGS__)                   \
+            break;                                                          \
+        }                                                                   \
+    } while (0)
+#endif
+
+#endif
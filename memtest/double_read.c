@@ -0,0 +1,79 @@
+//*****************************************************************************
+//
+// double_read.c
+//
+// The double-read classifier, see double_read.h.  The table is indexed by
+// the DR_ bits, DR_S1_F1 the highest, so it reads as the decision the
+// static cache test used to make with nested ifs:
+//
+//   sarr1 == farr1                      SET, or nothing if sarr2 == farr2
+//   sarr2 == farr1                      DE_SARR1, only the first read was bad
+//   sarr1 == sarr2, farr1 == farr2      SARR_SEU, the word itself is upset
+//   sarr1 == sarr2, sarr1 == farr2      DE_FARR1
+//   sarr1 == sarr2                      DE_FARR1&2
+//   sarr2 == farr2                      DE_FARR1orSARR1
+//   sarr1 == farr2                      DE_SARR1&2
+//   otherwise                           DE_all
+//
+// Some outcomes cannot happen, since equality is transitive; they get the
+// class the decision gives them anyway.
+//
+//*****************************************************************************
+
+#include "double_read.h"
+
+const unsigned char dr_classes[DR_OUTCOMES] =
+{
+    // sarr1 != sarr2
+    DE_ALL, DE_FARR1_OR_SARR1, DE_SARR1_AND_2, DE_FARR1_OR_SARR1,
+    DE_ALL, DE_FARR1_OR_SARR1, DE_SARR1_AND_2, DE_FARR1_OR_SARR1,
+    // sarr1 == sarr2
+    DE_FARR1_AND_2, DE_FARR1_AND_2, DE_FARR1, DE_FARR1,
+    DE_SARR_SEU, DE_SARR_SEU, DE_SARR_SEU, DE_SARR_SEU,
+    // sarr2 == farr1
+    DE_SARR1, DE_SARR1, DE_SARR1, DE_SARR1,
+    DE_SARR1, DE_SARR1, DE_SARR1, DE_SARR1,
+    DE_SARR1, DE_SARR1, DE_SARR1, DE_SARR1,
+    DE_SARR1, DE_SARR1, DE_SARR1, DE_SARR1,
+    // sarr1 == farr1
+    DE_SET, DE_NONE, DE_SET, DE_NONE,
+    DE_SET, DE_NONE, DE_SET, DE_NONE,
+    DE_SET, DE_NONE, DE_SET, DE_NONE,
+    DE_SET, DE_NONE, DE_SET, DE_NONE,
+    DE_SET, DE_NONE, DE_SET, DE_NONE,
+    DE_SET, DE_NONE, DE_SET, DE_NONE,
+    DE_SET, DE_NONE, DE_SET, DE_NONE,
+    DE_SET, DE_NONE, DE_SET, DE_NONE,
+};
+
+int dr_counts[DE_CLASSES];
+
+int dr_classify(int sarr_val1, int farr_val1, int sarr_val2, int farr_val2)
+{
+    int de_class = dr_classes[DR_OUTCOME(sarr_val1, farr_val1, sarr_val2, farr_val2)];
+
+    if (de_class != DE_NONE)
+    {
+        dr_counts[de_class]++;
+    }
+    return de_class;
+}
+
+int dr_classify_sarr(int sarr_val1, int sarr_val2)
+{
+    int de_class = sarr_val1 == sarr_val2 ? DE_SARR_SEU : DE_SET;
+
+    dr_counts[de_class]++;
+    return de_class;
+}
+
+int dr_counters(int *counters)
+{
+    int c = 0;
+
+    for (c = 0; c < DE_CLASSES; c++)
+    {
+        counters[c] = dr_counts[c];
+    }
+    return DE_CLASSES;
+}
@@ -0,0 +1,60 @@
+//*****************************************************************************
+//
+// double_read.h
+//
+// The classifier of the double reads in the cache tests.  A word that did
+// not match is read twice from the array under test (sarr) and its
+// expected value twice from where the pattern is kept (farr).  Which of
+// the four reads agree tells an upset in the array from a transient and
+// from an address decoder error on either side.
+//
+// The outcome is a bit vector with one bit per pair of reads that are
+// equal, which indexes a table of the DE_ classes of telemetry.h; the
+// class is counted as well, for the heartbeat.  The march test has no
+// pattern to read again, so its two sarr reads alone are classified: the
+// same word twice is an upset in the array, two different words a
+// transient.
+//
+//*****************************************************************************
+
+#ifndef DOUBLE_READ_H
+#define DOUBLE_READ_H
+
+#include "telemetry.h"
+
+#define     DR_S2_F2            0x01
+#define     DR_S1_F2            0x02
+#define     DR_F1_F2            0x04
+#define     DR_S1_S2            0x08
+#define     DR_S2_F1            0x10
+#define     DR_S1_F1            0x20
+#define     DR_OUTCOMES         64
+
+// The class of an outcome in which every read was right
+#define     DE_NONE             DE_CLASSES
+
+#define     DR_OUTCOME(sarr_val1, farr_val1, sarr_val2, farr_val2)          \
+    (((sarr_val2) == (farr_val2) ? DR_S2_F2 : 0)                            \
+     | ((sarr_val1) == (farr_val2) ? DR_S1_F2 : 0)                          \
+     | ((farr_val1) == (farr_val2) ? DR_F1_F2 : 0)                          \
+     | ((sarr_val1) == (sarr_val2) ? DR_S1_S2 : 0)                          \
+     | ((sarr_val2) == (farr_val1) ? DR_S2_F1 : 0)                          \
+     | ((sarr_val1) == (farr_val1) ? DR_S1_F1 : 0))
+
+extern const unsigned char dr_classes[DR_OUTCOMES];
+
+// The words found in each class so far
+extern int dr_counts[DE_CLASSES];
+
+// The class of the four reads, DE_NONE if they are all right; counts it
+int dr_classify(int sarr_val1, int farr_val1, int sarr_val2, int farr_val2);
+
+// The class of two reads of a word whose expected value is known, SARR_SEU
+// if they are equal and SET if not; counts it
+int dr_classify_sarr(int sarr_val1, int sarr_val2);
+
+// Copies the class counts to counters, for the heartbeat, and returns how
+// many there are
+int dr_counters(int *counters);
+
+#endif
@@ -0,0 +1,106 @@
+//*****************************************************************************
+//
+// flip.c
+//
+// The bit-flip analysis, see flip.h.  The words of a pass are kept sorted
+// by index as they come, with an insertion into the small table, so the
+// report only has to walk it once for the words and once for the runs.
+//
+//*****************************************************************************
+
+#include "telemetry.h"
+#include "flip.h"
+
+static flip flips[FLIP_WORDS];
+static int flip_count = 0;
+
+int flip_bits(unsigned int bits)
+{
+    int count = 0;
+
+    for (bits &= 0xFFFF; bits != 0; bits &= bits - 1)
+    {
+        count++;
+    }
+    return count;
+}
+
+void flip_begin(void)
+{
+    flip_count = 0;
+}
+
+void flip_word(int index, unsigned int expected, unsigned int observed)
+{
+    unsigned int mask = (expected ^ observed) & 0xFFFF;
+    int w = flip_count;
+    int i = 0;
+
+    while (w > 0 && flips[w - 1].index > index)
+    {
+        w--;
+    }
+    if (w > 0 && flips[w - 1].index == index)
+    {
+        flips[w - 1].up |= mask & observed;
+        flips[w - 1].down |= mask & expected;
+        return;
+    }
+    if (flip_count == FLIP_WORDS)
+    {
+        return;
+    }
+
+    for (i = flip_count; i > w; i--)
+    {
+        flips[i] = flips[i - 1];
+    }
+    flip_count++;
+    flips[w].index = index;
+    flips[w].up = mask & observed;
+    flips[w].down = mask & expected;
+}
+
+void flip_report(unsigned long ind, int opened)
+{
+    int first = 1;
+    int bits = 0;
+    int run = 0;
+    int w = 0;
+
+    if (flip_count == 0)
+    {
+        return;
+    }
+
+    if (!opened)
+    {
+        reportIteration(ind);
+    }
+    for (w = 0; w < flip_count; w++)
+    {
+        reportElementFlip('F', w == 0, flips[w].index, flips[w].up | flips[w].down,
+                          flip_bits(flips[w].up), flip_bits(flips[w].down));
+    }
+    reportElementsEnd();
+
+    // multi-cell upsets: runs of words at adjacent indexes
+    for (w = 0; w < flip_count; w = run)
+    {
+        bits = flip_bits(flips[w].up | flips[w].down);
+        for (run = w + 1; run < flip_count && flips[run].index == flips[run - 1].index + 1;
+             run++)
+        {
+            bits += flip_bits(flips[run].up | flips[run].down);
+        }
+        if (run - w > 1)
+        {
+            reportElementCluster('M', first, flips[w].index, run - w, bits);
+            first = 0;
+        }
+    }
+    if (!first)
+    {
+        reportElementsEnd();
+    }
+}
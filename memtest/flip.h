@@ -0,0 +1,57 @@
+//*****************************************************************************
+//
+// flip.h
+//
+// Bit-flip analysis of the mismatched words of a memory-array test.  Each
+// mismatch is kept as the bits that flipped, split by direction, and at
+// the end of a pass the words are reported in index order as an "F" block
+// of telemetry flip elements: the XOR mask, its popcount and the flips
+// 0 to 1 (up) and 1 to 0 (down).  Runs of two or more mismatched words at
+// adjacent addresses follow as an "M" block of multi-cell upsets:
+//
+//    - i: 1200
+//      F: {500: [0104, 2, 1, 1],501: [0001, 1, 0, 1],}
+//      M: {500: [2, 3],}
+//
+// or the same blocks after the other blocks of the " - i:" item, if the
+// test has already opened one for the pass.
+// The bit positions are the set bits of the mask.  A pass keeps at most
+// FLIP_WORDS words, the first to be found; the raw records or counts of a
+// pass with more still cover all of them.  A word that fails more than
+// once in a pass (in different March elements) is kept once, with every
+// bit that flipped; a bit that flipped up in one element and down in
+// another counts as an up flip and a down flip.  tools/flip_analysis.hpp computes the same blocks from
+// the logs of the static and original cache tests, old ones included.
+//
+//*****************************************************************************
+
+#ifndef FLIP_H
+#define FLIP_H
+
+#ifndef FLIP_WORDS
+#define     FLIP_WORDS          16
+#endif
+
+typedef struct
+{
+    int index;
+    unsigned int up;                // bits that went from 0 to 1
+    unsigned int down;              // and from 1 to 0
+} flip;
+
+// The number of bits set in the low 16 bits of a word
+int flip_bits(unsigned int bits);
+
+// Starts a pass with no mismatched words
+void flip_begin(void);
+
+// Adds the word at index, read as observed where expected was written
+void flip_word(int index, unsigned int expected, unsigned int observed);
+
+// Reports the words of the pass and the multi-cell upsets among them;
+// nothing if there were none.  opened is nonzero when the test has printed
+// the " - i: ind" item of the pass and the blocks go under it (its
+// in_block), and zero when they need an item of their own.
+void flip_report(unsigned long ind, int opened);
+
+#endif
@@ -0,0 +1,168 @@
+//*****************************************************************************
+//
+// march.c
+//
+// The March test engine, see march.h.  Each element runs as one loop over
+// the addresses, ADDR_FOR_EACH() of addr_order.h, which has an upward and
+// a downward copy of the loop of every address order.  The read check is
+// a macro so that the loops of the common element shapes stay flat: two
+// reads, one compare, and a call only on a mismatch.
+//
+//*****************************************************************************
+
+#include <string.h>
+
+#include "march.h"
+
+#define     D0          MARCH_R(0)
+#define     D1          MARCH_R(1)
+#define     DA          MARCH_R(2)
+#define     D5          MARCH_R(3)
+#define     W0          MARCH_W(0)
+#define     W1          MARCH_W(1)
+#define     WA          MARCH_W(2)
+#define     W5          MARCH_W(3)
+
+const unsigned int march_data[4] = { 0x0000, 0xFFFF, 0xAAAA, 0x5555 };
+
+static const march_element lanl[] =
+{
+    { MARCH_UP,   2, { D0, W1 } },
+    { MARCH_DOWN, 2, { D1, WA } },
+    { MARCH_UP,   2, { DA, W5 } },
+    { MARCH_DOWN, 2, { D5, W0 } },
+};
+
+static const march_element march_c_minus[] =
+{
+    { MARCH_ANY,  1, { W0 } },
+    { MARCH_UP,   2, { D0, W1 } },
+    { MARCH_UP,   2, { D1, W0 } },
+    { MARCH_DOWN, 2, { D0, W1 } },
+    { MARCH_DOWN, 2, { D1, W0 } },
+    { MARCH_ANY,  1, { D0 } },
+};
+
+static const march_element march_x[] =
+{
+    { MARCH_ANY,  1, { W0 } },
+    { MARCH_UP,   2, { D0, W1 } },
+    { MARCH_DOWN, 2, { D1, W0 } },
+    { MARCH_ANY,  1, { D0 } },
+};
+
+static const march_element march_y[] =
+{
+    { MARCH_ANY,  1, { W0 } },
+    { MARCH_UP,   3, { D0, W1, D1 } },
+    { MARCH_DOWN, 3, { D1, W0, D0 } },
+    { MARCH_ANY,  1, { D0 } },
+};
+
+static const march_element mats_plus[] =
+{
+    { MARCH_ANY,  1, { W0 } },
+    { MARCH_UP,   2, { D0, W1 } },
+    { MARCH_DOWN, 2, { D1, W0 } },
+};
+
+static const march_element march_ss[] =
+{
+    { MARCH_ANY,  1, { W0 } },
+    { MARCH_UP,   5, { D0, D0, W0, D0, W1 } },
+    { MARCH_UP,   5, { D1, D1, W1, D1, W0 } },
+    { MARCH_DOWN, 5, { D0, D0, W0, D0, W1 } },
+    { MARCH_DOWN, 5, { D1, D1, W1, D1, W0 } },
+    { MARCH_ANY,  1, { D0 } },
+};
+
+#define     ELEMENTS(e)         (sizeof(e) / sizeof(e[0]))
+
+const march_test marches[MARCHES] =
+{
+    { "lanl",     ELEMENTS(lanl),          lanl },
+    { "march_c-", ELEMENTS(march_c_minus), march_c_minus },
+    { "march_x",  ELEMENTS(march_x),       march_x },
+    { "march_y",  ELEMENTS(march_y),       march_y },
+    { "mats+",    ELEMENTS(mats_plus),     mats_plus },
+    { "march_ss", ELEMENTS(march_ss),      march_ss },
+};
+
+const march_test *march_find(const char *name)
+{
+    int m = 0;
+
+    for (m = 0; m < MARCHES; m++)
+    {
+        if (strcmp(marches[m].name, name) == 0)
+        {
+            return &marches[m];
+        }
+    }
+    return 0;
+}
+
+#define     CHECK(expected)                                                 \
+    do                                                                      \
+    {                                                                       \
+        unsigned int read1 = (unsigned int) array[a];                       \
+        unsigned int read2 = (unsigned int) array[a];                       \
+        if (read1 != (expected) || read2 != (expected))                     \
+        {                                                                   \
+            errors++;                                                       \
+            report(a, expected, read1, read2);                              \
+        }                                                                   \
+    } while (0)
+
+// body once for every index of the element, in its order
+#define     FOR_EACH_WORD(element, ...)                                     \
+    ADDR_FOR_EACH(order, (element)->order == MARCH_DOWN, a, count, __VA_ARGS__)
+
+int march_run(const march_test *march, int order, int *array, int count,
+              march_report report)
+{
+    const march_element *element;
+    unsigned int read = 0;
+    unsigned int write = 0;
+    int errors = 0;
+    int a = 0;
+    int e = 0;
+    int n = 0;
+
+    for (e = 0; e < march->count; e++)
+    {
+        element = &march->elements[e];
+        read = march_data[MARCH_DATA(element->ops[0])];
+        write = march_data[MARCH_DATA(element->ops[element->count - 1])];
+
+        if (element->count == 1 && MARCH_IS_WRITE(element->ops[0]))
+        {
+            FOR_EACH_WORD(element, array[a] = (int) write);
+        }
+        else if (element->count == 1)
+        {
+            FOR_EACH_WORD(element, CHECK(read));
+        }
+        else if (element->count == 2 && !MARCH_IS_WRITE(element->ops[0])
+                 && MARCH_IS_WRITE(element->ops[1]))
+        {
+            FOR_EACH_WORD(element, CHECK(read); array[a] = (int) write);
+        }
+        else
+        {
+            FOR_EACH_WORD(element,
+                for (n = 0; n < element->count; n++)
+                {
+                    if (MARCH_IS_WRITE(element->ops[n]))
+                    {
+                        array[a] = (int) march_data[MARCH_DATA(element->ops[n])];
+                    }
+                    else
+                    {
+                        CHECK(march_data[MARCH_DATA(element->ops[n])]);
+                    }
+                });
+        }
+    }
+    return errors;
+}
@@ -0,0 +1,95 @@
+//*****************************************************************************
+//
+// march.h
+//
+// A March test engine for the memory-array tests.  A march is a table of
+// elements; an element visits every word of the array in one address
+// order and applies its operations, in turn, to each word before moving
+// on.  MATS+ is {any(w0); up(r0,w1); down(r1,w0)}: write 0 in any order,
+// then upward read 0 and write 1, then downward read 1 and write 0.
+// Each read is done twice, like the double reads of the other cache
+// tests, and a mismatch is handed to the caller with both values.
+//
+// The data of an operation is one of four words: 0 and 1 are the all-0
+// and all-1 backgrounds of the textbook marches, 2 and 3 the checkerboards
+// 0xAAAA and 0x5555.  The marches below are selected by index, at build
+// time with -DMARCH=MARCH_C_MINUS, or by name with march_find().
+//
+// "Up" and "down" are an address order of addr_order.h and its reverse,
+// so the same march runs in linear, Gray code, address-complement, 2^i
+// stride or pseudo-random order.
+//
+// The elements that are one read, one write, or a read then a write (all
+// of MATS+, March C- and March X) run in a loop of their own that is the
+// same as a hand-written one; only the longer elements of March Y and
+// March SS go through the operation loop.
+//
+//*****************************************************************************
+
+#ifndef MARCH_H
+#define MARCH_H
+
+#include "addr_order.h"
+
+// Directions
+#define     MARCH_UP            0
+#define     MARCH_DOWN          1
+#define     MARCH_ANY           2            // runs upward
+
+// Operations: bit 2 is set for a write, bits 0 and 1 select the data
+#define     MARCH_R(d)          (d)
+#define     MARCH_W(d)          (4 | (d))
+#define     MARCH_IS_WRITE(op)  (((op) & 4) != 0)
+#define     MARCH_DATA(op)      ((op) & 3)
+
+#define     MARCH_MAX_OPS       5
+
+typedef struct
+{
+    unsigned char order;
+    unsigned char count;
+    unsigned char ops[MARCH_MAX_OPS];
+} march_element;
+
+typedef struct
+{
+    const char *name;
+    unsigned char count;
+    const march_element *elements;
+} march_test;
+
+// The marches, indexes into marches[].  MARCH_LANL is the original test
+// of cache_march_test, {up(r0,w1); down(r1,wA); up(rA,w5); down(r5,w0)}.
+// It has no initializing element, so the array has to be zeroed once
+// before the first run, and each run leaves it zeroed for the next.
+#define     MARCH_LANL          0
+#define     MARCH_C_MINUS       1
+#define     MARCH_X             2
+#define     MARCH_Y             3
+#define     MARCH_MATS_PLUS     4
+#define     MARCH_SS            5
+#define     MARCHES             6
+
+#ifndef MARCH
+#define     MARCH               MARCH_LANL
+#endif
+
+extern const march_test marches[MARCHES];
+extern const unsigned int march_data[4];
+
+// The march called name ("lanl", "march_c-", "march_x", "march_y",
+// "mats+" or "march_ss"), or 0 if there is none
+const march_test *march_find(const char *name);
+
+// Called for every read that does not return the expected word, with the
+// index of the word and the two reads
+typedef void (*march_report)(int index, unsigned int expected,
+                             unsigned int read1, unsigned int read2);
+
+// Runs every element of march over the count words of array, in the
+// address order order (ADDR_LINEAR, ...), and returns the number of
+// mismatched reads
+int march_run(const march_test *march, int order, int *array, int count,
+              march_report report);
+
+#endif
@@ -0,0 +1,73 @@
+//*****************************************************************************
+//
+// pattern_rule.h
+//
+// The address-encoded pattern of the static cache test and quicksort.  The
+// array is split into one block per background word (mostly 0s, mostly 1s,
+// mostly As and mostly 5s by default), and every word of a block is its
+// background with the word's index encoded in the low bits, so a read from
+// the wrong address returns a value that names the address it came from.
+//
+//   PATTERN_LEGACY  the hand-made table of version 1.0 (the default)
+//   PATTERN_OR      the low bits are replaced by the index
+//   PATTERN_XOR     the index is XORed into the background
+//
+// The table of version 1.0 is the one the benchmark results were taken
+// with, 848 words in blocks of 212.  Its 0s and 5s blocks follow the OR
+// rule, but its 1s block has the high bytes 3F and 7F (0x3fd4 at 212)
+// and its As block 55 and AA (0x55a8 at 424), split at 256 and 512, with
+// the index in the low byte.  It is defined for those 848 words only;
+// quicksort sorts its first 180.  The OR and XOR rules are defined for
+// any size and any backgrounds.
+//
+// The OR encoding takes as many bits as the largest index needs: 10 for
+// 848 words.  tools/pattern_gen.cpp turns a rule into the const tables in
+// flash; the values are 16 bit words, stored as the int the MSP430 reads
+// them as, so they sort the same on every host.
+// cache_static_test built with -DPATTERN_ARITHMETIC computes the XOR
+// pattern from the index instead of reading a table.
+//
+//*****************************************************************************
+
+#ifndef PATTERN_RULE_H
+#define PATTERN_RULE_H
+
+#define     PATTERN_OR              0
+#define     PATTERN_XOR             1
+#define     PATTERN_LEGACY          2
+
+// The words of the table of version 1.0
+#define     PATTERN_LEGACY_WORDS    848
+
+#define     PATTERN_BACKGROUNDS     { 0x0000, 0xFFFF, 0xAAAA, 0x5555 }
+
+// The words in each block of an array of count words, with n backgrounds
+#define     PATTERN_BLOCK(count, n)     (((count) + (n) - 1) / (n))
+
+// The word at index of the table of version 1.0
+#define     PATTERN_LEGACY_WORD(index)                                      \
+    ((unsigned int) (index) < 212U ? (unsigned int) (index)                 \
+     : (unsigned int) (index) < 424U                                        \
+       ? ((unsigned int) (index) < 256U ? 0x3F00U : 0x7F00U)                \
+         | ((unsigned int) (index) & 0xFFU)                                 \
+     : (unsigned int) (index) < 636U                                        \
+       ? ((unsigned int) (index) < 512U ? 0x5500U : 0xAA00U)                \
+         | ((unsigned int) (index) & 0xFFU)                                 \
+     : 0x5400U | (unsigned int) (index))
+
+// The 16 bit word at index, with mask the low bits the index is encoded in;
+// the table of version 1.0 ignores background and mask
+#define     PATTERN_WORD(rule, background, index, mask)                     \
+    ((rule) == PATTERN_LEGACY ? PATTERN_LEGACY_WORD(index)                  \
+     : (rule) == PATTERN_XOR                                                \
+     ? ((unsigned int) (background) ^ (unsigned int) (index)) & 0xFFFFU     \
+     : (((unsigned int) (background) & ~(unsigned int) (mask))              \
+        | (unsigned int) (index)) & 0xFFFFU)
+
+// A 16 bit word as a 16 bit int, sign and all, whatever the size of int.
+// Bits below the sign pass through, so for an index under 0x8000,
+// PATTERN_INT(background ^ index) is PATTERN_INT(background) ^ index.
+#define     PATTERN_INT(word)                                               \
+    (((word) & 0x8000U) ? -(int) (0xFFFFU - (word)) - 1 : (int) (word))
+
+#endif
@@ -0,0 +1,80 @@
+//*****************************************************************************
+//
+// scrub.c
+//
+// The slice scheduler of the incremental scrub, see scrub.h.  slice_clock
+// counts slice ticks from scrub_start().  Slice s of a pass ran at a
+// slice_clock of at least that of the pass's first slice plus s, so a word
+// checked now was last checked no earlier than that many ticks into the
+// pass before; the first pass counts from scrub_start(), when the array
+// was written.
+//
+//*****************************************************************************
+
+#include "platform.h"
+#include "scrub.h"
+
+static int scrub_count = 0;
+static int scrub_words = 0;
+static int slices = 0;
+static int slice = 0;                   // in the pass
+static unsigned long period_us = 0;
+static unsigned long slice_clock = 0;   // slice ticks
+static unsigned long pass_start = 0;    // clock of slice 0 of this pass
+static unsigned long last_start = 0;    // and of the pass before
+static unsigned long passes = 0;        // started
+static unsigned long overruns = 0;
+
+void scrub_start(int count, int words, unsigned long period)
+{
+    unsigned long ticks = 0;
+
+    scrub_count = count;
+    scrub_words = words < 1 ? 1 : words > count ? count : words;
+    slices = (count + scrub_words - 1) / scrub_words;
+    slice = slices - 1;
+    period_us = period;
+    slice_clock = 0;
+    pass_start = 0;
+    last_start = 0;
+    passes = 0;
+    overruns = 0;
+
+    // the tick is a whole number of microseconds on both platforms
+    ticks = period / (1000000UL / PLATFORM_TICKS_PER_SECOND);
+    startSlices(ticks > 0 ? ticks : 1);
+}
+
+int scrub_next(int *first, int *last)
+{
+    unsigned int ticks = waitSlice();
+
+    slice_clock += ticks;
+    if (ticks > 1)
+    {
+        overruns += ticks - 1;
+    }
+    if (++slice >= slices)
+    {
+        slice = 0;
+        last_start = pass_start;
+        pass_start = slice_clock;
+        passes++;
+    }
+
+    *first = slice * scrub_words;
+    *last = *first + scrub_words < scrub_count ? *first + scrub_words : scrub_count;
+    return *last == scrub_count;
+}
+
+unsigned long scrub_latency(void)
+{
+    unsigned long checked = passes > 1 ? last_start + slice : 0;
+
+    return (slice_clock + 1 - checked) * period_us;
+}
+
+unsigned long scrub_overruns(void)
+{
+    return overruns;
+}
@@ -0,0 +1,44 @@
+//*****************************************************************************
+//
+// scrub.h
+//
+// Incremental scrubbing for the memory-array tests.  Instead of checking
+// the whole array back to back, a scrubbing test checks a slice of
+// SCRUB_WORDS words every SCRUB_PERIOD_US microseconds, from the slice
+// timer of the platform layer, and sleeps in between.  A pass over the
+// array then takes a known time, so every error found comes with a bound
+// on how long it can have been there: since the check of its slice in the
+// pass before.
+//
+// The bound is counted in slices, from the ticks waitSlice() returns, so
+// a slice that overran its period makes the bounds after it longer rather
+// than wrong.  Overruns are counted for the heartbeat.
+//
+//*****************************************************************************
+
+#ifndef SCRUB_H
+#define SCRUB_H
+
+#ifndef SCRUB_WORDS
+#define     SCRUB_WORDS         16
+#endif
+#ifndef SCRUB_PERIOD_US
+#define     SCRUB_PERIOD_US     10000UL
+#endif
+
+// Starts the slice timer for an array of count words, checked words at a
+// time every period microseconds.  The array has to hold the pattern.
+void scrub_start(int count, int words, unsigned long period);
+
+// Sleeps until the next slice and sets the words it checks, first to
+// last - 1.  Returns nonzero when the slice ends a pass over the array.
+int scrub_next(int *first, int *last);
+
+// The longest time, in microseconds, that an error found in the current
+// slice can have gone undetected
+unsigned long scrub_latency(void);
+
+// Slices that started late because the one before overran its period
+unsigned long scrub_overruns(void);
+
+#endif
@@ -0,0 +1,104 @@
+//*****************************************************************************
+//
+// signature.c
+//
+// The running signatures of the memory-array tests, see signature.h.
+//
+//*****************************************************************************
+
+#include "signature.h"
+
+#define     SIGNATURE_MODULUS   65535UL
+
+void signature_init(signature *sig)
+{
+    int k = 0;
+
+    for (k = 0; k < SIGNATURE_LANES; k++)
+    {
+        sig->sum1[k] = 0;
+        sig->sum2[k] = 0;
+    }
+}
+
+void signature_fold(signature *sig, const int *words, int count)
+{
+    signature_sum sum1[SIGNATURE_LANES];
+    signature_sum sum2[SIGNATURE_LANES];
+    int block = 0;
+    int i = 0;
+    int k = 0;
+
+    // the sums stay in registers for the loop
+    for (k = 0; k < SIGNATURE_LANES; k++)
+    {
+        sum1[k] = sig->sum1[k];
+        sum2[k] = sig->sum2[k];
+    }
+    while (i + SIGNATURE_LANES <= count)
+    {
+        // whole rows of lanes, SIGNATURE_BLOCK at most, then the reduction
+        block = (count - i) / SIGNATURE_LANES;
+        if (block > SIGNATURE_BLOCK)
+        {
+            block = SIGNATURE_BLOCK;
+        }
+        for (; block > 0; block--, i += SIGNATURE_LANES)
+        {
+            for (k = 0; k < SIGNATURE_LANES; k++)
+            {
+                sum1[k] += (unsigned int) words[i + k] & 0xFFFFU;
+                sum2[k] += sum1[k];
+            }
+        }
+        for (k = 0; k < SIGNATURE_LANES; k++)
+        {
+            sum1[k] %= SIGNATURE_MODULUS;
+            sum2[k] %= SIGNATURE_MODULUS;
+        }
+    }
+    for (k = 0; i < count; i++, k++)
+    {
+        sum1[k] = (sum1[k] + ((unsigned int) words[i] & 0xFFFFU)) % SIGNATURE_MODULUS;
+        sum2[k] = (sum2[k] + sum1[k]) % SIGNATURE_MODULUS;
+    }
+    for (k = 0; k < SIGNATURE_LANES; k++)
+    {
+        sig->sum1[k] = sum1[k];
+        sig->sum2[k] = sum2[k];
+    }
+}
+
+void signature_word(signature *sig, int index, int word)
+{
+    int k = index % SIGNATURE_LANES;
+
+    sig->sum1[k] = (sig->sum1[k] + ((unsigned int) word & 0xFFFFU)) % SIGNATURE_MODULUS;
+    sig->sum2[k] = (sig->sum2[k] + sig->sum1[k]) % SIGNATURE_MODULUS;
+}
+
+int signature_equal(const signature *a, const signature *b)
+{
+    signature_sum diff = 0;
+    int k = 0;
+
+    for (k = 0; k < SIGNATURE_LANES; k++)
+    {
+        diff |= (a->sum1[k] ^ b->sum1[k]) | (a->sum2[k] ^ b->sum2[k]);
+    }
+    return diff == 0;
+}
+
+unsigned int signature_value(const signature *sig)
+{
+    unsigned int value = 0;
+    unsigned int sum2 = 0;
+    int k = 0;
+
+    for (k = 0; k < SIGNATURE_LANES; k++)
+    {
+        sum2 = (unsigned int) sig->sum2[k];
+        value += (unsigned int) sig->sum1[k] ^ ((sum2 << 8 | sum2 >> 8) & 0xFFFFU);
+    }
+    return value & 0xFFFF;
+}
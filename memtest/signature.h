@@ -0,0 +1,69 @@
+//*****************************************************************************
+//
+// signature.h
+//
+// Running signatures for the memory-array tests.  Instead of comparing
+// every word with the pattern, a check can fold the whole array into a
+// signature and compare that with the signature of the pattern, computed
+// once; only a mismatch needs the word-by-word pass that finds the word.
+//
+// The signature is Fletcher-32 over the 16 bit words: sum1 adds the words
+// and sum2 adds the running sum1, both modulo 65535, in 32 bit
+// accumulators that are reduced every SIGNATURE_BLOCK words.  A changed
+// word changes sum1, and two changed words that leave sum1 alone, such as
+// bit 15 flipped up in one and down in the other, change sum2 by their
+// difference times their distance, which 65535 does not divide for any
+// array that fits.  Words that trade places are caught the same way,
+// unless they differ by a multiple of 65535: 0x0000 and 0xFFFF are the
+// same word to the sums, so a word that flips all 16 bits between them is
+// missed.  The array is split into SIGNATURE_LANES interleaved lanes with
+// sums of their own, so on a wide host the fold is a vector loop without
+// branches; the MSP430 keeps one.
+//
+//*****************************************************************************
+
+#ifndef SIGNATURE_H
+#define SIGNATURE_H
+
+#include <limits.h>
+
+#ifndef SIGNATURE_LANES
+#ifdef PLATFORM_POSIX
+#define     SIGNATURE_LANES     8
+#else
+#define     SIGNATURE_LANES     1
+#endif
+#endif
+
+// The words a lane adds before its sums are reduced, few enough that sum2
+// cannot overflow 32 bits
+#define     SIGNATURE_BLOCK     359
+
+#if UINT_MAX >= 0xFFFFFFFFUL
+typedef unsigned int signature_sum;
+#else
+typedef unsigned long signature_sum;
+#endif
+
+typedef struct
+{
+    signature_sum sum1[SIGNATURE_LANES];
+    signature_sum sum2[SIGNATURE_LANES];
+} signature;
+
+void signature_init(signature *sig);
+
+// Folds count words into sig.  The whole array goes in one call, since the
+// lane of a word is its index.
+void signature_fold(signature *sig, const int *words, int count);
+
+// Folds one word, the word at index; the words have to come in index
+// order.  For computing the signature of a pattern that is not in memory.
+void signature_word(signature *sig, int index, int word);
+
+int signature_equal(const signature *a, const signature *b);
+
+// The signature in one word, for the error record
+unsigned int signature_value(const signature *sig);
+
+#endif
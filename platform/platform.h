@@ -0,0 +1,110 @@
+//*****************************************************************************
+//
+// platform.h
+//
+// The platform layer holds the part-specific code that every benchmark
+// needs: clock and watchdog setup, the UART and the byte output used by
+// printf.  There are two backends and exactly one is compiled with each
+// benchmark, together with tiny_printf.c:
+//
+//   platform_msp430.c  MSP430F2619 at 1 MHz, UART at 9,600 baud
+//   platform_posix.c   Linux executable writing to stdout, a file or a
+//                      pseudo-terminal (compile with -DPLATFORM_POSIX)
+//
+// The POSIX backend exists so that every kernel can be run on a
+// workstation to measure its raw throughput before it goes in the beam.
+// The output target and the length of the run are selected with
+// environment variables, see platform_posix.c.
+//
+//*****************************************************************************
+
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#ifdef PLATFORM_POSIX
+#define     PLATFORM_HW                 "linux"
+#define     PLATFORM_TICKS_PER_SECOND   1000000UL
+#else
+#define     PLATFORM_HW                 "MSP430F2619"
+#define     PLATFORM_TICKS_PER_SECOND   125000UL     // SMCLK / 8
+#endif
+
+// Transmit path.  sendByte() puts the byte in a ring buffer of
+// TX_BUFFER_SIZE bytes (a power of two) that the UART drains in the
+// background, so the kernel keeps running while a record goes out.
+// TX_POLICY selects what happens when the buffer is full:
+//
+//   TX_BLOCK        wait until the UART makes room, nothing is lost
+//   TX_DROP_NEWEST  discard the new byte
+//   TX_DROP_COUNT   discard the new byte and count it in droppedBytes()
+//
+// sendBytes() queues a whole record at the cost of one call.  The
+// benchmarks print droppedBytes() as the last field of the "#" line.
+#define     TX_BLOCK            0
+#define     TX_DROP_NEWEST      1
+#define     TX_DROP_COUNT       2
+
+#ifndef TX_POLICY
+#define     TX_POLICY           TX_BLOCK
+#endif
+
+#ifndef TX_BUFFER_SIZE
+#define     TX_BUFFER_SIZE      256
+#endif
+
+void initPlatform(void);
+void initUART(void);
+void sendByte(char byte);
+void sendBytes(const char *bytes, unsigned int count);
+unsigned long droppedBytes(void);
+
+// Bytes accepted for the link so far (dropped bytes are not counted) and
+// the rate the link carries them at, 0 when it is not rate limited.
+unsigned long outputBytes(void);
+unsigned int linkBytesPerSecond(void);
+
+// Free-running time base, PLATFORM_TICKS_PER_SECOND ticks per second.
+// It wraps, so only differences between two readings are meaningful.
+unsigned long platformTicks(void);
+
+// Slice timer, for tests that spread their work over fixed time slices.
+// startSlices() starts a tick every period ticks of platformTicks();
+// waitSlice() sleeps until the next tick and returns the number of ticks
+// since the previous call, more than 1 when the work between the calls
+// overran the period.  Timer_A capture/compare 1 on the MSP430, a timer
+// thread on Linux.
+void startSlices(unsigned long period);
+unsigned int waitSlice(void);
+
+// All of the benchmarks print with the tiny printf format subset:
+// %c, %s, %i and %u (16 bit), %l and %n (32 bit) and %x (16 bit hex).
+// The macro keeps a hosted build from ever reaching the C library printf,
+// where %n means something else entirely.
+void tinyPrintf(char *format, ...);
+#define printf tinyPrintf
+
+// The printf conversions on their own, for output written once per
+// mismatched element.  Each writes its field at `at' without a terminator
+// and returns the end of it; a field is at most FORMAT_FIELD_SIZE bytes.
+// The caller sends the finished record with sendBytes().
+#define     FORMAT_FIELD_SIZE   11
+
+char *formatString(char *at, const char *s);
+char *formatSigned(char *at, int value);                 // %i
+char *formatUnsigned16(char *at, unsigned int value);    // %u
+char *formatUnsigned(char *at, unsigned long value);     // %n
+char *formatHex16(char *at, unsigned int value);         // %x
+char *formatHex32(char *at, unsigned long value);        // eight hex digits
+
+// Called once per kernel iteration, after ind is incremented.  The POSIX
+// backend counts iterations and reports iterations per second when the
+// run ends; on the MSP430 it costs nothing.  endRun() ends a POSIX run the
+// same way, for a kernel that stops on its own.
+#ifdef PLATFORM_POSIX
+void iterationDone(void);
+void endRun(void);
+#else
+#define iterationDone()
+#endif
+
+#endif
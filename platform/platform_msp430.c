@@ -0,0 +1,246 @@
+//*****************************************************************************
+//
+// platform_msp430.c
+//
+// MSP430F2619 backend for the platform layer.  The DCO runs from the 1 MHz
+// calibration constants and USCI_A0 drives the UART at 9,600 baud on
+// P3.4/P3.5.  Output is queued in a ring buffer and sent by the USCI TX
+// interrupt, so the kernel only pays for copying a byte into RAM.
+// Timer_A runs continuously from SMCLK / 8 as the platform time base; its
+// overflow interrupt extends TAR to 32 bits, and capture/compare 1 times
+// the slices of startSlices(), in steps of at most half the timer range.
+//
+//*****************************************************************************
+
+#include <msp430.h>
+
+#include "platform.h"
+
+#define     tx_mask                 (TX_BUFFER_SIZE - 1)
+
+static char tx_buffer[TX_BUFFER_SIZE];
+static volatile unsigned int tx_head = 0;    // written by sendByte()
+static volatile unsigned int tx_tail = 0;    // written by the TX interrupt
+static unsigned long dropped_bytes = 0;
+static unsigned long output_bytes = 0;
+static volatile unsigned int ticks_high = 0;
+static unsigned long slice_period = 0;
+static unsigned long slice_left = 0;           // of the slice, after this step
+static volatile unsigned int slice_ticks = 0;  // written by the timer interrupt
+static unsigned int slices_seen = 0;
+
+void initPlatform(void)
+{
+    //MSP430F2619 initialization code
+    WDTCTL = WDTPW + WDTHOLD;                 // Stop WDT
+
+    if (CALBC1_1MHZ == 0xFF)                  // If calibration constant erased
+    {
+        while (1)
+            ;                                 // do not load, trap CPU!!
+    }
+    DCOCTL = 0;                               // Select lowest DCOx and MODx settings
+    BCSCTL1 = CALBC1_1MHZ;                    // Set DCO
+    DCOCTL = CALDCO_1MHZ;
+
+    TACTL = TASSEL_2 + ID_3 + MC_2 + TACLR + TAIE;   // SMCLK/8, continuous
+
+    initUART();
+    __enable_interrupt();
+}
+
+/**
+ * Initializes the UART for 9600 baud.  The benchmarks call this again at
+ * every heartbeat so that a UART upset does not silence the rest of the run.
+ **/
+void initUART(void)
+{
+    P3SEL = 0x30;                             // P3.4,5 = USCI_A0 TXD/RXD
+    UCA0CTL1 |= UCSSEL_2;                     // SMCLK
+    UCA0BR0 = 104;                            // 1MHz 9600; (104)decimal = 0x068h
+    UCA0BR1 = 0;                              // 1MHz 9600
+    UCA0MCTL = UCBRS0;                        // Modulation UCBRSx = 1
+    UCA0CTL1 &= ~UCSWRST;                     // **Initialize USCI state machine**
+    //IE2 |= UCA0RXIE;                        // Enable USCI_A0 RX interrupt
+
+    if (tx_head != tx_tail)
+    {
+        IE2 |= UCA0TXIE;                      // Restart a stalled transmit
+    }
+}
+
+/**
+ * Queues a single byte for the UART.  What happens when the buffer is full
+ * is decided by TX_POLICY.
+ **/
+void sendByte(char byte)
+{
+    unsigned int next = (tx_head + 1) & tx_mask;
+
+    while (next == tx_tail)
+    {
+#if TX_POLICY == TX_BLOCK
+        IE2 |= UCA0TXIE;                      // The interrupt makes room
+#else
+#if TX_POLICY == TX_DROP_COUNT
+        dropped_bytes++;
+#endif
+        return;
+#endif
+    }
+
+    tx_buffer[tx_head] = byte;
+    tx_head = next;
+    output_bytes++;
+    IE2 |= UCA0TXIE;
+}
+
+/**
+ * Queues a whole record.  The bytes are published to the TX interrupt once
+ * at the end, or whenever the buffer fills and TX_BLOCK has to wait.
+ **/
+void sendBytes(const char *bytes, unsigned int count)
+{
+    unsigned int head = tx_head;
+    unsigned int next;
+
+    while (count-- > 0)
+    {
+        next = (head + 1) & tx_mask;
+        if (next == tx_tail)
+        {
+#if TX_POLICY == TX_BLOCK
+            tx_head = head;                   // Send what is queued so far
+            IE2 |= UCA0TXIE;
+            while (next == tx_tail)
+                ;
+#else
+#if TX_POLICY == TX_DROP_COUNT
+            dropped_bytes++;
+#endif
+            bytes++;
+            continue;
+#endif
+        }
+
+        tx_buffer[head] = *bytes++;
+        head = next;
+        output_bytes++;
+    }
+
+    tx_head = head;
+    IE2 |= UCA0TXIE;
+}
+
+unsigned long droppedBytes(void)
+{
+    return dropped_bytes;
+}
+
+unsigned long outputBytes(void)
+{
+    return output_bytes;
+}
+
+unsigned int linkBytesPerSecond(void)
+{
+    return 960;                               // 9600 baud, 8N1
+}
+
+unsigned long platformTicks(void)
+{
+    unsigned int high;
+    unsigned int low;
+
+    do
+    {
+        high = ticks_high;
+        low = TAR;
+    }
+    while (high != ticks_high);
+
+    return ((unsigned long) high << 16) | low;
+}
+
+// The next compare of the slice timer, at most 0x8000 ticks on
+static void step_slice(void)
+{
+    unsigned int step = slice_left > 0x8000 ? 0x8000 : (unsigned int) slice_left;
+
+    TACCR1 += step;
+    slice_left -= step;
+}
+
+void startSlices(unsigned long period)
+{
+    __disable_interrupt();
+    slice_period = period;
+    slice_left = period;
+    slices_seen = slice_ticks;
+    TACCR1 = TAR;
+    step_slice();
+    TACCTL1 = CCIE;
+    __enable_interrupt();
+}
+
+unsigned int waitSlice(void)
+{
+    unsigned int ticks;
+
+    __disable_interrupt();
+    while (slice_ticks == slices_seen)
+    {
+        __bis_SR_register(LPM0_bits + GIE);   // the tick wakes the CPU
+        __disable_interrupt();
+    }
+    ticks = slice_ticks - slices_seen;
+    slices_seen = slice_ticks;
+    __enable_interrupt();
+
+    return ticks;
+}
+
+//  Timer_A overflow, the high word of platformTicks(), and the slice timer
+#pragma vector=TIMERA1_VECTOR
+__interrupt void TimerA1_ISR(void)
+{
+    switch (TAIV)
+    {
+    case TAIV_TACCR1:
+        if (slice_left == 0)
+        {
+            slice_ticks++;
+            slice_left = slice_period;
+            __bic_SR_register_on_exit(LPM0_bits);
+        }
+        step_slice();
+        break;
+    case TAIV_TAIFG:
+        ticks_high++;
+        break;
+    }
+}
+
+//  Send the next queued byte, stop interrupting when the buffer is empty
+#pragma vector=USCIAB0TX_VECTOR
+__interrupt void USCI0TX_ISR(void)
+{
+    if (tx_tail != tx_head)
+    {
+        UCA0TXBUF = tx_buffer[tx_tail];
+        tx_tail = (tx_tail + 1) & tx_mask;
+    }
+    else
+    {
+        IE2 &= ~UCA0TXIE;
+    }
+}
+
+//  Echo back RXed character, confirm TX buffer is ready first
+#pragma vector=USCIAB0RX_VECTOR
+__interrupt void USCI0RX_ISR(void)
+{
+    while (!(IFG2 & UCA0TXIFG))
+        ;                                     // USCI_A0 TX buffer ready?
+    UCA0TXBUF = UCA0RXBUF;                    // TX -> RXed character
+}
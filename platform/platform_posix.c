@@ -0,0 +1,437 @@
+//*****************************************************************************
+//
+// platform_posix.c
+//
+// Linux backend for the platform layer.  The benchmark runs as an ordinary
+// executable and the YAML output goes to one of:
+//
+//   BENCH_OUTPUT unset or "-"   standard output
+//   BENCH_OUTPUT=pty            a new pseudo-terminal; its name is printed on
+//                               standard error so a logger can attach to it
+//   BENCH_OUTPUT=<path>         a file, truncated at start
+//
+// The kernels loop forever, so the run is ended by BENCH_ITERATIONS (a
+// number of kernel iterations) and/or BENCH_SECONDS (wall-clock seconds),
+// or by the kernel itself through endRun().  When the run ends the output
+// is flushed and the iteration rate is reported on standard error:
+//
+//   iterations: 120000
+//   seconds: 2.013
+//   rate: 59612.5 iterations/s
+//   dropped: 0
+//
+// BENCH_BAUD=<rate> simulates the UART.  sendByte() then fills the same
+// TX_BUFFER_SIZE ring as the MSP430 backend and a drain thread takes one byte
+// out every ten bit times (8N1), standing in for the TX interrupt.  Comparing
+// TX_BUFFER_SIZE=2 against a full buffer shows how much printing the ring
+// overlaps with the kernel.  Without BENCH_BAUD the output is written as
+// fast as the target accepts it.
+//
+// The slice timer of startSlices() is another thread, which ticks on an
+// absolute schedule and wakes waitSlice() through a condition variable.
+//
+//*****************************************************************************
+
+#define _XOPEN_SOURCE 600
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "platform.h"
+
+#define     output_buffer_size      4096
+#define     tx_mask                 (TX_BUFFER_SIZE - 1)
+
+static int output_fd = 1;
+static int line_buffered = 0;
+static char output_buffer[output_buffer_size];
+static unsigned int output_length = 0;
+
+static char tx_buffer[TX_BUFFER_SIZE];
+static atomic_uint tx_head = 0;              // written by sendByte()
+static atomic_uint tx_tail = 0;              // written by the drain thread
+static atomic_int draining = 0;
+static long byte_nanoseconds = 0;
+static unsigned long dropped_bytes = 0;
+static unsigned long output_bytes = 0;
+static unsigned int link_bytes_per_second = 0;
+static pthread_t drain_thread;
+
+static pthread_t slice_thread;
+static pthread_mutex_t slice_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t slice_tick = PTHREAD_COND_INITIALIZER;
+static long slice_nanoseconds = 0;
+static unsigned int slice_ticks = 0;           // guarded by slice_lock
+static unsigned int slices_seen = 0;
+
+static unsigned long iterations = 0;
+static unsigned long iteration_limit = 0;
+static volatile sig_atomic_t time_is_up = 0;
+static struct timespec start_time;
+
+static double elapsed_seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start_time.tv_sec)
+            + (now.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static void flush_output(void)
+{
+    unsigned int written = 0;
+
+    while (written < output_length)
+    {
+        ssize_t n = write(output_fd, output_buffer + written,
+                          output_length - written);
+        if (n <= 0)
+        {
+            break;
+        }
+        written += n;
+    }
+    output_length = 0;
+}
+
+static void add_nanoseconds(struct timespec *t, long ns)
+{
+    t->tv_nsec += ns;
+    while (t->tv_nsec >= 1000000000L)
+    {
+        t->tv_nsec -= 1000000000L;
+        t->tv_sec++;
+    }
+}
+
+static void buffer_byte(char byte)
+{
+    output_buffer[output_length++] = byte;
+
+    if (output_length == output_buffer_size || (line_buffered && byte == '\n'))
+    {
+        flush_output();
+    }
+}
+
+/**
+ * Stands in for the USCI TX interrupt: one byte leaves the ring every
+ * byte_nanoseconds, on an absolute schedule so the rate does not drift.
+ **/
+static void *drain(void *unused)
+{
+    struct timespec next;
+    unsigned int tail;
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    while (atomic_load(&draining))
+    {
+        tail = atomic_load_explicit(&tx_tail, memory_order_relaxed);
+        if (tail == atomic_load_explicit(&tx_head, memory_order_acquire))
+        {
+            // line idle, the next byte starts when it arrives
+            clock_gettime(CLOCK_MONOTONIC, &next);
+            add_nanoseconds(&next, byte_nanoseconds);
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+            continue;
+        }
+
+        buffer_byte(tx_buffer[tail]);
+        atomic_store_explicit(&tx_tail, (tail + 1) & tx_mask,
+                              memory_order_release);
+
+        add_nanoseconds(&next, byte_nanoseconds);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+    }
+
+    return unused;
+}
+
+static void open_output(const char *target)
+{
+    if (target == NULL || strcmp(target, "-") == 0)
+    {
+        output_fd = 1;
+    }
+    else if (strcmp(target, "pty") == 0)
+    {
+        output_fd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (output_fd < 0 || grantpt(output_fd) != 0
+                || unlockpt(output_fd) != 0)
+        {
+            perror("platform: pty");
+            exit(1);
+        }
+        fprintf(stderr, "platform: output on %s\n", ptsname(output_fd));
+    }
+    else
+    {
+        output_fd = open(target, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (output_fd < 0)
+        {
+            perror(target);
+            exit(1);
+        }
+    }
+
+    line_buffered = isatty(output_fd);
+}
+
+static void end_run(void)
+{
+    double seconds = elapsed_seconds();
+    unsigned int tail;
+
+    if (atomic_load(&draining))
+    {
+        // the run is over, no need to wait out the baud rate for the rest
+        atomic_store(&draining, 0);
+        pthread_join(drain_thread, NULL);
+        tail = atomic_load(&tx_tail);
+        while (tail != atomic_load(&tx_head))
+        {
+            buffer_byte(tx_buffer[tail]);
+            tail = (tail + 1) & tx_mask;
+        }
+    }
+
+    flush_output();
+    fprintf(stderr, "iterations: %lu\n", iterations);
+    fprintf(stderr, "seconds: %.3f\n", seconds);
+    fprintf(stderr, "rate: %.1f iterations/s\n",
+            seconds > 0.0 ? iterations / seconds : 0.0);
+    fprintf(stderr, "dropped: %lu\n", dropped_bytes);
+    exit(0);
+}
+
+static void stop_timer(int signal_number)
+{
+    time_is_up = 1;
+}
+
+void initPlatform(void)
+{
+    const char *value;
+
+    open_output(getenv("BENCH_OUTPUT"));
+
+    value = getenv("BENCH_ITERATIONS");
+    if (value != NULL)
+    {
+        iteration_limit = strtoul(value, NULL, 10);
+    }
+
+    value = getenv("BENCH_SECONDS");
+    if (value != NULL && strtod(value, NULL) > 0.0)
+    {
+        // a timer rather than a clock read per iteration, which would cost
+        // more than some of the kernels' iterations
+        double seconds = strtod(value, NULL);
+        struct itimerval timer = { { 0, 0 }, { 0, 0 } };
+
+        timer.it_value.tv_sec = (long) seconds;
+        timer.it_value.tv_usec = (long) ((seconds - (long) seconds) * 1e6);
+        signal(SIGALRM, stop_timer);
+        setitimer(ITIMER_REAL, &timer, NULL);
+    }
+
+    value = getenv("BENCH_BAUD");
+    if (value != NULL && strtol(value, NULL, 10) > 0)
+    {
+        link_bytes_per_second = strtol(value, NULL, 10) / 10;
+        byte_nanoseconds = 10 * 1000000000L / strtol(value, NULL, 10);
+        atomic_store(&draining, 1);
+        if (pthread_create(&drain_thread, NULL, drain, NULL) != 0)
+        {
+            perror("platform: drain thread");
+            exit(1);
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+}
+
+/**
+ * There is no UART to reset on the host; the heartbeat call is used to push
+ * buffered output out instead.  With a simulated UART the drain thread owns
+ * the output buffer.
+ **/
+void initUART(void)
+{
+    if (!atomic_load(&draining))
+    {
+        flush_output();
+    }
+}
+
+void sendByte(char byte)
+{
+    unsigned int head;
+    unsigned int next;
+
+    if (!atomic_load_explicit(&draining, memory_order_relaxed))
+    {
+        buffer_byte(byte);
+        output_bytes++;
+        return;
+    }
+
+    head = atomic_load_explicit(&tx_head, memory_order_relaxed);
+    next = (head + 1) & tx_mask;
+
+    while (next == atomic_load_explicit(&tx_tail, memory_order_acquire))
+    {
+#if TX_POLICY == TX_BLOCK
+        if (time_is_up)
+        {
+            end_run();
+        }
+        sched_yield();
+#else
+#if TX_POLICY == TX_DROP_COUNT
+        dropped_bytes++;
+#endif
+        return;
+#endif
+    }
+
+    tx_buffer[head] = byte;
+    atomic_store_explicit(&tx_head, next, memory_order_release);
+    output_bytes++;
+}
+
+void sendBytes(const char *bytes, unsigned int count)
+{
+    unsigned int n;
+
+    if (atomic_load_explicit(&draining, memory_order_relaxed) || line_buffered)
+    {
+        while (count-- > 0)
+        {
+            sendByte(*bytes++);
+        }
+        return;
+    }
+
+    output_bytes += count;
+    while (count > 0)
+    {
+        n = output_buffer_size - output_length;
+        if (n > count)
+        {
+            n = count;
+        }
+        memcpy(output_buffer + output_length, bytes, n);
+        output_length += n;
+        bytes += n;
+        count -= n;
+
+        if (output_length == output_buffer_size)
+        {
+            flush_output();
+        }
+    }
+}
+
+unsigned long droppedBytes(void)
+{
+    return dropped_bytes;
+}
+
+unsigned long outputBytes(void)
+{
+    return output_bytes;
+}
+
+unsigned int linkBytesPerSecond(void)
+{
+    return link_bytes_per_second;
+}
+
+unsigned long platformTicks(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long) now.tv_sec * 1000000UL + now.tv_nsec / 1000;
+}
+
+/**
+ * Stands in for the slice interrupt: a tick every slice_nanoseconds, on an
+ * absolute schedule so that a late waitSlice() shows up as an overrun.
+ **/
+static void *slice_timer(void *unused)
+{
+    struct timespec next;
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    while (1)
+    {
+        add_nanoseconds(&next, slice_nanoseconds);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+        pthread_mutex_lock(&slice_lock);
+        slice_ticks++;
+        pthread_cond_signal(&slice_tick);
+        pthread_mutex_unlock(&slice_lock);
+    }
+    return NULL;
+}
+
+void startSlices(unsigned long period)
+{
+    slice_nanoseconds = (long) (period * (1000000000UL / PLATFORM_TICKS_PER_SECOND));
+    if (pthread_create(&slice_thread, NULL, slice_timer, NULL) != 0)
+    {
+        perror("platform: slice thread");
+        exit(1);
+    }
+}
+
+unsigned int waitSlice(void)
+{
+    unsigned int ticks;
+
+    pthread_mutex_lock(&slice_lock);
+    while (slice_ticks == slices_seen)
+    {
+        pthread_cond_wait(&slice_tick, &slice_lock);
+    }
+    ticks = slice_ticks - slices_seen;
+    slices_seen = slice_ticks;
+    pthread_mutex_unlock(&slice_lock);
+
+    return ticks;
+}
+
+void iterationDone(void)
+{
+    iterations++;
+
+    if (iteration_limit != 0 && iterations >= iteration_limit)
+    {
+        end_run();
+    }
+
+    if (time_is_up)
+    {
+        end_run();
+    }
+}
+
+void endRun(void)
+{
+    end_run();
+}
@@ -0,0 +1,629 @@
+//*****************************************************************************
+//
+// telemetry.c
+//
+// Text and binary implementations of the error records, see telemetry.h
+// for the record format.  The binary encoder builds records in a frame
+// buffer and sends the frame (COBS-encoded, TELEMETRY_FRAME_SIZE < 254
+// bytes) after every record that completes a YAML line, so nothing waits in
+// RAM for longer than one check.
+//
+//*****************************************************************************
+
+#include "platform.h"
+#include "telemetry.h"
+
+#ifndef TELEMETRY_BINARY
+
+static const char *const de_class_names[DE_CLASSES] = DE_CLASS_NAMES;
+static const char *const trace_step_names[TRACE_STEPS] = TRACE_STEP_NAMES;
+
+// Each record is formatted into a buffer on the stack and queued with one
+// sendBytes() call; the element records go out once per mismatched element.
+// The buffers are sized for the longest line a record can produce.
+
+static char *open_block(char *at, char key)
+{
+    at = formatString(at, "   ");
+    *at++ = key;
+    return formatString(at, ": {");
+}
+
+static char *end_line(char *at)
+{
+    *at++ = '\r';
+    *at++ = '\n';
+    return at;
+}
+
+static void send_line(const char *line, const char *end)
+{
+    sendBytes(line, end - line);
+}
+
+static int count_bits(unsigned int value)
+{
+    int bits = 0;
+
+    for (value &= 0xFFFF; value != 0; value &= value - 1)
+    {
+        bits++;
+    }
+    return bits;
+}
+
+void reportIteration(unsigned long ind)
+{
+    char line[20];
+    char *at = line;
+
+    at = formatString(at, " - i: ");
+    at = formatUnsigned(at, ind);
+    send_line(line, end_line(at));
+}
+
+void reportIterationSub(unsigned long ind, int sub_test)
+{
+    char line[28];
+    char *at = line;
+
+    at = formatString(at, " - i: ");
+    at = formatUnsigned(at, ind);
+    at = formatString(at, ", ");
+    at = formatSigned(at, sub_test);
+    send_line(line, end_line(at));
+}
+
+void reportElementIndex(char key, int first, int index, unsigned int value1,
+                        unsigned int value2)
+{
+    char line[28];
+    char *at = line;
+
+    if (first)
+    {
+        at = open_block(at, key);
+    }
+    at = formatSigned(at, index);
+    at = formatString(at, ": [");
+    at = formatHex16(at, value1);
+    at = formatString(at, ", ");
+    at = formatHex16(at, value2);
+    send_line(line, formatString(at, "],"));
+}
+
+void reportElementRowCol(char key, int first, int row, int col,
+                         unsigned long value1, unsigned long value2)
+{
+    char line[36];
+    char *at = line;
+
+    if (first)
+    {
+        at = open_block(at, key);
+    }
+    at = formatSigned(at, row);
+    *at++ = '_';
+    at = formatSigned(at, col);
+    at = formatString(at, ": [");
+    at = formatHex16(at, (unsigned int) value1);
+    at = formatString(at, ", ");
+    at = formatHex16(at, (unsigned int) value2);
+    send_line(line, formatString(at, "],"));
+}
+
+void reportElementValue(char key, int first, unsigned int value1,
+                        unsigned int value2)
+{
+    char line[18];
+    char *at = line;
+
+    if (first)
+    {
+        at = open_block(at, key);
+    }
+    at = formatHex16(at, value1);
+    at = formatString(at, ": ");
+    at = formatHex16(at, value2);
+    *at++ = ',';
+    send_line(line, at);
+}
+
+void reportElementIndexValue(char key, int first, int index, int value)
+{
+    char line[22];
+    char *at = line;
+
+    if (first)
+    {
+        at = open_block(at, key);
+    }
+    at = formatSigned(at, index);
+    at = formatString(at, ": ");
+    at = formatSigned(at, value);
+    *at++ = ',';
+    send_line(line, at);
+}
+
+void reportElementFlip(char key, int first, int index, unsigned int mask, int up,
+                       int down)
+{
+    int bits = count_bits(mask);
+    char line[40];
+    char *at = line;
+
+    if (first)
+    {
+        at = open_block(at, key);
+    }
+    at = formatSigned(at, index);
+    at = formatString(at, ": [");
+    at = formatHex16(at, mask);
+    at = formatString(at, ", ");
+    at = formatSigned(at, bits);
+    at = formatString(at, ", ");
+    at = formatSigned(at, up);
+    at = formatString(at, ", ");
+    at = formatSigned(at, down);
+    send_line(line, formatString(at, "],"));
+}
+
+void reportElementCluster(char key, int first, int index, int words, int bits)
+{
+    char line[32];
+    char *at = line;
+
+    if (first)
+    {
+        at = open_block(at, key);
+    }
+    at = formatSigned(at, index);
+    at = formatString(at, ": [");
+    at = formatSigned(at, words);
+    at = formatString(at, ", ");
+    at = formatSigned(at, bits);
+    send_line(line, formatString(at, "],"));
+}
+
+void reportElementsEnd(void)
+{
+    sendBytes("}\r\n", 3);
+}
+
+void reportCount(char key, int count)
+{
+    char line[16];
+    char *at = line;
+
+    at = formatString(at, "   ");
+    *at++ = key;
+    at = formatString(at, ": ");
+    at = formatSigned(at, count);
+    send_line(line, end_line(at));
+}
+
+void reportSum(int expected, int observed)
+{
+    char line[24];
+    char *at = line;
+
+    at = formatString(at, "   S: {");
+    at = formatSigned(at, expected);
+    at = formatString(at, ": ");
+    at = formatSigned(at, observed);
+    *at++ = '}';
+    send_line(line, end_line(at));
+}
+
+void reportDecoderError(int de_class, const int *reads, int count)
+{
+    char line[24];
+    char *at = line;
+    int i = 0;
+
+    at = formatString(at, "   ");
+    at = formatString(at, de_class_names[de_class]);
+    send_line(line, formatString(at, ": {"));
+
+    // one pair at a time, the number of reads is up to the caller
+    for (i = 0; i < count; i += 2)
+    {
+        at = i > 0 ? formatString(line, ", ") : line;
+        at = formatSigned(at, reads[i]);
+        at = formatString(at, ": ");
+        at = formatSigned(at, reads[i + 1]);
+        send_line(line, at);
+    }
+    sendBytes("}\n\r", 3);
+}
+
+void reportHeartbeat(unsigned long ind, const int *counters, int count)
+{
+    char line[16];
+    char *at = line;
+    int i = 0;
+
+    at = formatString(at, "# ");
+    send_line(line, formatUnsigned(at, ind));
+    for (i = 0; i < count; i++)
+    {
+        at = formatString(line, ", ");
+        send_line(line, formatSigned(at, counters[i]));
+    }
+    at = formatString(line, ", ");
+    at = formatUnsigned(at, droppedBytes());
+    send_line(line, end_line(at));
+}
+
+void reportTrace(char key, int round, int step, int bytes)
+{
+    char line[40];
+    char *at = line;
+
+    at = formatString(at, "   T");
+    *at++ = key;
+    at = formatString(at, ": [");
+    at = formatSigned(at, round);
+    at = formatString(at, ", ");
+    at = formatString(at, trace_step_names[step]);
+    at = formatString(at, ", ");
+    at = formatSigned(at, bytes);
+    *at++ = ']';
+    send_line(line, end_line(at));
+}
+
+void reportLatency(unsigned long microseconds)
+{
+    char line[24];
+    char *at = line;
+
+    at = formatString(at, "   L: ");
+    at = formatUnsigned(at, microseconds);
+    send_line(line, end_line(at));
+}
+
+static void report_printing(int mode, unsigned long ind)
+{
+    char line[32];
+    char *at = line;
+
+    at = formatString(at, "# printing: ");
+    at = formatSigned(at, mode);
+    at = formatString(at, ", ");
+    at = formatUnsigned(at, ind);
+    send_line(line, end_line(at));
+}
+
+void telemetryText(char c)
+{
+    sendByte(c);
+}
+
+void telemetryFlush(void)
+{
+}
+
+#else
+
+static unsigned char frame[TELEMETRY_FRAME_SIZE];
+static unsigned int frame_length = 0;
+static int text_open = 0;
+static int previous_index = 0;
+
+static void send_frame(void)
+{
+    unsigned int start = 0;
+    unsigned int end = 0;
+
+    // COBS: every run of non-zero bytes is preceded by its length plus one,
+    // and the zero that ended it is implied
+    while (1)
+    {
+        end = start;
+        while (end < frame_length && frame[end] != 0)
+        {
+            end++;
+        }
+
+        sendByte((char) (end - start + 1));
+        while (start < end)
+        {
+            sendByte((char) frame[start++]);
+        }
+
+        if (end >= frame_length)
+        {
+            break;
+        }
+        start = end + 1;
+    }
+    sendByte(0);
+
+    frame_length = 0;
+    text_open = 0;
+}
+
+static void begin_record(unsigned char type, unsigned int max_length)
+{
+    if (text_open || frame_length + max_length > TELEMETRY_FRAME_SIZE)
+    {
+        send_frame();
+    }
+    frame[frame_length++] = type;
+}
+
+static void put_varint(unsigned long value)
+{
+    value &= 0xFFFFFFFFUL;
+    while (value >= 0x80)
+    {
+        frame[frame_length++] = (unsigned char) (value | 0x80);
+        value >>= 7;
+    }
+    frame[frame_length++] = (unsigned char) value;
+}
+
+static void put_signed(int value)
+{
+    int v = (short) value;
+
+    put_varint(v < 0 ? ((unsigned long) ~v << 1) | 1 : (unsigned long) v << 1);
+}
+
+static void put_element(unsigned char type, char key, int first,
+                        unsigned int max_length)
+{
+    if (first)
+    {
+        begin_record(type | TM_FIRST, max_length + 1);
+        frame[frame_length++] = key;
+        previous_index = 0;
+    }
+    else
+    {
+        begin_record(type, max_length);
+    }
+}
+
+void reportIteration(unsigned long ind)
+{
+    begin_record(TM_ITERATION, 6);
+    put_varint(ind);
+}
+
+void reportIterationSub(unsigned long ind, int sub_test)
+{
+    begin_record(TM_ITERATION_SUB, 9);
+    put_varint(ind);
+    put_signed(sub_test);
+}
+
+void reportElementIndex(char key, int first, int index, unsigned int value1,
+                        unsigned int value2)
+{
+    put_element(TM_ELEMENT_INDEX, key, first, 10);
+    put_signed(index - previous_index);
+    put_varint(value1 & 0xFFFF);
+    put_varint((value1 ^ value2) & 0xFFFF);
+    previous_index = index;
+}
+
+void reportElementRowCol(char key, int first, int row, int col,
+                         unsigned long value1, unsigned long value2)
+{
+    put_element(TM_ELEMENT_ROW_COL, key, first, 13);
+    put_varint(row);
+    put_varint(col);
+    put_varint(value1 & 0xFFFF);
+    put_varint((value1 ^ value2) & 0xFFFF);
+}
+
+void reportElementValue(char key, int first, unsigned int value1,
+                        unsigned int value2)
+{
+    put_element(TM_ELEMENT_VALUE, key, first, 7);
+    put_varint(value1 & 0xFFFF);
+    put_varint((value1 ^ value2) & 0xFFFF);
+}
+
+void reportElementIndexValue(char key, int first, int index, int value)
+{
+    put_element(TM_ELEMENT_INDEX_VALUE, key, first, 7);
+    put_signed(index - previous_index);
+    put_signed(value);
+    previous_index = index;
+}
+
+void reportElementFlip(char key, int first, int index, unsigned int mask, int up,
+                       int down)
+{
+    put_element(TM_ELEMENT_FLIP, key, first, 8);
+    put_signed(index - previous_index);
+    put_varint(mask & 0xFFFF);
+    frame[frame_length++] = (unsigned char) up;
+    frame[frame_length++] = (unsigned char) down;
+    previous_index = index;
+}
+
+void reportElementCluster(char key, int first, int index, int words, int bits)
+{
+    put_element(TM_ELEMENT_CLUSTER, key, first, 9);
+    put_signed(index - previous_index);
+    put_varint(words);
+    put_varint(bits);
+    previous_index = index;
+}
+
+void reportElementsEnd(void)
+{
+    begin_record(TM_ELEMENTS_END, 1);
+    send_frame();
+}
+
+void reportCount(char key, int count)
+{
+    begin_record(TM_COUNT, 5);
+    frame[frame_length++] = key;
+    put_signed(count);
+    send_frame();
+}
+
+void reportSum(int expected, int observed)
+{
+    begin_record(TM_SUM, 7);
+    put_signed(expected);
+    put_signed(observed);
+    send_frame();
+}
+
+void reportDecoderError(int de_class, const int *reads, int count)
+{
+    int i = 0;
+
+    begin_record(TM_DECODER_ERROR, 2 + 3 * count);
+    frame[frame_length++] = (unsigned char) de_class;
+    put_signed(reads[0]);
+    for (i = 1; i < count; i++)
+    {
+        put_varint((reads[i] ^ reads[0]) & 0xFFFF);
+    }
+    send_frame();
+}
+
+void reportHeartbeat(unsigned long ind, const int *counters, int count)
+{
+    int i = 0;
+
+    begin_record(TM_HEARTBEAT, 11 + 3 * count);
+    put_varint(ind);
+    for (i = 0; i < count; i++)
+    {
+        put_signed(counters[i]);
+    }
+    put_varint(droppedBytes());
+    send_frame();
+}
+
+void reportTrace(char key, int round, int step, int bytes)
+{
+    begin_record(TM_TRACE, 8);
+    frame[frame_length++] = key;
+    put_varint(round);
+    frame[frame_length++] = (unsigned char) step;
+    put_varint(bytes);
+    send_frame();
+}
+
+void reportLatency(unsigned long microseconds)
+{
+    begin_record(TM_LATENCY, 6);
+    put_varint(microseconds);
+    send_frame();
+}
+
+static void report_printing(int mode, unsigned long ind)
+{
+    begin_record(TM_PRINTING, 7);
+    frame[frame_length++] = (unsigned char) mode;
+    put_varint(ind);
+    send_frame();
+}
+
+void telemetryText(char c)
+{
+    if (text_open && frame_length == TELEMETRY_FRAME_SIZE)
+    {
+        send_frame();
+    }
+
+    if (!text_open)
+    {
+        begin_record(TM_TEXT, 2);
+        text_open = 1;
+    }
+
+    frame[frame_length++] = c;
+}
+
+void telemetryFlush(void)
+{
+    if (frame_length > 0)
+    {
+        send_frame();
+    }
+}
+
+#endif
+
+static int robust_now = 1;
+static int budget_started = 0;
+static long tokens = 0;
+static unsigned long budget_ticks = 0;
+static unsigned long budget_output = 0;
+static unsigned long refill_credit = 0;
+
+int robustPrinting(int setting, unsigned long ind)
+{
+    unsigned int rate = linkBytesPerSecond();
+    long burst = 0;
+    unsigned long now = 0;
+    unsigned long elapsed = 0;
+    unsigned long spent = 0;
+
+    if (setting != PRINTING_ADAPTIVE)
+    {
+        return setting;
+    }
+    if (rate == 0)
+    {
+        return 1;                           // the link is not the limit
+    }
+
+    burst = (long) rate * PRINT_BUDGET_MS / 1000;
+    now = platformTicks();
+
+    if (!budget_started)
+    {
+        tokens = burst;
+        budget_ticks = now;
+        budget_output = outputBytes();
+        budget_started = 1;
+    }
+
+    elapsed = now - budget_ticks;
+    budget_ticks = now;
+    spent = outputBytes() - budget_output;
+    budget_output += spent;
+
+    if (elapsed >= PLATFORM_TICKS_PER_SECOND * PRINT_BUDGET_MS / 1000)
+    {
+        tokens = burst;
+        refill_credit = 0;
+    }
+    else
+    {
+        // keep the fraction of a byte, checks can be much closer together
+        // than one byte time
+        refill_credit += elapsed * rate;
+        tokens += refill_credit / PLATFORM_TICKS_PER_SECOND;
+        refill_credit %= PLATFORM_TICKS_PER_SECOND;
+        if (tokens > burst)
+        {
+            tokens = burst;
+        }
+    }
+    tokens -= spent;
+
+    if (robust_now && tokens <= 0)
+    {
+        robust_now = 0;
+        report_printing(robust_now, ind);
+    }
+    else if (!robust_now && tokens >= burst / 2)
+    {
+        robust_now = 1;
+        report_printing(robust_now, ind);
+    }
+
+    return robust_now;
+}
@@ -0,0 +1,159 @@
+//*****************************************************************************
+//
+// telemetry.h
+//
+// Every error record the benchmarks print goes through the report*()
+// functions below, one per YAML shape.  By default they print the YAML text
+// the benchmarks have always printed.  Compiled with -DTELEMETRY_BINARY they
+// send compact binary records instead, and tools/telemetry_decode rebuilds
+// the identical YAML text on the host, so the analysis scripts do not change.
+//
+// Binary format.  The output is a sequence of COBS-encoded frames, each
+// followed by a 0x00 delimiter, so a logger can resynchronise after a lost
+// byte.  A frame holds one or more records.  A record is a type byte followed
+// by its fields; unsigned fields are varints (7 bits per byte, least
+// significant group first, high bit set on all but the last byte) and signed
+// fields are zigzag-encoded varints.  Values are sent as they would be
+// printed: %i and %x fields are 16 bit, %n fields 32 bit.
+//
+//   TM_TEXT             bytes up to the end of the frame, printed as is
+//   TM_ITERATION        ind                          " - i: %n\r\n"
+//   TM_ITERATION_SUB    ind, sub_test (signed)       " - i: %n, %i\r\n"
+//   TM_ELEMENT_*        one mismatched element, see below
+//   TM_ELEMENTS_END                                  "}\r\n"
+//   TM_COUNT            key byte, count (signed)     "   %c: %i\r\n"
+//   TM_SUM              expected, observed (signed)  "   S: {%i: %i}\r\n"
+//   TM_DECODER_ERROR    class byte, reads (signed, the 2nd and later ones
+//                       XORed with the 1st)          "   <class>: {%i: %i...}"
+//   TM_HEARTBEAT        ind, counters (signed), dropped bytes
+//                                                    "# %n, %i, ..., %n\r\n"
+//   TM_PRINTING         mode byte, ind               "# printing: %i, %n\r\n"
+//   TM_TRACE            key byte, round, step byte, differing bytes
+//                                                    "   T<key>: [%i, <step>, %i]\r\n"
+//   TM_LATENCY          microseconds                 "   L: %n\r\n"
+//
+// Element records carry TM_FIRST when they open a block, in which case the
+// key byte follows the type byte and the element is printed after
+// "   <key>: {".  Indices are sent as the difference from the previous
+// element in the block and the second value XORed with the first, because
+// an upset changes an element in only a few bits.
+//
+//   TM_ELEMENT_INDEX      index, value1, value2      "%i: [%x, %x],"
+//   TM_ELEMENT_ROW_COL    row, col, value1, value2   "%i_%i: [%x, %x],"
+//   TM_ELEMENT_VALUE      value1, value2             "%x: %x,"
+//   TM_ELEMENT_INDEX_VALUE index, value (signed)     "%i: %i,"
+//   TM_ELEMENT_FLIP       index, mask, up, down byte "%i: [%x, %i, %i, %i],"
+//   TM_ELEMENT_CLUSTER    index, words, bits         "%i: [%i, %i],"
+//
+// A flip element is a mismatched word as the bits that flipped: the XOR
+// mask, its popcount, and how many of them went 0 to 1 (up) and 1 to 0
+// (down); a bit that flipped both ways counts in both.  A cluster element is a run of adjacent mismatched words, a
+// multi-cell upset: its first index, the words in it and the bits flipped.
+//
+//*****************************************************************************
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#define     TM_TEXT                     0x01
+#define     TM_ITERATION                0x02
+#define     TM_ITERATION_SUB            0x03
+#define     TM_ELEMENT_INDEX            0x10
+#define     TM_ELEMENT_ROW_COL          0x11
+#define     TM_ELEMENT_VALUE            0x12
+#define     TM_ELEMENT_INDEX_VALUE      0x13
+#define     TM_ELEMENT_FLIP             0x14
+#define     TM_ELEMENT_CLUSTER          0x15
+#define     TM_FIRST                    0x08
+#define     TM_ELEMENTS_END             0x20
+#define     TM_COUNT                    0x21
+#define     TM_SUM                      0x22
+#define     TM_DECODER_ERROR            0x23
+#define     TM_HEARTBEAT                0x24
+#define     TM_PRINTING                 0x25
+#define     TM_TRACE                    0x26
+#define     TM_LATENCY                  0x27
+
+#ifndef TELEMETRY_FRAME_SIZE
+#define     TELEMETRY_FRAME_SIZE        64
+#endif
+
+// Decoder-error classes from the double reads in the cache tests
+#define     DE_SARR_SEU                 0
+#define     DE_FARR1                    1
+#define     DE_FARR1_AND_2              2
+#define     DE_FARR1_OR_SARR1           3
+#define     DE_SARR1_AND_2              4
+#define     DE_ALL                      5
+#define     DE_SARR1                    6
+#define     DE_SET                      7
+#define     DE_CLASSES                  8
+
+#define     DE_CLASS_NAMES              { "SARR_SEU", "DE_FARR1", "DE_FARR1&2", \
+                                          "DE_FARR1orSARR1", "DE_SARR1&2",     \
+                                          "DE_all", "DE_SARR1", "SET" }
+
+// Cipher steps of the AES trace records: the first step of a re-executed
+// vector whose state differs from the golden trace, or TRACE_CLEAN
+#define     TRACE_ADD_ROUND_KEY         0
+#define     TRACE_SUB_BYTES             1
+#define     TRACE_SHIFT_ROWS            2
+#define     TRACE_MIX_COLUMNS           3
+#define     TRACE_INV_SUB_BYTES         4
+#define     TRACE_INV_SHIFT_ROWS        5
+#define     TRACE_INV_MIX_COLUMNS       6
+#define     TRACE_CLEAN                 7
+#define     TRACE_STEPS                 8
+
+#define     TRACE_STEP_NAMES            { "AddRoundKey", "SubBytes", "ShiftRows", \
+                                          "MixColumns", "InvSubBytes",         \
+                                          "InvShiftRows", "InvMixColumns",     \
+                                          "clean" }
+
+// Printing modes, the robust_printing setting of each benchmark.  With
+// PRINTING_ADAPTIVE the checks print every (golden, observed) pair while
+// the output stays within a token bucket that refills at the link rate and
+// holds PRINT_BUDGET_MS of link time.  Once a check finds the bucket empty
+// the checks print counts only, until it is half full again.  Every switch
+// is marked with a "# printing: <mode>, <ind>" line, so the analysis knows
+// which records are complete.  A record in progress is never cut short;
+// its bytes are taken from the budget of the checks that follow.
+#define     PRINTING_COUNT_ONLY         0
+#define     PRINTING_ROBUST             1
+#define     PRINTING_ADAPTIVE           2
+
+#ifndef PRINT_BUDGET_MS
+#define     PRINT_BUDGET_MS             1000
+#endif
+
+// Called by a check at its first mismatch; returns 1 to print the pairs
+int robustPrinting(int setting, unsigned long ind);
+
+void reportIteration(unsigned long ind);
+void reportIterationSub(unsigned long ind, int sub_test);
+void reportElementIndex(char key, int first, int index, unsigned int value1,
+                        unsigned int value2);
+void reportElementRowCol(char key, int first, int row, int col,
+                         unsigned long value1, unsigned long value2);
+void reportElementValue(char key, int first, unsigned int value1,
+                        unsigned int value2);
+void reportElementIndexValue(char key, int first, int index, int value);
+void reportElementFlip(char key, int first, int index, unsigned int mask, int up,
+                       int down);
+void reportElementCluster(char key, int first, int index, int words, int bits);
+void reportElementsEnd(void);
+void reportCount(char key, int count);
+void reportSum(int expected, int observed);
+void reportDecoderError(int de_class, const int *reads, int count);
+void reportHeartbeat(unsigned long ind, const int *counters, int count);
+void reportTrace(char key, int round, int step, int bytes);
+
+// The bound on how long the errors just reported can have gone undetected,
+// printed after them by the scrubbing tests
+void reportLatency(unsigned long microseconds);
+
+// Used by tinyPrintf(): in binary mode its output becomes TM_TEXT records.
+void telemetryText(char c);
+void telemetryFlush(void);
+
+#endif
@@ -0,0 +1,215 @@
+//*****************************************************************************
+//
+// tiny_printf.c
+//
+// A small printf for the benchmark output.  It supports the same format
+// subset as the 43oh tiny printf the benchmarks were written against
+// (http://www.43oh.com/forum/viewtopic.php?f=10&t=1732), so the YAML
+// output is unchanged:
+//
+//   %c  character          %i  16 bit signed      %l  32 bit signed
+//   %s  string             %u  16 bit unsigned    %n  32 bit unsigned
+//   %x  16 bit hexadecimal, four digits
+//
+// The widths are those of the MSP430, so a hosted build prints exactly
+// what the part prints.  Every character goes out through sendByte(), or
+// into a text record when the binary telemetry is compiled in.
+//
+// The conversions are also exported as the format*() functions, which
+// write into a caller's buffer.  The error records are built with them and
+// sent with one sendBytes() call, so the per-element path parses no format
+// string, walks no argument list and enters the transmit path once.
+//
+//*****************************************************************************
+
+#include <stdarg.h>
+
+#include "platform.h"
+#include "telemetry.h"
+
+#ifdef TELEMETRY_BINARY
+#define     put_char(c)         telemetryText(c)
+#else
+#define     put_char(c)         sendByte(c)
+#endif
+
+static const unsigned long decimal_places[] = { 1000000000, 100000000, 10000000,
+                                                1000000, 100000, 10000 };
+static const unsigned int decimal_places16[] = { 10000, 1000, 100, 10, 1 };
+
+static const char hex_digits[16] = { '0', '1', '2', '3', '4', '5', '6', '7',
+                                     '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+// Digits by repeated subtraction: the MSP430 has no divide instruction.
+// Anything below 10,000 is done in 16 bit arithmetic, which covers every
+// %i and %u value and is much cheaper than 32 bit on the part.
+static char *format_places16(char *at, unsigned int value,
+                             const unsigned int *place)
+{
+    char c;
+
+    do
+    {
+        c = '0';
+        while (value >= *place)
+        {
+            value -= *place;
+            c++;
+        }
+        *at++ = c;
+    }
+    while (*place++ != 1);
+
+    return at;
+}
+
+char *formatString(char *at, const char *s)
+{
+    while (*s)
+    {
+        *at++ = *s++;
+    }
+    return at;
+}
+
+char *formatSigned(char *at, int value)
+{
+    unsigned int u = value;
+
+    if ((short) u < 0)
+    {
+        *at++ = '-';
+        u = 0 - u;
+    }
+    return formatUnsigned16(at, u);
+}
+
+char *formatUnsigned16(char *at, unsigned int value)
+{
+    const unsigned int *place = decimal_places16;
+
+    value &= 0xFFFF;
+    while (value < *place && *place != 1)
+    {
+        place++;
+    }
+    return format_places16(at, value, place);
+}
+
+char *formatUnsigned(char *at, unsigned long value)
+{
+    const unsigned long *place = decimal_places;
+    char c;
+
+    value &= 0xFFFFFFFFUL;
+    if (value <= 0xFFFF)
+    {
+        return formatUnsigned16(at, (unsigned int) value);
+    }
+
+    // value > 65535, so this stops at the 10,000s at the latest
+    while (value < *place)
+    {
+        place++;
+    }
+    do
+    {
+        c = '0';
+        while (value >= *place)
+        {
+            value -= *place;
+            c++;
+        }
+        *at++ = c;
+    }
+    while (*place++ != 10000);
+
+    return format_places16(at, (unsigned int) value, decimal_places16 + 1);
+}
+
+char *formatHex16(char *at, unsigned int value)
+{
+    at[0] = hex_digits[(value >> 12) & 0xF];
+    at[1] = hex_digits[(value >> 8) & 0xF];
+    at[2] = hex_digits[(value >> 4) & 0xF];
+    at[3] = hex_digits[value & 0xF];
+    return at + 4;
+}
+
+char *formatHex32(char *at, unsigned long value)
+{
+    at = formatHex16(at, (unsigned int) (value >> 16));
+    return formatHex16(at, (unsigned int) value);
+}
+
+static void put_field(const char *field, const char *end)
+{
+    while (field < end)
+    {
+        put_char(*field++);
+    }
+}
+
+void tinyPrintf(char *format, ...)
+{
+    char c;
+    char *s;
+    char field[FORMAT_FIELD_SIZE];
+    unsigned long n;
+    va_list args;
+
+    va_start(args, format);
+
+    while ((c = *format++) != 0)
+    {
+        if (c != '%')
+        {
+            put_char(c);
+            continue;
+        }
+
+        switch (c = *format++)
+        {
+        case 's':
+            s = va_arg(args, char *);
+            while (*s)
+            {
+                put_char(*s++);
+            }
+            break;
+        case 'c':
+            put_char((char) va_arg(args, int));
+            break;
+        case 'i':
+            put_field(field, formatSigned(field, va_arg(args, int)));
+            break;
+        case 'u':
+            put_field(field, formatUnsigned16(field, va_arg(args, unsigned int)));
+            break;
+        case 'l':
+            n = (unsigned long) va_arg(args, long) & 0xFFFFFFFFUL;
+            if (n & 0x80000000UL)
+            {
+                put_char('-');
+                n = 0 - n;
+            }
+            put_field(field, formatUnsigned(field, n));
+            break;
+        case 'n':
+            put_field(field, formatUnsigned(field, va_arg(args, unsigned long)));
+            break;
+        case 'x':
+            put_field(field, formatHex16(field, va_arg(args, unsigned int)));
+            break;
+        case 0:
+            format--;
+            break;
+        default:
+            put_char(c);
+            break;
+        }
+    }
+
+    va_end(args);
+    telemetryFlush();
+}
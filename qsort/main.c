@@ -10,8 +10,8 @@
 // This test is a simple program for testing quicksort.  The input data are
 // the same pattern as the cache_static tests: mostly 0s, mostly 1s, mostly
 // As, and msotly 5s.  As with the other test, the values have their addresses
-// encoded to see if the issue could be address decoding.  As with the cache_static
-// test, larger test arrays need to have the pattern changed.  The test is
+// encoded to see if the issue could be address decoding.  The array is the size of
+// its pattern.h, which tools/pattern_gen generates for any size.  The test is
 // designed to test whether sorting many numbers cause more errors than sorting
 // an already sorted array, so the algorithm switches between sorting forward twice
 // and then sorting backward twice.  This version of the code includes qsort algorithms,
@@ -24,25 +24,21 @@
 // for the Texas Instruments MSP430F2619.
 
 // The output is designed to go out the UART at a speed of 9,600 baud and uses a tiny
-// print to reduce the printf footprint.  The tiny printf can be downloaded from 
+// print to reduce the printf footprint.  The tiny printf in the platform layer follows 
 // http://www.43oh.com/forum/viewtopic.php?f=10&t=1732  All of the output is YAML
 // parsable.
 //
  *****************************************************************************/
 
-#include <msp430.h>
-#include <string.h>
-#include "stdio.h"
+#include "platform.h"
+#include "telemetry.h"
 
 #include "pattern.h"
 
 void printHeader(void);
-void sendByte(char);
-void initUART(void);
-void initMSP430();
 
-#define     robust_printing           1
-#define     array_elements            180
+#define     robust_printing           PRINTING_ADAPTIVE
+#define     array_elements            PATTERN_ELEMENTS    // 180
 #define     change_rate               50
 
 int seed_value = -1;
@@ -113,28 +109,33 @@ void quick_sort_rev (int *a, int n) {
     quick_sort_rev(l, a + n - l);
 }
 
-int checker(int golden_array[], int dut_array[], int sub_test) {
+int checker(const int golden_array[], int dut_array[], int sub_test) {
     int first_error = 0;
+    int robust = -1;
     int num_of_errors = 0;
     int i = 0;
 
     for(i=0; i<array_elements; i++) {
         if (golden_array[i] != dut_array[i]) {
+            // printing is decided at the first mismatch, by the output budget
+            if (robust < 0) {
+                robust = robustPrinting(robust_printing, ind);
+            }
             if (!first_error) {
-                if (!in_block && robust_printing) {
-                    printf(" - i: %u, %i\r\n", ind, sub_test);
-                    printf("   E: {%i: [%x, %x],", i, golden_array[i], dut_array[i]);
+                if (!in_block && robust) {
+                    reportIterationSub(ind, sub_test);
+                    reportElementIndex('E', 1, i, golden_array[i], dut_array[i]);
                     first_error = 1;
                     in_block = 1;
                 }
-                else if (in_block && robust_printing){
-                    printf("   E: {%i: [%x, %x],", i, golden_array[i], dut_array[i]);
+                else if (in_block && robust){
+                    reportElementIndex('E', 1, i, golden_array[i], dut_array[i]);
                     first_error = 1;
                 }
             }
             else {
-                if (robust_printing)
-                    printf("%i: [%x, %x],", i, golden_array[i], dut_array[i]);
+                if (robust)
+                    reportElementIndex('E', 0, i, golden_array[i], dut_array[i]);
 
             }
             num_of_errors++;
@@ -142,18 +143,18 @@ int checker(int golden_array[], int dut_array[], int sub_test) {
     }
 
     if (first_error) {
-        printf("}\r\n");
+        reportElementsEnd();
         first_error = 0;
     }
 
-    if (!robust_printing && (num_of_errors > 0)) {
+    if (!robust && (num_of_errors > 0)) {
         if (!in_block) {
-            printf(" - i: %u, %i\r\n", ind, sub_test);
-            printf("   E: %i\r\n", num_of_errors);
+            reportIterationSub(ind, sub_test);
+            reportCount('E', num_of_errors);
             in_block = 1;
         }
         else {
-            printf("   E: %i\r\n", num_of_errors);
+            reportCount('E', num_of_errors);
         }
     }
 
@@ -195,11 +196,12 @@ void qsort_test() {
                 initUART();
             }
 
-            printf("# %u, %i\r\n", ind, total_errors);
+            reportHeartbeat(ind, &total_errors, 1);
         }
 
         //reset vars and such
         ind++;
+        iterationDone();
 
     }
 
@@ -208,10 +210,10 @@ void qsort_test() {
 int main(void)
 {
 
-    initMSP430();
+    initPlatform();
 
     printf("\n\r---\n\r");
-    printf("hw: MSP430F2619\r\n");
+    printf("hw: %s\r\n", PLATFORM_HW);
     printf("test: qsort_flash\r\n");
     printf("mit: none\r\n");
     printf("printing: %i\r\n", robust_printing);
@@ -222,87 +224,3 @@ int main(void)
 
     qsort_test();
 }
-
-void initMSP430()
-{
-    //MSP430F2619 initialization code
-    WDTCTL = WDTPW + WDTHOLD;
-
-    if (CALBC1_1MHZ == 0xFF)				// If calibration constant erased
-    {
-        while (1)
-            ;                               // do not load, trap CPU!!
-    }
-    DCOCTL = 0;                          // Select lowest DCOx and MODx settings
-    BCSCTL1 = CALBC1_1MHZ;                    // Set DCO
-    DCOCTL = CALDCO_1MHZ;
-
-    initUART();
-}
-
-/**
- * Initializes the UART for 9600 baud with a RX interrupt
- **/
-void initUART(void)
-{
-
-    P3SEL = 0x30;                             // P3.4,5 = USCI_A0 TXD/RXD
-    UCA0CTL1 |= UCSSEL_2;                     // SMCLK
-    UCA0BR0 = 104;                           // 1MHz 9600; (104)decimal = 0x068h
-    UCA0BR1 = 0;                              // 1MHz 9600
-    UCA0MCTL = UCBRS0;                        // Modulation UCBRSx = 1
-    UCA0CTL1 &= ~UCSWRST;                   // **Initialize USCI state machine**
-    //IE2 |= UCA0RXIE; 						  // Enable USCI_A0 RX interrupt
-}
-
-/**
- * puts() is used by printf() to display or send a string.. This function
- * determines where printf prints to. For this case it sends a string
- * out over UART, another option could be to display the string on an
- * LCD display.
- **/
-int puts(const char *_ptr)
-{
-    unsigned int i, len;
-
-    len = strlen(_ptr);
-
-    for (i = 0; i < len; i++)
-    {
-        sendByte(_ptr[i]);
-    }
-
-    return len;
-}
-/**
- * puts() is used by printf() to display or send a character. This function
- * determines where printf prints to. For this case it sends a character
- * out over UART.
- **/
-int putc(int _x, FILE *_fp)
-{
-    sendByte(_x);
-
-    return _x;
-}
-
-/**
- * Sends a single byte out through UART
- **/
-void sendByte(char byte)
-{
-    while (!(IFG2 & UCA0TXIFG))
-        ; // USCI_A0 TX buffer ready?
-    UCA0TXBUF = byte; // TX -> RXed character
-}
-
-//  Echo back RXed character, confirm TX buffer is ready first
-#pragma vector=USCIAB0RX_VECTOR
-__interrupt void USCI0RX_ISR(void)
-{
-
-    while (!(IFG2 & UCA0TXIFG))
-        ;                // USCI_A0 TX buffer ready?
-    UCA0TXBUF = UCA0RXBUF;                    // TX -> RXed character
-}
-
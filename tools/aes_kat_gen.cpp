@@ -0,0 +1,426 @@
+//*****************************************************************************
+//
+// aes_kat_gen.cpp
+//
+// Builds the AES benchmark's test-vector header from NIST CAVP known-answer
+// files (the ECB*.rsp files of KAT_AES.zip, 128, 192 or 256 bit keys):
+//
+//   c++ -std=c++11 -O2 -o aes_kat_gen tools/aes_kat_gen.cpp
+//   aes_kat_gen -o aes/aes_kat.h ECBGFSbox128.rsp ECBKeySbox128.rsp
+//       ECBVarKey128.rsp ECBVarTxt128.rsp ECBGFSbox192.rsp ...
+//
+// Each file becomes one suite, named after the file, in the order given.
+// The suites are grouped by key size under #if AES_KEY_BITS, so a build
+// only carries the suites of the key size it runs.
+// A record is packed as key, plaintext, ciphertext (48 bytes for AES-128,
+// 56 and 64 for the longer keys); the decryption key and the input block
+// the benchmark needs are copies of the key and the plaintext, so they are
+// not stored.  Records are kept in file order, [ENCRYPT] and [DECRYPT]
+// sections alike, so a pass runs the same vectors as the old headers did.
+//
+// The VarKey and VarTxt files walk a one bit through a zero key or
+// plaintext: vector j has j % n + 1 leading ones, n being the key or block
+// size in bits, and the other input is zero.  Such a suite is written as
+// its n ciphertexts only and the benchmark builds the rest of each record
+// from the index (AES_VARKEY and AES_VARTXT in aes_vectors.h).  The check
+// covers every record, so a file that does not follow the pattern exactly
+// is stored packed.
+//
+// Each suite also gets the digest of its ciphertexts, which aes.c checks
+// once per suite when it is built with -DAES_DIGEST: the CRC-32 (as in
+// zlib) of all of them, in record order.
+//
+//*****************************************************************************
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum Kind { PACKED, VARKEY, VARTXT };
+
+const char *const kind_names[] = { "AES_PACKED", "AES_VARKEY", "AES_VARTXT" };
+
+struct Suite
+{
+    std::string name;
+    size_t key_bytes;
+    Kind kind;
+    std::vector<std::string> records;       // packed, as hex
+};
+
+std::string trim(const std::string &s)
+{
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return begin == std::string::npos ? "" : s.substr(begin, end - begin + 1);
+}
+
+std::string suite_name(const std::string &path)
+{
+    size_t slash = path.find_last_of("/\\");
+    std::string name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+    size_t dot = name.find('.');
+
+    name = name.substr(0, dot);
+    for (char &c : name)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)))
+        {
+            c = '_';
+        }
+    }
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+    {
+        name = "kat_" + name;
+    }
+    return name;
+}
+
+std::string hex_field(const std::string &value, size_t bytes, const char *what)
+{
+    std::string hex = trim(value);
+
+    if (hex.size() != 2 * bytes)
+    {
+        throw std::runtime_error(std::string(what) + " is not "
+                                 + std::to_string(bytes) + " bytes");
+    }
+    for (char &c : hex)
+    {
+        if (!std::isxdigit(static_cast<unsigned char>(c)))
+        {
+            throw std::runtime_error(std::string(what) + " is not hexadecimal");
+        }
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return hex;
+}
+
+// bytes bytes with ones leading one bits, as hex
+std::string walking_ones(size_t ones, size_t bytes)
+{
+    static const char *const partial[] = { "00", "80", "c0", "e0", "f0", "f8", "fc", "fe" };
+    std::string hex;
+
+    for (size_t i = 0; i < bytes; i++, ones = ones > 8 ? ones - 8 : 0)
+    {
+        hex += ones >= 8 ? "ff" : partial[ones];
+    }
+    return hex;
+}
+
+// Whether every record of suite is vector j % n of the walking-ones family
+// kind, with the ciphertext of record j % n
+bool is_walking(const Suite &suite, Kind kind)
+{
+    size_t key_hex = 2 * suite.key_bytes;
+    size_t n = kind == VARKEY ? 8 * suite.key_bytes : 128;
+
+    for (size_t j = 0; j < suite.records.size(); j++)
+    {
+        const std::string &record = suite.records[j];
+        std::string ones = walking_ones(j % n + 1, kind == VARKEY ? suite.key_bytes : 16);
+        std::string key = kind == VARKEY ? ones : std::string(key_hex, '0');
+        std::string plain = kind == VARTXT ? ones : std::string(32, '0');
+
+        if (record.compare(0, key_hex, key) != 0
+            || record.compare(key_hex, 32, plain) != 0
+            || record.compare(key_hex + 32, 32, suite.records[j % n], key_hex + 32, 32) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+Suite read_suite(const std::string &path)
+{
+    std::ifstream in(path);
+    std::string line;
+    std::string key, plain, cipher;
+    Suite suite;
+    int line_number = 0;
+
+    if (!in)
+    {
+        throw std::runtime_error("cannot open " + path);
+    }
+    suite.name = suite_name(path);
+    suite.key_bytes = 0;
+    suite.kind = PACKED;
+
+    // a vector is complete once it has all three fields, in either order
+    auto add = [&]()
+    {
+        if (key.empty() || plain.empty() || cipher.empty())
+        {
+            return;
+        }
+        suite.records.push_back(key + plain + cipher);
+        key.clear();
+        plain.clear();
+        cipher.clear();
+    };
+
+    try
+    {
+        while (std::getline(in, line))
+        {
+            line_number++;
+            line = trim(line);
+            size_t equals = line.find('=');
+
+            if (line.empty() || line[0] == '#' || line[0] == '[')
+            {
+                continue;
+            }
+            if (equals == std::string::npos)
+            {
+                throw std::runtime_error("expected NAME = value");
+            }
+
+            std::string field = trim(line.substr(0, equals));
+            std::string value = trim(line.substr(equals + 1));
+
+            if (field == "COUNT")
+            {
+                key.clear();
+                plain.clear();
+                cipher.clear();
+            }
+            else if (field == "KEY")
+            {
+                size_t bytes = value.size() / 2;
+                if (bytes != 16 && bytes != 24 && bytes != 32)
+                {
+                    throw std::runtime_error("KEY is not 128, 192 or 256 bits");
+                }
+                if (suite.key_bytes != 0 && bytes != suite.key_bytes)
+                {
+                    throw std::runtime_error("KEY length changes within the file");
+                }
+                suite.key_bytes = bytes;
+                key = hex_field(value, bytes, "KEY");
+            }
+            else if (field == "PLAINTEXT")
+            {
+                plain = hex_field(value, 16, "PLAINTEXT");
+            }
+            else if (field == "CIPHERTEXT")
+            {
+                cipher = hex_field(value, 16, "CIPHERTEXT");
+            }
+            else
+            {
+                throw std::runtime_error("unsupported field " + field
+                                         + " (only ECB KAT files are)");
+            }
+            add();
+        }
+    }
+    catch (const std::runtime_error &e)
+    {
+        throw std::runtime_error(path + ":" + std::to_string(line_number) + ": "
+                                 + e.what());
+    }
+
+    if (suite.records.empty())
+    {
+        throw std::runtime_error(path + ": no test vectors");
+    }
+    if (is_walking(suite, VARKEY))
+    {
+        suite.kind = VARKEY;
+    }
+    else if (is_walking(suite, VARTXT))
+    {
+        suite.kind = VARTXT;
+    }
+    return suite;
+}
+
+// The ciphertexts of a walking-ones suite, one line each
+void write_ciphertexts(std::ostream &out, const Suite &suite)
+{
+    size_t n = suite.kind == VARKEY ? 8 * suite.key_bytes : 128;
+
+    n = std::min(n, suite.records.size());
+    out << "static const unsigned char " << suite.name << "["
+        << n << " * 16] =\n{\n";
+    for (size_t j = 0; j < n; j++)
+    {
+        out << "   ";
+        for (size_t at = 2 * suite.key_bytes + 32; at < suite.records[j].size(); at += 2)
+        {
+            out << " 0x" << suite.records[j].substr(at, 2) << ",";
+        }
+        out << "\n";
+    }
+    out << "};\n\n";
+}
+
+void write_suite(std::ostream &out, const Suite &suite)
+{
+    size_t record_bytes = suite.key_bytes + 32;
+
+    if (suite.kind != PACKED)
+    {
+        write_ciphertexts(out, suite);
+        return;
+    }
+
+    out << "static const unsigned char " << suite.name << "["
+        << suite.records.size() << " * " << record_bytes << "] =\n{\n";
+    for (const std::string &record : suite.records)
+    {
+        // one line each for the key, the plaintext and the ciphertext
+        size_t ends[3] = { 2 * suite.key_bytes, 2 * suite.key_bytes + 32,
+                           record.size() };
+        size_t at = 0;
+
+        for (size_t end : ends)
+        {
+            out << "   ";
+            for (; at < end; at += 2)
+            {
+                out << " 0x" << record.substr(at, 2) << ",";
+            }
+            out << "\n";
+        }
+    }
+    out << "};\n\n";
+}
+
+// The CRC-32 of the suite's ciphertexts, in record order
+unsigned long suite_digest(const Suite &suite)
+{
+    unsigned long crc = 0xFFFFFFFFUL;
+
+    for (const std::string &record : suite.records)
+    {
+        for (size_t at = 2 * suite.key_bytes + 32; at < record.size(); at += 2)
+        {
+            crc ^= std::stoul(record.substr(at, 2), nullptr, 16);
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320UL : 0);
+            }
+        }
+    }
+    return crc ^ 0xFFFFFFFFUL;
+}
+
+void write_header(std::ostream &out, const std::vector<Suite> &suites)
+{
+    static const size_t key_sizes[] = { 16, 24, 32 };
+    bool first_group = true;
+
+    out << "//*****************************************************************************\n"
+           "//\n"
+           "// aes_kat.h\n"
+           "//\n"
+           "// Generated by tools/aes_kat_gen from the NIST CAVP AES known-answer\n"
+           "// files; do not edit.  See aes_vectors.h for the record layout.\n"
+           "//\n"
+           "//*****************************************************************************\n\n";
+
+    for (size_t key_bytes : key_sizes)
+    {
+        std::vector<const Suite *> group;
+
+        for (const Suite &suite : suites)
+        {
+            if (suite.key_bytes == key_bytes)
+            {
+                group.push_back(&suite);
+            }
+        }
+        if (group.empty())
+        {
+            continue;
+        }
+
+        out << (first_group ? "#if" : "#elif") << " AES_KEY_BITS == "
+            << 8 * key_bytes << "\n\n";
+        first_group = false;
+
+        for (const Suite *suite : group)
+        {
+            write_suite(out, *suite);
+        }
+
+        out << "static const aes_suite aes_suites[] =\n{\n";
+        for (size_t i = 0; i < group.size(); i++)
+        {
+            char digest[16];
+
+            std::snprintf(digest, sizeof(digest), "0x%08lxUL", suite_digest(*group[i]));
+            out << "    { \"" << group[i]->name << "\", " << key_bytes << ", "
+                << kind_names[group[i]->kind] << ", "
+                << group[i]->records.size() << ", " << group[i]->name << ", "
+                << digest << " }"
+                << (i + 1 < group.size() ? "," : "") << "\n";
+        }
+        out << "};\n\n";
+    }
+
+    out << "#else\n"
+           "#error \"aes_kat.h has no suites for this AES_KEY_BITS\"\n"
+           "#endif\n";
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<Suite> suites;
+    std::string output;
+    int i = 1;
+
+    if (argc > 2 && std::string(argv[1]) == "-o")
+    {
+        output = argv[2];
+        i = 3;
+    }
+    if (i >= argc)
+    {
+        std::cerr << "usage: aes_kat_gen [-o header] file.rsp...\n";
+        return 2;
+    }
+
+    try
+    {
+        for (; i < argc; i++)
+        {
+            suites.push_back(read_suite(argv[i]));
+        }
+
+        if (output.empty())
+        {
+            write_header(std::cout, suites);
+        }
+        else
+        {
+            std::ofstream out(output);
+            write_header(out, suites);
+            if (!out)
+            {
+                throw std::runtime_error("cannot write " + output);
+            }
+        }
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cerr << "aes_kat_gen: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
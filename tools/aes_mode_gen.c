@@ -0,0 +1,169 @@
+//*****************************************************************************
+//
+// aes_mode_gen.c
+//
+// Computes the golden values of the chained AES workloads (see
+// aes/aes_modes.h) on the host and writes them as aes/aes_mode_golden.h:
+//
+//   cc -O2 -DAES_TTABLE -Iaes -o aes_mode_gen tools/aes_mode_gen.c
+//      aes/aes_modes.c aes/aes_ttable.c
+//   ./aes_mode_gen > aes/aes_mode_golden.h
+//
+// The workloads run through the same aes_modes.c as the benchmark, on the
+// T-table engine, which is first checked against every known-answer
+// vector.  The Monte Carlo chains follow the NIST AESAVS procedure: after
+// each checkpoint the key is XORed with the last output and the output
+// becomes the next input.  Both chains start from the first vector of
+// suite AES_MODE_SUITE.
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <string.h>
+
+#include "aes_ttable.h"
+#include "aes_modes.h"
+#include "aes_vectors.h"
+
+#define     RECORD_BYTES        48
+
+static int check_engine(void)
+{
+    unsigned char block[16];
+    unsigned char key[16];
+    unsigned char buffer[AES_RECORD_MAX_BYTES];
+    const unsigned char *record;
+    unsigned int k = 0;
+    unsigned int j = 0;
+
+    for (k = 0; k < AES_SUITES; k++)
+    {
+        if (aes_suites[k].key_bytes != 16)
+        {
+            continue;
+        }
+        for (j = 0; j < aes_suites[k].count; j++)
+        {
+            record = aes_record(&aes_suites[k], j, buffer);
+            memcpy(block, record + 16, 16);
+            memcpy(key, record, 16);
+            aes_enc_dec(block, key, 0);
+            if (memcmp(block, record + 32, 16) != 0)
+            {
+                return 0;
+            }
+            memcpy(key, record, 16);
+            aes_enc_dec(block, key, 1);
+            if (memcmp(block, record + 16, 16) != 0)
+            {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static void put_bytes(const unsigned char *bytes, unsigned int count)
+{
+    unsigned int i = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        printf("%s0x%02x,%s", i % 16 == 0 ? "    " : " ", bytes[i],
+               i % 16 == 15 ? "\n" : "");
+    }
+}
+
+// One checkpoint record per NIST MCT step.  The record is always (key,
+// plaintext, ciphertext); dir picks which of the two the chain starts from.
+static void put_mct(const char *name, const unsigned char *seed, unsigned char dir)
+{
+    unsigned char key[16];
+    unsigned char block[16];
+    unsigned char record[RECORD_BYTES];
+    unsigned int i = 0;
+    unsigned int j = 0;
+
+    memcpy(key, seed, 16);
+    memcpy(block, seed + (dir == 0 ? 16 : 32), 16);
+
+    printf("static const unsigned char %s[AES_MCT_CHECKPOINTS * %d] =\n{\n",
+           name, RECORD_BYTES);
+    for (i = 0; i < AES_MCT_CHECKPOINTS; i++)
+    {
+        memcpy(record, key, 16);
+        memcpy(record + (dir == 0 ? 16 : 32), block, 16);
+        aes_mct(block, key, dir);
+        memcpy(record + (dir == 0 ? 32 : 16), block, 16);
+        put_bytes(record, RECORD_BYTES);
+
+        for (j = 0; j < 16; j++)
+        {
+            key[j] ^= block[j];
+        }
+    }
+    printf("};\n\n");
+}
+
+int main(void)
+{
+    static unsigned char message[AES_MODE_BLOCKS][16];
+    unsigned char digest[3][AES_MODE_MESSAGES][16];
+    const aes_suite *suite = &aes_suites[AES_MODE_SUITE];
+    const unsigned char *record;
+    unsigned char buffer[AES_RECORD_MAX_BYTES];
+    unsigned int m = 0;
+
+    if (!check_engine())
+    {
+        fprintf(stderr, "aes_mode_gen: the engine fails the known-answer vectors\n");
+        return 1;
+    }
+    if (suite->key_bytes != 16 || suite->count < AES_MODE_MESSAGES)
+    {
+        fprintf(stderr, "aes_mode_gen: suite %s cannot seed %d messages\n",
+                suite->name, AES_MODE_MESSAGES);
+        return 1;
+    }
+
+    for (m = 0; m < AES_MODE_MESSAGES; m++)
+    {
+        record = aes_record(suite, m, buffer);
+        aes_mode_message(message, record);
+        aes_mode_digest(digest[0][m], (const unsigned char (*)[16]) message);
+        aes_cbc(message, record, 0);
+        aes_mode_digest(digest[1][m], (const unsigned char (*)[16]) message);
+        aes_mode_message(message, record);
+        aes_ctr(message, record);
+        aes_mode_digest(digest[2][m], (const unsigned char (*)[16]) message);
+    }
+
+    printf("//*****************************************************************************\n"
+           "//\n"
+           "// aes_mode_golden.h\n"
+           "//\n"
+           "// Generated by tools/aes_mode_gen from suite %s; do not edit.\n"
+           "// See aes_modes.h for the workloads.\n"
+           "//\n"
+           "//*****************************************************************************\n\n",
+           suite->name);
+    printf("#if AES_MCT_CHAIN != %d || AES_MCT_CHECKPOINTS != %d || AES_MODE_BLOCKS != %d \\\n"
+           "    || AES_MODE_MESSAGES != %d || AES_MODE_SUITE != %d || AES_KEY_BITS != %d\n"
+           "#error \"aes_mode_golden.h does not match aes_modes.h, run tools/aes_mode_gen\"\n"
+           "#endif\n\n",
+           AES_MCT_CHAIN, AES_MCT_CHECKPOINTS, AES_MODE_BLOCKS, AES_MODE_MESSAGES,
+           AES_MODE_SUITE, AES_KEY_BITS);
+
+    put_mct("aes_mct_encrypt", aes_record(suite, 0, buffer), 0);
+    put_mct("aes_mct_decrypt", aes_record(suite, 0, buffer), 1);
+
+    printf("static const unsigned char aes_mode_plain_digest[AES_MODE_MESSAGES * 16] =\n{\n");
+    put_bytes(digest[0][0], sizeof(digest[0]));
+    printf("};\n\nstatic const unsigned char aes_cbc_digest[AES_MODE_MESSAGES * 16] =\n{\n");
+    put_bytes(digest[1][0], sizeof(digest[1]));
+    printf("};\n\nstatic const unsigned char aes_ctr_digest[AES_MODE_MESSAGES * 16] =\n{\n");
+    put_bytes(digest[2][0], sizeof(digest[2]));
+    printf("};\n");
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+//*****************************************************************************
+//
+// emit_bench.c
+//
+// Host microbenchmark for the error-record output path.  Each YAML shape
+// is written RECORDS times through the tiny printf, the way the benchmarks
+// printed it before, and through the report*() functions, which format
+// the record with the format*() functions and queue it with sendBytes().
+// Both go through the POSIX platform backend into /dev/null (or
+// BENCH_OUTPUT), so the time is formatting plus the transmit path and
+// nothing else.  The benchmark fails if the two paths send different
+// numbers of bytes.
+//
+//   cc -O2 -DPLATFORM_POSIX -Iplatform -o emit_bench tools/emit_bench.c
+//      platform/platform_posix.c platform/tiny_printf.c
+//      platform/telemetry.c -pthread
+//   ./emit_bench
+//
+// The figures are cycles per record from the time-stamp counter on x86 and
+// nanoseconds elsewhere.  They show the relative cost only; on the MSP430
+// the 32 bit arithmetic of the varargs path weighs more than on the host.
+//
+//*****************************************************************************
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define     UNIT                "cycles"
+#else
+#define     UNIT                "ns"
+#endif
+
+#include "platform.h"
+#include "telemetry.h"
+
+// the C library printf reports the results, the benchmark output does not
+#undef printf
+#include <stdio.h>
+
+#define     RECORDS             1000000L
+#define     SHAPES              5
+
+static unsigned long long now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long long) t.tv_sec * 1000000000ULL + t.tv_nsec;
+#endif
+}
+
+static void shape_printf(int shape, long i)
+{
+    int counters[3] = { (int) i, (int) (i >> 4), 3 };
+
+    switch (shape)
+    {
+    case 0:
+        tinyPrintf("%i: [%x, %x],", (int) (i % 848), (unsigned int) i,
+                   (unsigned int) (i ^ 0x10));
+        break;
+    case 1:
+        tinyPrintf("%i_%i: [%x, %x],", (int) (i % 12), (int) (i / 12 % 12),
+                   (unsigned int) (i * 7), (unsigned int) (i * 7 ^ 1));
+        break;
+    case 2:
+        tinyPrintf(" - i: %n\r\n", (unsigned long) i * 1000);
+        break;
+    case 3:
+        tinyPrintf("   %c: %i\r\n", 'E', (int) (i % 900));
+        break;
+    default:
+        tinyPrintf("# %n", (unsigned long) i);
+        tinyPrintf(", %i", counters[0]);
+        tinyPrintf(", %i", counters[1]);
+        tinyPrintf(", %i", counters[2]);
+        tinyPrintf(", %n\r\n", droppedBytes());
+        break;
+    }
+}
+
+static void shape_emit(int shape, long i)
+{
+    int counters[3] = { (int) i, (int) (i >> 4), 3 };
+
+    switch (shape)
+    {
+    case 0:
+        reportElementIndex('E', 0, (int) (i % 848), (unsigned int) i,
+                           (unsigned int) (i ^ 0x10));
+        break;
+    case 1:
+        reportElementRowCol('E', 0, (int) (i % 12), (int) (i / 12 % 12),
+                            (unsigned long) i * 7, (unsigned long) i * 7 ^ 1);
+        break;
+    case 2:
+        reportIteration((unsigned long) i * 1000);
+        break;
+    case 3:
+        reportCount('E', (int) (i % 900));
+        break;
+    default:
+        reportHeartbeat((unsigned long) i, counters, 3);
+        break;
+    }
+}
+
+int main(void)
+{
+    static const char *const names[SHAPES] = { "element index", "element row_col",
+                                               "iteration", "count",
+                                               "heartbeat" };
+    unsigned long long start;
+    double cost_printf;
+    double cost_emit;
+    unsigned long bytes;
+    unsigned long bytes_printf;
+    unsigned long bytes_emit;
+    int shape;
+    long i;
+
+    setenv("BENCH_OUTPUT", "/dev/null", 0);
+    initPlatform();
+
+    printf("%-16s %10s %10s %8s\n", "record", "printf", "emit", "speedup");
+    for (shape = 0; shape < SHAPES; shape++)
+    {
+        bytes = outputBytes();
+        start = now();
+        for (i = 0; i < RECORDS; i++)
+        {
+            shape_printf(shape, i);
+        }
+        cost_printf = (double) (now() - start) / RECORDS;
+        bytes_printf = outputBytes() - bytes;
+
+        bytes = outputBytes();
+        start = now();
+        for (i = 0; i < RECORDS; i++)
+        {
+            shape_emit(shape, i);
+        }
+        cost_emit = (double) (now() - start) / RECORDS;
+        bytes_emit = outputBytes() - bytes;
+
+        // a cheaper path that prints something else proves nothing
+        if (bytes_emit != bytes_printf)
+        {
+            fprintf(stderr, "emit_bench: %s: %lu bytes by printf, %lu by emit\n",
+                    names[shape], bytes_printf, bytes_emit);
+            return 1;
+        }
+
+        printf("%-16s %10.1f %10.1f %7.2fx\n", names[shape], cost_printf,
+               cost_emit, cost_printf / cost_emit);
+    }
+    printf("(%s per record, %ld records each)\n", UNIT, RECORDS);
+
+    return 0;
+}
@@ -0,0 +1,215 @@
+//*****************************************************************************
+//
+// flip_analysis.hpp
+//
+// The bit-flip analysis of memtest/flip.c for the host, so that the logs
+// of campaigns run before the cache tests printed their "F" and "M" blocks
+// can be given them, and so that the blocks of new logs can be checked.
+// A Pass collects the mismatched words of one pass as flip_word() does,
+// up to the same FLIP_WORDS words unless told otherwise, and report()
+// formats them byte for byte as flip_report() prints them.
+//
+// The old records of the static cache test name the word by its value,
+// not its index, so pattern_index() finds the index from the pattern
+// word, with the rules of memtest/pattern_rule.h.
+//
+//*****************************************************************************
+
+#ifndef FLIP_ANALYSIS_HPP
+#define FLIP_ANALYSIS_HPP
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "flip.h"
+#include "pattern_rule.h"
+
+namespace flip_analysis {
+
+inline int popcount16(unsigned int bits)
+{
+    int count = 0;
+
+    for (bits &= 0xFFFF; bits != 0; bits &= bits - 1)
+    {
+        count++;
+    }
+    return count;
+}
+
+struct Flip
+{
+    int index;
+    unsigned int up;                // bits that went from 0 to 1
+    unsigned int down;              // and from 1 to 0
+
+    unsigned int mask() const { return up | down; }
+    int bits() const { return popcount16(mask()); }
+    int ups() const { return popcount16(up); }
+    int downs() const { return popcount16(down); }
+
+    // The bits that flipped, 0 the least significant
+    std::vector<int> positions() const
+    {
+        std::vector<int> at;
+
+        for (int b = 0; b < 16; b++)
+        {
+            if (mask() & (1U << b))
+            {
+                at.push_back(b);
+            }
+        }
+        return at;
+    }
+};
+
+// A run of words at adjacent indexes, a multi-cell upset
+struct Cluster
+{
+    int first;
+    int words;
+    int bits;
+};
+
+class Pass
+{
+public:
+    // limit 0 keeps every word
+    explicit Pass(size_t limit = FLIP_WORDS) : limit_(limit) {}
+
+    bool empty() const { return words_.empty(); }
+    const std::vector<Flip> &words() const { return words_; }
+    void clear() { words_.clear(); }
+
+    void add(int index, unsigned int expected, unsigned int observed)
+    {
+        unsigned int mask = (expected ^ observed) & 0xFFFF;
+        size_t w = words_.size();
+
+        while (w > 0 && words_[w - 1].index > index)
+        {
+            w--;
+        }
+        if (w > 0 && words_[w - 1].index == index)
+        {
+            words_[w - 1].up |= mask & observed;
+            words_[w - 1].down |= mask & expected;
+            return;
+        }
+        if (limit_ != 0 && words_.size() == limit_)
+        {
+            return;
+        }
+        words_.insert(words_.begin() + w, Flip{index, mask & observed, mask & expected});
+    }
+
+    std::vector<Cluster> clusters() const
+    {
+        std::vector<Cluster> runs;
+        size_t run = 0;
+
+        for (size_t w = 0; w < words_.size(); w = run)
+        {
+            int bits = words_[w].bits();
+
+            for (run = w + 1; run < words_.size()
+                 && words_[run].index == words_[run - 1].index + 1; run++)
+            {
+                bits += words_[run].bits();
+            }
+            if (run - w > 1)
+            {
+                runs.push_back(Cluster{words_[w].index, static_cast<int>(run - w), bits});
+            }
+        }
+        return runs;
+    }
+
+private:
+    size_t limit_;
+    std::vector<Flip> words_;
+};
+
+// The blocks flip_report() prints for the pass, after a " - i:" line unless
+// the test had opened the item of the pass
+inline std::string report(const Pass &pass, unsigned long ind, bool opened)
+{
+    std::string text;
+    std::vector<Cluster> runs = pass.clusters();
+    char mask[8];
+
+    if (pass.empty())
+    {
+        return text;
+    }
+
+    if (!opened)
+    {
+        text = " - i: " + std::to_string(ind) + "\r\n";
+    }
+    text += "   F: {";
+    for (const Flip &f : pass.words())
+    {
+        std::snprintf(mask, sizeof(mask), "%04X", f.mask());
+        text += std::to_string(f.index) + ": [" + mask + ", " + std::to_string(f.bits())
+                + ", " + std::to_string(f.ups()) + ", " + std::to_string(f.downs()) + "],";
+    }
+    text += "}\r\n";
+
+    if (!runs.empty())
+    {
+        text += "   M: {";
+        for (const Cluster &c : runs)
+        {
+            text += std::to_string(c.first) + ": [" + std::to_string(c.words) + ", "
+                    + std::to_string(c.bits) + "],";
+        }
+        text += "}\r\n";
+    }
+    return text;
+}
+
+// The index of word in the pattern of count words with rule and the default
+// backgrounds, or -1 if no index holds it
+inline int pattern_index(int rule, unsigned int count, unsigned int word)
+{
+    const unsigned int backgrounds[] = PATTERN_BACKGROUNDS;
+    const unsigned int n = sizeof(backgrounds) / sizeof(backgrounds[0]);
+    unsigned int block = PATTERN_BLOCK(count, n);
+    unsigned int mask = 0;
+
+    while (mask + 1 < count)
+    {
+        mask = 2 * mask + 1;
+    }
+    word &= 0xFFFF;
+    if (rule == PATTERN_LEGACY)
+    {
+        for (unsigned int index = 0; index < count && index < PATTERN_LEGACY_WORDS; index++)
+        {
+            if (PATTERN_LEGACY_WORD(index) == word)
+            {
+                return static_cast<int>(index);
+            }
+        }
+        return -1;
+    }
+    for (unsigned int b = 0; b < n; b++)
+    {
+        unsigned int index = rule == PATTERN_XOR ? (word ^ backgrounds[b]) & 0xFFFF
+                                                 : word & mask;
+
+        if (index >= b * block && index < (b + 1) * block && index < count
+            && PATTERN_WORD(rule, backgrounds[b], index, mask) == word)
+        {
+            return static_cast<int>(index);
+        }
+    }
+    return -1;
+}
+
+}
+
+#endif
@@ -0,0 +1,337 @@
+//*****************************************************************************
+//
+// flip_analyze.cpp
+//
+// Gives the YAML log of a static or original cache test the "F" and "M"
+// blocks of memtest/flip.c, computed on the host by flip_analysis.hpp:
+//
+//   c++ -std=c++11 -O2 -Imemtest -o flip_analyze tools/flip_analyze.cpp
+//   flip_analyze < campaign.yaml > campaign_flips.yaml
+//   flip_analyze -s < campaign.yaml
+//
+// The log is copied as it is, with the blocks of each pass inserted where
+// the test would have printed them: after the last record of the pass.
+// Blocks already in the log are dropped and computed again, so the output
+// of a new log is the log itself.  The " - i:" line that the original
+// cache test used to print before its blocks is dropped with them.  The
+// words come from the four-read records of cache_static, whose index is
+// found from the pattern word (the second flash read, or the first if the
+// second is not a pattern word), and
+// from the "E" blocks of cache, whose expected value is the index.  The
+// two-read records of cache_march do not have the expected word, so the
+// logs of the other tests are copied unchanged, blocks and all.
+//
+// -a keeps every word of a pass instead of the first FLIP_WORDS, and -s
+// prints totals instead of the log: the words and bits flipped, each way,
+// the flips at each bit position and the multi-cell upsets by size.
+//
+//*****************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "flip_analysis.hpp"
+#include "../platform/telemetry.h"
+
+namespace {
+
+using flip_analysis::Pass;
+
+struct Options
+{
+    bool all = false;
+    bool summary = false;
+};
+
+struct Totals
+{
+    unsigned long words = 0;
+    unsigned long bits = 0;
+    unsigned long up = 0;
+    unsigned long down = 0;
+    unsigned long positions[16] = {};
+    std::map<int, unsigned long> clusters;
+};
+
+// The log as lines that still hold their line ends, so that copying them
+// gives back every byte.  The decoder records end with "\n\r"; that \r is
+// kept with the line it ends.
+std::vector<std::string> split_lines(const std::string &log)
+{
+    std::vector<std::string> lines;
+    size_t start = 0;
+
+    while (start < log.size())
+    {
+        size_t end = log.find('\n', start);
+
+        if (end == std::string::npos)
+        {
+            end = log.size();
+        }
+        else
+        {
+            end++;
+            if (end < log.size() && log[end] == '\r' && (end < 2 || log[end - 2] != '\r'))
+            {
+                end++;
+            }
+        }
+        lines.push_back(log.substr(start, end - start));
+        start = end;
+    }
+    return lines;
+}
+
+std::string text_of(const std::string &line)
+{
+    size_t end = line.find_last_not_of("\r\n");
+
+    return end == std::string::npos ? std::string() : line.substr(0, end + 1);
+}
+
+class Analyzer
+{
+public:
+    Analyzer(const Options &options)
+        : pass_(options.all ? 0 : FLIP_WORDS)
+    {
+        const char *const names[DE_CLASSES] = DE_CLASS_NAMES;
+        std::string any;
+
+        for (const char *name : names)
+        {
+            any += (any.empty() ? "" : "|") + std::string(name);
+        }
+        decoder_ = std::regex("   (" + any + "): \\{(-?\\d+): (-?\\d+), (-?\\d+): (-?\\d+)\\}");
+    }
+
+    std::string run(const std::vector<std::string> &lines)
+    {
+        std::string out;
+        std::smatch m;
+
+        for (size_t k = 0; k < lines.size(); k++)
+        {
+            std::string text = text_of(lines[k]);
+
+            if (std::regex_match(text, m, iteration_))
+            {
+                unsigned long ind = std::strtoul(m[1].str().c_str(), nullptr, 10);
+
+                if (analysed() && k + 1 < lines.size() && is_block(text_of(lines[k + 1])))
+                {
+                    out += flush();
+                    continue;
+                }
+                if (ind != ind_)
+                {
+                    out += flush();
+                }
+                ind_ = ind;
+            }
+            else if (analysed() && is_block(text))
+            {
+                continue;
+            }
+            else if (text.compare(0, 1, "#") == 0 || text.compare(0, 6, "   L: ") == 0
+                     || text.compare(0, 3, "---") == 0)
+            {
+                out += flush();
+                if (text.compare(0, 3, "---") == 0)
+                {
+                    test_.clear();
+                    rule_ = PATTERN_LEGACY;
+                    count_ = 0;
+                }
+            }
+            else
+            {
+                header(text);
+                record(text);
+            }
+            out += lines[k];
+        }
+        return out + flush();
+    }
+
+    const Totals &totals() const { return totals_; }
+
+private:
+    // The tests whose words the log has enough of to compute the blocks from
+    bool analysed() const
+    {
+        return test_ == "cache_static" || test_ == "cache";
+    }
+
+    static bool is_block(const std::string &text)
+    {
+        return text.compare(0, 7, "   F: {") == 0 || text.compare(0, 7, "   M: {") == 0;
+    }
+
+    void header(const std::string &text)
+    {
+        std::smatch m;
+
+        if (std::regex_match(text, m, std::regex("test: (\\S+)")))
+        {
+            test_ = m[1];
+        }
+        else if (std::regex_match(text, m, std::regex("pattern: (\\S+)")))
+        {
+            rule_ = m[1] == "xor" ? PATTERN_XOR : PATTERN_LEGACY;
+        }
+        else if (std::regex_match(text, m, std::regex("Array size: (\\d+)")))
+        {
+            count_ = static_cast<unsigned int>(std::stoul(m[1]));
+        }
+    }
+
+    void record(const std::string &text)
+    {
+        std::smatch m;
+
+        if (test_ == "cache_static" && count_ > 0 && std::regex_match(text, m, decoder_))
+        {
+            unsigned int sarr_val1 = std::stoi(m[2]) & 0xFFFF;
+            unsigned int farr_val1 = std::stoi(m[3]) & 0xFFFF;
+            unsigned int farr_val2 = std::stoi(m[5]) & 0xFFFF;
+            int index = pattern_index(farr_val2);
+
+            if (index < 0)
+            {
+                index = pattern_index(farr_val1);
+            }
+            if (index >= 0)
+            {
+                pass_.add(index, farr_val1, sarr_val1);
+            }
+        }
+        else if (test_ == "cache" && text.compare(0, 7, "   E: {") == 0)
+        {
+            std::regex element("(-?\\d+): (-?\\d+),");
+
+            for (std::sregex_iterator e(text.begin(), text.end(), element), end; e != end; ++e)
+            {
+                int index = std::stoi((*e)[1]);
+
+                pass_.add(index, index & 0xFFFF, std::stoi((*e)[2]) & 0xFFFF);
+            }
+        }
+    }
+
+    int pattern_index(unsigned int word) const
+    {
+        return flip_analysis::pattern_index(rule_, count_, word);
+    }
+
+    std::string flush()
+    {
+        // the original test prints the blocks under the item of its "E" block
+        std::string blocks = flip_analysis::report(pass_, ind_, test_ == "cache");
+
+        for (const flip_analysis::Flip &f : pass_.words())
+        {
+            totals_.words++;
+            totals_.bits += f.bits();
+            totals_.up += f.ups();
+            totals_.down += f.downs();
+            for (int b : f.positions())
+            {
+                totals_.positions[b]++;
+            }
+        }
+        for (const flip_analysis::Cluster &c : pass_.clusters())
+        {
+            totals_.clusters[c.words]++;
+        }
+        pass_.clear();
+        return blocks;
+    }
+
+    Pass pass_;
+    Totals totals_;
+    std::regex iteration_{" - i: (\\d+)(, -?\\d+)?"};
+    std::regex decoder_;
+    std::string test_;
+    int rule_ = PATTERN_LEGACY;
+    unsigned int count_ = 0;
+    unsigned long ind_ = 0;
+};
+
+void print_totals(const Totals &totals)
+{
+    std::cout << "words: " << totals.words << "\n"
+              << "bits: " << totals.bits << "\n"
+              << "up: " << totals.up << "\n"
+              << "down: " << totals.down << "\n"
+              << "positions: [";
+    for (int b = 0; b < 16; b++)
+    {
+        std::cout << (b > 0 ? ", " : "") << totals.positions[b];
+    }
+    std::cout << "]\n"
+              << "clusters: {";
+    for (auto c = totals.clusters.begin(); c != totals.clusters.end(); ++c)
+    {
+        std::cout << (c != totals.clusters.begin() ? ", " : "") << c->first << ": "
+                  << c->second;
+    }
+    std::cout << "}\n";
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string flag = argv[i];
+
+        if (flag == "-a")
+        {
+            options.all = true;
+        }
+        else if (flag == "-s")
+        {
+            options.summary = true;
+        }
+        else
+        {
+            std::cerr << "usage: flip_analyze [-a] [-s] < log.yaml\n";
+            return 2;
+        }
+    }
+
+    try
+    {
+        std::string log((std::istreambuf_iterator<char>(std::cin)),
+                        std::istreambuf_iterator<char>());
+        Analyzer analyzer(options);
+        std::string out = analyzer.run(split_lines(log));
+
+        if (options.summary)
+        {
+            print_totals(analyzer.totals());
+        }
+        else
+        {
+            std::cout << out;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "flip_analyze: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
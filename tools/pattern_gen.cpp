@@ -0,0 +1,263 @@
+//*****************************************************************************
+//
+// pattern_gen.cpp
+//
+// Builds the pattern header of the static cache test and quicksort from
+// the rules in memtest/pattern_rule.h:
+//
+//   c++ -std=c++11 -O2 -Imemtest -o pattern_gen tools/pattern_gen.cpp
+//   pattern_gen -o cache_static_test/pattern.h 848
+//   pattern_gen -o qsort/pattern.h 180
+//
+// By default the words are those of the hand-made table of version 1.0,
+// which the benchmark results were taken with, and the count can be at
+// most its 848 words; quicksort takes the first 180.  -r or and -r xor
+// select the address encodings instead, for any count, and -b their
+// background words, in hex and in block order (-b 0000,FFFF,AAAA,5555 is
+// the default).  The header holds the pattern, static_pattern, and the
+// same words sorted up and down, static_pattern_forward and
+// static_pattern_reverse, for checking quicksort.  They are sorted as the
+// 16 bit ints the MSP430 compares, so that the Linux build, with its
+// wider int, sorts the same way.  PATTERN_ELEMENTS gives the size the
+// benchmark checks against its array.
+//
+// The rule is evaluated by constexpr functions, so the checks below are
+// done by the compiler.
+//
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "pattern_rule.h"
+
+namespace {
+
+// The low bits that hold every index of an array of count words
+constexpr unsigned int address_mask(unsigned int count, unsigned int mask = 0)
+{
+    return mask + 1 >= count ? mask : address_mask(count, 2 * mask + 1);
+}
+
+constexpr unsigned int pattern_word(int rule, unsigned int background,
+                                    unsigned int index, unsigned int count)
+{
+    return PATTERN_WORD(rule, background, index, address_mask(count));
+}
+
+constexpr int pattern_int(unsigned int word)
+{
+    return PATTERN_INT(word);
+}
+
+static_assert(address_mask(848) == 0x3FF, "848 words take 10 bits");
+static_assert(address_mask(180) == 0xFF, "180 words take 8 bits");
+static_assert(pattern_word(PATTERN_LEGACY, 0, 211, 848) == 0x00D3,
+              "the table of version 1.0 ends its 0s block with 0x00d3");
+static_assert(pattern_word(PATTERN_LEGACY, 0, 212, 848) == 0x3FD4,
+              "the table of version 1.0 starts its 1s block with 0x3fd4");
+static_assert(pattern_word(PATTERN_LEGACY, 0, 256, 848) == 0x7F00,
+              "the table of version 1.0 starts 0x7f00 at 256");
+static_assert(pattern_word(PATTERN_LEGACY, 0, 424, 848) == 0x55A8,
+              "the table of version 1.0 starts its As block with 0x55a8");
+static_assert(pattern_word(PATTERN_LEGACY, 0, 635, 848) == 0xAA7B,
+              "the table of version 1.0 ends its As block with 0xaa7b");
+static_assert(pattern_word(PATTERN_LEGACY, 0, 636, 848) == 0x567C,
+              "the table of version 1.0 starts its 5s block with 0x567c");
+static_assert(pattern_word(PATTERN_OR, 0x5555, 636, 848) == 0x567C,
+              "its 5s block follows the OR rule");
+static_assert(pattern_word(PATTERN_OR, 0xFFFF, 212, 848) == 0xFCD4,
+              "OR replaces the index bits of the background");
+static_assert(pattern_word(PATTERN_XOR, 0xFFFF, 1, 848) == 0xFFFE,
+              "XOR flips the index bits of the background");
+static_assert(pattern_int(0xAAAA) == -0x5556 && pattern_int(0x5555) == 0x5555,
+              "words are stored as 16 bit ints");
+
+struct Options
+{
+    std::string output;
+    int rule = PATTERN_LEGACY;
+    std::vector<unsigned int> backgrounds = PATTERN_BACKGROUNDS;
+    unsigned int count = 0;
+};
+
+std::vector<unsigned int> parse_backgrounds(const std::string &list)
+{
+    std::vector<unsigned int> backgrounds;
+    std::stringstream in(list);
+    std::string word;
+
+    while (std::getline(in, word, ','))
+    {
+        char *end = nullptr;
+        unsigned long value = std::strtoul(word.c_str(), &end, 16);
+
+        if (word.empty() || *end != '\0' || value > 0xFFFF)
+        {
+            throw std::runtime_error("bad background word '" + word + "'");
+        }
+        backgrounds.push_back(static_cast<unsigned int>(value));
+    }
+    if (backgrounds.empty())
+    {
+        throw std::runtime_error("no background words");
+    }
+    return backgrounds;
+}
+
+std::vector<int> make_pattern(const Options &options)
+{
+    unsigned int block = PATTERN_BLOCK(options.count, options.backgrounds.size());
+    std::vector<int> pattern;
+
+    for (unsigned int i = 0; i < options.count; i++)
+    {
+        unsigned int word = pattern_word(options.rule, options.backgrounds[i / block],
+                                         i, options.count);
+
+        pattern.push_back(pattern_int(word));
+    }
+    return pattern;
+}
+
+void write_array(std::ostream &out, const char *name, const std::vector<int> &words)
+{
+    char text[16];
+
+    out << "const int " << name << "[" << words.size() << "] =\n{";
+    for (size_t i = 0; i < words.size(); i++)
+    {
+        std::snprintf(text, sizeof(text), words[i] < 0 ? "-0x%04x" : "0x%04x",
+                      std::abs(words[i]));
+        out << (i % 8 == 0 ? "\n    " : " ") << text
+            << (i + 1 < words.size() ? "," : "");
+    }
+    out << "\n};\n\n";
+}
+
+void write_header(std::ostream &out, const Options &options)
+{
+    std::vector<int> pattern = make_pattern(options);
+    std::vector<int> sorted = pattern;
+    std::string name = options.output.empty() ? "pattern.h" : options.output;
+    char background[8];
+
+    name = name.substr(name.find_last_of('/') + 1);
+    std::sort(sorted.begin(), sorted.end());
+
+    out << "//*****************************************************************************\n"
+           "//\n"
+           "// " << name << "\n"
+           "//\n"
+           "// Generated by tools/pattern_gen for " << options.count << " words, ";
+    if (options.rule == PATTERN_LEGACY)
+    {
+        out << "from the table of\n"
+               "// version 1.0, rule PATTERN_LEGACY";
+    }
+    else
+    {
+        out << "backgrounds";
+        for (unsigned int word : options.backgrounds)
+        {
+            std::snprintf(background, sizeof(background), " %04X", word);
+            out << background;
+        }
+        out << ",\n"
+               "// rule " << (options.rule == PATTERN_XOR ? "PATTERN_XOR" : "PATTERN_OR");
+    }
+    out << "; do not edit.  See memtest/pattern_rule.h.\n"
+           "//\n"
+           "//*****************************************************************************\n\n"
+           "#define     PATTERN_ELEMENTS        " << options.count << "\n\n";
+
+    write_array(out, "static_pattern", pattern);
+    write_array(out, "static_pattern_forward", sorted);
+    std::reverse(sorted.begin(), sorted.end());
+    write_array(out, "static_pattern_reverse", sorted);
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    int i = 1;
+
+    try
+    {
+        for (; i + 1 < argc && argv[i][0] == '-'; i += 2)
+        {
+            std::string flag = argv[i];
+
+            if (flag == "-o")
+            {
+                options.output = argv[i + 1];
+            }
+            else if (flag == "-r" && std::string(argv[i + 1]) == "legacy")
+            {
+                options.rule = PATTERN_LEGACY;
+            }
+            else if (flag == "-r" && std::string(argv[i + 1]) == "or")
+            {
+                options.rule = PATTERN_OR;
+            }
+            else if (flag == "-r" && std::string(argv[i + 1]) == "xor")
+            {
+                options.rule = PATTERN_XOR;
+            }
+            else if (flag == "-b")
+            {
+                options.backgrounds = parse_backgrounds(argv[i + 1]);
+            }
+            else
+            {
+                break;
+            }
+        }
+        if (i + 1 != argc)
+        {
+            std::cerr << "usage: pattern_gen [-o header] [-r legacy|or|xor] "
+                         "[-b 0000,FFFF,AAAA,5555] words\n";
+            return 2;
+        }
+
+        options.count = static_cast<unsigned int>(std::strtoul(argv[i], nullptr, 10));
+        if (options.count == 0 || options.count > 0x7FFF)
+        {
+            throw std::runtime_error("the number of words must be 1 to 32767");
+        }
+        if (options.rule == PATTERN_LEGACY && options.count > PATTERN_LEGACY_WORDS)
+        {
+            throw std::runtime_error("the table of version 1.0 has 848 words");
+        }
+
+        if (options.output.empty())
+        {
+            write_header(std::cout, options);
+        }
+        else
+        {
+            std::ofstream out(options.output);
+            write_header(out, options);
+            if (!out)
+            {
+                throw std::runtime_error("cannot write " + options.output);
+            }
+        }
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cerr << "pattern_gen: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
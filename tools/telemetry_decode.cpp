@@ -0,0 +1,403 @@
+//*****************************************************************************
+//
+// telemetry_decode.cpp
+//
+// Rebuilds the YAML text of a benchmark compiled with -DTELEMETRY_BINARY
+// from its binary UART log (see platform/telemetry.h for the format).  The
+// output is byte for byte what the text build would have printed, so the
+// existing pyYAML analysis runs on it unchanged.
+//
+//   c++ -std=c++11 -O2 -o telemetry_decode tools/telemetry_decode.cpp
+//   telemetry_decode < capture.bin > capture.yaml
+//
+// Frames that do not decode (a byte lost or hit on the link) are skipped
+// and counted on standard error; the 0x00 delimiters resynchronise the
+// stream at the next frame.
+//
+//*****************************************************************************
+
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../platform/telemetry.h"
+
+namespace {
+
+const char *const de_class_names[DE_CLASSES] = DE_CLASS_NAMES;
+const char *const trace_step_names[TRACE_STEPS] = TRACE_STEP_NAMES;
+
+// Formatting at the widths of the tiny printf on the MSP430
+std::string signed16(long value)
+{
+    return std::to_string(static_cast<int16_t>(value));
+}
+
+std::string unsigned32(unsigned long value)
+{
+    return std::to_string(static_cast<uint32_t>(value));
+}
+
+std::string hex16(unsigned long value)
+{
+    char text[5];
+    std::snprintf(text, sizeof text, "%04X",
+                  static_cast<unsigned>(value & 0xFFFF));
+    return text;
+}
+
+long popcount16(unsigned long value)
+{
+    long bits = 0;
+
+    for (value &= 0xFFFF; value != 0; value &= value - 1)
+    {
+        bits++;
+    }
+    return bits;
+}
+
+class Record
+{
+public:
+    Record(const std::vector<uint8_t> &frame) : frame_(frame), at_(0) {}
+
+    bool done() const { return at_ >= frame_.size(); }
+
+    uint8_t byte()
+    {
+        if (done())
+        {
+            throw std::runtime_error("short record");
+        }
+        return frame_[at_++];
+    }
+
+    unsigned long varint()
+    {
+        unsigned long value = 0;
+        int shift = 0;
+        uint8_t b;
+
+        do
+        {
+            if (shift > 28)
+            {
+                throw std::runtime_error("varint too long");
+            }
+            b = byte();
+            value |= static_cast<unsigned long>(b & 0x7F) << shift;
+            shift += 7;
+        }
+        while (b & 0x80);
+
+        return value;
+    }
+
+    long zigzag()
+    {
+        unsigned long value = varint();
+        return (value & 1) ? -static_cast<long>(value >> 1) - 1
+                           : static_cast<long>(value >> 1);
+    }
+
+    std::string rest()
+    {
+        std::string text(frame_.begin() + at_, frame_.end());
+        at_ = frame_.size();
+        return text;
+    }
+
+private:
+    const std::vector<uint8_t> &frame_;
+    size_t at_;
+};
+
+bool cobs_decode(const std::vector<uint8_t> &encoded, std::vector<uint8_t> &out)
+{
+    size_t i = 0;
+
+    out.clear();
+    while (i < encoded.size())
+    {
+        unsigned code = encoded[i++];
+        if (code == 0 || i + code - 1 > encoded.size())
+        {
+            return false;
+        }
+        out.insert(out.end(), encoded.begin() + i, encoded.begin() + i + code - 1);
+        i += code - 1;
+        if (code < 0xFF && i < encoded.size())
+        {
+            out.push_back(0);
+        }
+    }
+
+    return true;
+}
+
+class Decoder
+{
+public:
+    Decoder() : previous_index_(0) {}
+
+    // The whole frame is formatted before any of it is written, so a frame
+    // that turns out to be damaged leaves no partial line behind.
+    std::string frame(const std::vector<uint8_t> &frame)
+    {
+        Record r(frame);
+        std::string yaml;
+
+        while (!r.done())
+        {
+            uint8_t type = r.byte();
+            uint8_t element = type & ~TM_FIRST;
+
+            if (type == TM_TEXT)
+            {
+                yaml += r.rest();
+            }
+            else if (type == TM_ITERATION)
+            {
+                yaml += " - i: " + unsigned32(r.varint()) + "\r\n";
+            }
+            else if (type == TM_ITERATION_SUB)
+            {
+                yaml += " - i: " + unsigned32(r.varint());
+                yaml += ", " + signed16(r.zigzag()) + "\r\n";
+            }
+            else if (element >= TM_ELEMENT_INDEX
+                     && element <= TM_ELEMENT_CLUSTER)
+            {
+                if (type & TM_FIRST)
+                {
+                    yaml += "   ";
+                    yaml += static_cast<char>(r.byte());
+                    yaml += ": {";
+                    previous_index_ = 0;
+                }
+                yaml += this->element(element, r);
+            }
+            else if (type == TM_ELEMENTS_END)
+            {
+                yaml += "}\r\n";
+            }
+            else if (type == TM_COUNT)
+            {
+                char key = static_cast<char>(r.byte());
+                yaml += "   ";
+                yaml += key;
+                yaml += ": " + signed16(r.zigzag()) + "\r\n";
+            }
+            else if (type == TM_SUM)
+            {
+                long expected = r.zigzag();
+                yaml += "   S: {" + signed16(expected) + ": "
+                        + signed16(r.zigzag()) + "}\r\n";
+            }
+            else if (type == TM_DECODER_ERROR)
+            {
+                yaml += decoder_error(r);
+            }
+            else if (type == TM_HEARTBEAT)
+            {
+                yaml += heartbeat(r);
+            }
+            else if (type == TM_TRACE)
+            {
+                yaml += trace(r);
+            }
+            else if (type == TM_LATENCY)
+            {
+                yaml += "   L: " + unsigned32(r.varint()) + "\r\n";
+            }
+            else if (type == TM_PRINTING)
+            {
+                long mode = r.byte();
+                yaml += "# printing: " + signed16(mode) + ", "
+                        + unsigned32(r.varint()) + "\r\n";
+            }
+            else
+            {
+                throw std::runtime_error("unknown record type");
+            }
+        }
+
+        return yaml;
+    }
+
+private:
+    std::string element(uint8_t type, Record &r)
+    {
+        std::string yaml;
+        unsigned long value1;
+
+        switch (type)
+        {
+        case TM_ELEMENT_INDEX:
+            previous_index_ = static_cast<int16_t>(previous_index_ + r.zigzag());
+            value1 = r.varint();
+            yaml = signed16(previous_index_) + ": [" + hex16(value1) + ", "
+                    + hex16(value1 ^ r.varint()) + "],";
+            break;
+        case TM_ELEMENT_ROW_COL:
+        {
+            unsigned long row = r.varint();
+            unsigned long col = r.varint();
+            value1 = r.varint();
+            yaml = signed16(row) + "_" + signed16(col) + ": [" + hex16(value1)
+                    + ", " + hex16(value1 ^ r.varint()) + "],";
+            break;
+        }
+        case TM_ELEMENT_VALUE:
+            value1 = r.varint();
+            yaml = hex16(value1) + ": " + hex16(value1 ^ r.varint()) + ",";
+            break;
+        case TM_ELEMENT_FLIP:
+        {
+            previous_index_ = static_cast<int16_t>(previous_index_ + r.zigzag());
+            value1 = r.varint();
+            long bits = popcount16(value1);
+            long up = r.byte();
+            long down = r.byte();
+            yaml = signed16(previous_index_) + ": [" + hex16(value1) + ", "
+                    + signed16(bits) + ", " + signed16(up) + ", "
+                    + signed16(down) + "],";
+            break;
+        }
+        case TM_ELEMENT_CLUSTER:
+        {
+            previous_index_ = static_cast<int16_t>(previous_index_ + r.zigzag());
+            unsigned long words = r.varint();
+            yaml = signed16(previous_index_) + ": [" + signed16(words) + ", "
+                    + signed16(r.varint()) + "],";
+            break;
+        }
+        default:
+            previous_index_ = static_cast<int16_t>(previous_index_ + r.zigzag());
+            yaml = signed16(previous_index_) + ": " + signed16(r.zigzag()) + ",";
+            break;
+        }
+
+        return yaml;
+    }
+
+    std::string decoder_error(Record &r)
+    {
+        unsigned de_class = r.byte();
+        std::vector<long> reads;
+
+        if (de_class >= DE_CLASSES)
+        {
+            throw std::runtime_error("unknown decoder-error class");
+        }
+
+        reads.push_back(r.zigzag());
+        while (!r.done())
+        {
+            reads.push_back(static_cast<int16_t>(reads[0] ^ r.varint()));
+        }
+
+        std::string yaml = std::string("   ") + de_class_names[de_class] + ": {";
+        for (size_t i = 0; i + 1 < reads.size(); i += 2)
+        {
+            yaml += (i == 0 ? "" : ", ") + signed16(reads[i]) + ": "
+                    + signed16(reads[i + 1]);
+        }
+        return yaml + "}\n\r";
+    }
+
+    std::string trace(Record &r)
+    {
+        char key = static_cast<char>(r.byte());
+        unsigned long round = r.varint();
+        unsigned step = r.byte();
+
+        if (step >= TRACE_STEPS)
+        {
+            throw std::runtime_error("unknown trace step");
+        }
+        return std::string("   T") + key + ": [" + signed16(round) + ", "
+                + trace_step_names[step] + ", " + signed16(r.varint()) + "]\r\n";
+    }
+
+    std::string heartbeat(Record &r)
+    {
+        std::string yaml = "# " + unsigned32(r.varint());
+        std::vector<unsigned long> fields;
+
+        // the counters are signed, the dropped-byte count that closes the
+        // record is not
+        while (!r.done())
+        {
+            fields.push_back(r.varint());
+        }
+        if (fields.empty())
+        {
+            throw std::runtime_error("short heartbeat");
+        }
+        for (size_t i = 0; i + 1 < fields.size(); i++)
+        {
+            unsigned long v = fields[i];
+            long counter = (v & 1) ? -static_cast<long>(v >> 1) - 1
+                                   : static_cast<long>(v >> 1);
+            yaml += ", " + signed16(counter);
+        }
+        return yaml + ", " + unsigned32(fields.back()) + "\r\n";
+    }
+
+    int previous_index_;
+};
+
+}
+
+int main()
+{
+    std::vector<uint8_t> input((std::istreambuf_iterator<char>(std::cin)),
+                               std::istreambuf_iterator<char>());
+    std::vector<uint8_t> encoded;
+    std::vector<uint8_t> frame;
+    Decoder decoder;
+    unsigned long bad_frames = 0;
+
+    std::ios::sync_with_stdio(false);
+
+    for (uint8_t b : input)
+    {
+        if (b != 0)
+        {
+            encoded.push_back(b);
+            continue;
+        }
+
+        try
+        {
+            if (!cobs_decode(encoded, frame))
+            {
+                throw std::runtime_error("bad COBS frame");
+            }
+            std::cout << decoder.frame(frame);
+        }
+        catch (const std::runtime_error &)
+        {
+            bad_frames++;
+        }
+        encoded.clear();
+    }
+
+    if (!encoded.empty())
+    {
+        bad_frames++;
+    }
+    if (bad_frames > 0)
+    {
+        std::cerr << "telemetry_decode: skipped " << bad_frames
+                  << " damaged frame(s)\n";
+    }
+
+    return bad_frames > 0 ? 1 : 0;
+}